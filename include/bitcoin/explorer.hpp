@@ -16,20 +16,34 @@
 
 #include <bitcoin/client.hpp>
 #include <bitcoin/network.hpp>
+#include <bitcoin/explorer/async_log.hpp>
+#include <bitcoin/explorer/basic_filter.hpp>
+#include <bitcoin/explorer/block_columns.hpp>
 #include <bitcoin/explorer/callback_state.hpp>
+#include <bitcoin/explorer/chain_follower.hpp>
+#include <bitcoin/explorer/codec.hpp>
+#include <bitcoin/explorer/coin_selection.hpp>
 #include <bitcoin/explorer/command.hpp>
+#include <bitcoin/explorer/completion.hpp>
+#include <bitcoin/explorer/decoded_address.hpp>
 #include <bitcoin/explorer/define.hpp>
 #include <bitcoin/explorer/dispatch.hpp>
 #include <bitcoin/explorer/display.hpp>
 #include <bitcoin/explorer/generated.hpp>
+#include <bitcoin/explorer/header_chain.hpp>
+#include <bitcoin/explorer/merkle.hpp>
 #include <bitcoin/explorer/parser.hpp>
 #include <bitcoin/explorer/prop_tree.hpp>
+#include <bitcoin/explorer/relay.hpp>
 #include <bitcoin/explorer/utility.hpp>
 #include <bitcoin/explorer/version.hpp>
+#include <bitcoin/explorer/wallet_scanner.hpp>
+#include <bitcoin/explorer/commands/address-batch.hpp>
 #include <bitcoin/explorer/commands/address-decode.hpp>
 #include <bitcoin/explorer/commands/address-embed.hpp>
 #include <bitcoin/explorer/commands/address-encode.hpp>
 #include <bitcoin/explorer/commands/address-to-key.hpp>
+#include <bitcoin/explorer/commands/agent.hpp>
 #include <bitcoin/explorer/commands/base16-decode.hpp>
 #include <bitcoin/explorer/commands/base16-encode.hpp>
 #include <bitcoin/explorer/commands/base58-decode.hpp>
@@ -44,6 +58,7 @@
 #include <bitcoin/explorer/commands/btc-to-satoshi.hpp>
 #include <bitcoin/explorer/commands/cert-new.hpp>
 #include <bitcoin/explorer/commands/cert-public.hpp>
+#include <bitcoin/explorer/commands/compute-filters.hpp>
 #include <bitcoin/explorer/commands/ec-add-secrets.hpp>
 #include <bitcoin/explorer/commands/ec-add.hpp>
 #include <bitcoin/explorer/commands/ec-decompress.hpp>
@@ -64,9 +79,11 @@
 #include <bitcoin/explorer/commands/ek-to-ec.hpp>
 #include <bitcoin/explorer/commands/electrum-new.hpp>
 #include <bitcoin/explorer/commands/electrum-to-seed.hpp>
+#include <bitcoin/explorer/commands/export-blocks.hpp>
 #include <bitcoin/explorer/commands/fetch-balance.hpp>
 #include <bitcoin/explorer/commands/fetch-block-hashes.hpp>
 #include <bitcoin/explorer/commands/fetch-block-height.hpp>
+#include <bitcoin/explorer/commands/fetch-block-txs.hpp>
 #include <bitcoin/explorer/commands/fetch-block.hpp>
 #include <bitcoin/explorer/commands/fetch-filter-checkpoint.hpp>
 #include <bitcoin/explorer/commands/fetch-filter-headers.hpp>
@@ -78,6 +95,7 @@
 #include <bitcoin/explorer/commands/fetch-tx-index.hpp>
 #include <bitcoin/explorer/commands/fetch-tx.hpp>
 #include <bitcoin/explorer/commands/fetch-utxo.hpp>
+#include <bitcoin/explorer/commands/fetch-wallet.hpp>
 #include <bitcoin/explorer/commands/get-filter-checkpoint.hpp>
 #include <bitcoin/explorer/commands/get-filter-headers.hpp>
 #include <bitcoin/explorer/commands/get-filters.hpp>
@@ -88,18 +106,23 @@
 #include <bitcoin/explorer/commands/hd-to-ec.hpp>
 #include <bitcoin/explorer/commands/hd-to-public.hpp>
 #include <bitcoin/explorer/commands/hd-to-wif.hpp>
+#include <bitcoin/explorer/commands/header-sync.hpp>
 #include <bitcoin/explorer/commands/help.hpp>
 #include <bitcoin/explorer/commands/input-set.hpp>
 #include <bitcoin/explorer/commands/input-sign.hpp>
 #include <bitcoin/explorer/commands/input-validate.hpp>
 #include <bitcoin/explorer/commands/match-neutrino-address.hpp>
 #include <bitcoin/explorer/commands/match-neutrino-script.hpp>
+#include <bitcoin/explorer/commands/merkle-branch.hpp>
+#include <bitcoin/explorer/commands/merkle-verify.hpp>
+#include <bitcoin/explorer/commands/message-batch.hpp>
 #include <bitcoin/explorer/commands/message-sign.hpp>
 #include <bitcoin/explorer/commands/message-validate.hpp>
 #include <bitcoin/explorer/commands/mnemonic-decode.hpp>
 #include <bitcoin/explorer/commands/mnemonic-encode.hpp>
 #include <bitcoin/explorer/commands/mnemonic-new.hpp>
 #include <bitcoin/explorer/commands/mnemonic-to-seed.hpp>
+#include <bitcoin/explorer/commands/pipeline.hpp>
 #include <bitcoin/explorer/commands/put-tx.hpp>
 #include <bitcoin/explorer/commands/qrcode.hpp>
 #include <bitcoin/explorer/commands/ripemd160.hpp>
@@ -109,6 +132,7 @@
 #include <bitcoin/explorer/commands/script-to-address.hpp>
 #include <bitcoin/explorer/commands/script-to-key.hpp>
 #include <bitcoin/explorer/commands/seed.hpp>
+#include <bitcoin/explorer/commands/select-utxo.hpp>
 #include <bitcoin/explorer/commands/send-tx.hpp>
 #include <bitcoin/explorer/commands/settings.hpp>
 #include <bitcoin/explorer/commands/sha160.hpp>
@@ -151,7 +175,9 @@
 #include <bitcoin/explorer/config/hashtype.hpp>
 #include <bitcoin/explorer/config/hd_key.hpp>
 #include <bitcoin/explorer/config/language.hpp>
+#include <bitcoin/explorer/config/merkle_proof.hpp>
 #include <bitcoin/explorer/config/raw.hpp>
+#include <bitcoin/explorer/config/severity.hpp>
 #include <bitcoin/explorer/config/signature.hpp>
 #include <bitcoin/explorer/config/wrapper.hpp>
 
@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_ASYNC_LOG_HPP
+#define BX_ASYNC_LOG_HPP
+
+#include <cstddef>
+#include <boost/filesystem.hpp>
+#include <boost/log/sinks/async_frontend.hpp>
+#include <boost/log/sinks/bounded_fifo_queue.hpp>
+#include <boost/log/sinks/drop_on_overflow.hpp>
+#include <boost/log/sinks/text_file_backend.hpp>
+#include <boost/shared_ptr.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * The network log of a command, written to the debug and error files by
+ * asynchronous sinks. Each sink queues records in memory and writes them on
+ * a thread of its own, so that logging does not block the threads of the
+ * network stack. Records beyond the bound of a queue are dropped. A file is
+ * not created until a record is written to it.
+ */
+class BCX_API async_log
+{
+public:
+    /**
+     * The maximum number of records queued by each sink.
+     */
+    static constexpr size_t queue_limit = 10000;
+
+    /**
+     * Start logging records of at least the minimum severity to the debug
+     * file, and of at least warning severity to the error file.
+     * @param[in]  debug_file  The debug log file path.
+     * @param[in]  error_file  The error log file path.
+     * @param[in]  minimum     The minimum severity of a logged record.
+     */
+    async_log(const boost::filesystem::path& debug_file,
+        const boost::filesystem::path& error_file,
+        system::log::severity minimum);
+
+    /**
+     * Write the queued records and stop logging.
+     */
+    ~async_log();
+
+private:
+    typedef boost::log::sinks::asynchronous_sink<
+        boost::log::sinks::text_file_backend,
+        boost::log::sinks::bounded_fifo_queue<queue_limit,
+            boost::log::sinks::drop_on_overflow>> file_sink;
+
+    static boost::shared_ptr<file_sink> add_sink(
+        const boost::filesystem::path& file, system::log::severity minimum);
+    static void remove_sink(const boost::shared_ptr<file_sink>& sink);
+
+    const boost::shared_ptr<file_sink> debug_;
+    const boost::shared_ptr<file_sink> error_;
+};
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,97 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_BASIC_FILTER_HPP
+#define BX_BASIC_FILTER_HPP
+
+#include <cstdint>
+#include <map>
+#include <vector>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * Transactions confirmed within a set of blocks, by hash.
+ */
+typedef std::map<system::hash_digest, const system::chain::transaction*>
+    transaction_index;
+
+/**
+ * Previous transactions of spends of outputs confirmed outside of a set of
+ * blocks, by hash.
+ */
+typedef std::map<system::hash_digest, system::chain::transaction>
+    transaction_map;
+
+/**
+ * Compute the SipHash-2-4 of the data.
+ * @param[in]  k0    The first 64 bits of the key.
+ * @param[in]  k1    The last 64 bits of the key.
+ * @param[in]  data  The data to hash.
+ * @return           The hash.
+ */
+BCX_API uint64_t sip_hash(uint64_t k0, uint64_t k1,
+    const system::data_chunk& data);
+
+/**
+ * Golomb-Rice encode the differences of sorted values with the BIP158 basic
+ * filter parameter (P = 19), padding the last byte with zeros.
+ * @param[in]  values  The values, in ascending order.
+ * @return             The encoded differences.
+ */
+BCX_API system::data_chunk golomb_encode(const std::vector<uint64_t>& values);
+
+/**
+ * Compute the BIP158 basic filter of a set of elements.
+ * @param[in]  block_hash  The hash of the block, which keys the filter.
+ * @param[in]  elements    The elements, which are sorted and deduplicated.
+ * @return                 The filter.
+ */
+BCX_API system::data_chunk compute_filter(
+    const system::hash_digest& block_hash, system::data_stack& elements);
+
+/**
+ * Compute a BIP157 filter header.
+ * @param[in]  filter    The filter.
+ * @param[in]  previous  The filter header of the previous block.
+ * @return               The filter header.
+ */
+BCX_API system::hash_digest filter_header(const system::data_chunk& filter,
+    const system::hash_digest& previous);
+
+/**
+ * Obtain the BIP158 basic filter elements of a block: every non-empty output
+ * script that is not null data, and every non-empty previous output script
+ * of its inputs other than that of the coinbase.
+ * @param[out] out        The elements.
+ * @param[in]  block      The block.
+ * @param[in]  confirmed  The transactions of the set of blocks.
+ * @param[in]  previous   The other previous transactions of the block.
+ * @return                False if a previous output is not found.
+ */
+BCX_API bool filter_elements(system::data_stack& out,
+    const system::chain::block& block, const transaction_index& confirmed,
+    const transaction_map& previous);
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
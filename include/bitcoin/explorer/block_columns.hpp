@@ -0,0 +1,182 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_BLOCK_COLUMNS_HPP
+#define BX_BLOCK_COLUMNS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * The column rows of a block, as the fixed width little-endian records of each
+ * column. Transactions are in block order, and inputs and outputs in
+ * transaction then index order. Addresses are dictionary encoded on write.
+ */
+class BCX_API block_columns
+{
+public:
+    typedef std::vector<block_columns> list;
+
+    /**
+     * The script type column values.
+     */
+    enum class script_type : uint8_t
+    {
+        non_standard = 0,
+        pay_key_hash = 1,
+        pay_script_hash = 2,
+        pay_public_key = 3,
+        pay_multisig = 4,
+        null_data = 5,
+        pay_witness_key_hash = 6,
+        pay_witness_script_hash = 7
+    };
+
+    /**
+     * The names of the script type column values, in order of value.
+     */
+    static const std::vector<std::string> script_type_names;
+
+    /**
+     * Decompose the blocks in parallel, one block per task.
+     * @param[in]  blocks        The blocks, in order of height.
+     * @param[in]  height        The height of the first block.
+     * @param[in]  p2kh_version  The pay to key hash address version.
+     * @param[in]  p2sh_version  The pay to script hash address version.
+     * @return                   The columns of each block, in order.
+     */
+    static list extract(const system::chain::block::list& blocks,
+        uint32_t height, uint8_t p2kh_version, uint8_t p2sh_version);
+
+    block_columns();
+
+    /**
+     * Decompose the block.
+     */
+    block_columns(const system::chain::block& block, uint32_t height,
+        uint8_t p2kh_version, uint8_t p2sh_version);
+
+    uint32_t height;
+    system::hash_digest hash;
+    size_t transactions;
+    size_t inputs;
+    size_t outputs;
+
+    /// 32 bytes per transaction.
+    system::data_chunk tx_hashes;
+
+    /// 36 bytes per input, the previous transaction hash and output index.
+    system::data_chunk input_outpoints;
+
+    /// 8 bytes per output.
+    system::data_chunk output_values;
+
+    /// 1 byte per output.
+    system::data_chunk script_types;
+
+    /// One per output, invalid if the output has no address.
+    std::vector<system::wallet::payment_address> addresses;
+};
+
+/**
+ * A writer of block columns to a directory of column files, in the order of
+ * writing. The block file has a record per block of its height, hash and the
+ * first row of the block in the transaction, input and output columns, so a
+ * reader can map and scan a single column. Address rows are an index into the
+ * address dictionary of version and hash records, or 0xffffffff for none.
+ */
+class BCX_API column_writer
+{
+public:
+    /**
+     * The record sizes of the block and address dictionary files.
+     */
+    static const size_t block_record_size = 4 + 32 + 8 + 8 + 8;
+    static const size_t address_record_size = 1 + system::short_hash_size;
+
+    /**
+     * The address row of an output without an address.
+     */
+    static const uint32_t no_address = 0xffffffff;
+
+    /**
+     * Construct a writer to the directory, which is not opened.
+     */
+    column_writer(const boost::filesystem::path& directory);
+
+    /**
+     * Create the directory if necessary and replace the column files.
+     * @return  True if all files are opened.
+     */
+    bool open();
+
+    /**
+     * Append the rows of a block to each column.
+     * @return  True if all columns are written.
+     */
+    bool write(const block_columns& columns);
+
+    /**
+     * Flush and close the column files.
+     * @return  True if all columns are written.
+     */
+    bool close();
+
+    size_t blocks() const;
+    size_t transactions() const;
+    size_t inputs() const;
+    size_t outputs() const;
+    size_t addresses() const;
+
+private:
+    typedef std::array<uint8_t, address_record_size> address_key;
+    typedef std::unique_ptr<system::ofstream> file_ptr;
+
+    file_ptr create(const std::string& name) const;
+
+    const boost::filesystem::path directory_;
+    size_t blocks_;
+    size_t transactions_;
+    size_t inputs_;
+    size_t outputs_;
+    std::map<address_key, uint32_t> dictionary_;
+
+    file_ptr block_file_;
+    file_ptr tx_hash_file_;
+    file_ptr input_outpoint_file_;
+    file_ptr output_value_file_;
+    file_ptr script_type_file_;
+    file_ptr address_file_;
+    file_ptr address_dictionary_file_;
+};
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,160 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_CHAIN_FOLLOWER_HPP
+#define BX_CHAIN_FOLLOWER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * An incremental view of the unspent outputs that pay a set of addresses,
+ * seeded at the start block and following the chain block by block. The
+ * most recent blocks are retained with the changes that each made to the
+ * view, so that a reorganization is applied by disconnecting blocks above
+ * the fork point. Each change to the view is reported as an event.
+ */
+class BCX_API chain_follower
+{
+public:
+    /**
+     * An output that pays a followed address.
+     */
+    struct output
+    {
+        system::chain::output_point point;
+        uint64_t value;
+        system::wallet::payment_address address;
+    };
+
+    /**
+     * A change to the unspent outputs, by the block at the height.
+     */
+    struct event
+    {
+        bool add;
+        size_t height;
+        chain_follower::output output;
+    };
+
+    typedef std::function<void(const event&)> handler;
+
+    /**
+     * Construct a follower of the addresses.
+     * @param[in]  depth         The number of blocks retained for
+     *                           reorganization.
+     * @param[in]  addresses     The addresses to follow.
+     * @param[in]  p2kh_version  The pay to key hash version of outputs.
+     * @param[in]  p2sh_version  The pay to script hash version of outputs.
+     * @param[in]  notify        The handler of each change to the view.
+     */
+    chain_follower(size_t depth,
+        const system::wallet::payment_address::list& addresses,
+        uint8_t p2kh_version, uint8_t p2sh_version, handler notify);
+
+    /**
+     * Set the block from which the chain is followed. Its outputs are not
+     * added to the view, and it cannot be disconnected.
+     */
+    void start(size_t height, const system::hash_digest& hash);
+
+    /**
+     * Add an output that is unspent at the start block to the view, without
+     * an event, so that its spend is reported. Call after start.
+     */
+    void seed(const chain_follower::output& output);
+
+    /**
+     * Connect the block to its parent, first disconnecting any retained
+     * blocks above the parent. A block already retained is ignored.
+     * @return  False if the parent is not retained.
+     */
+    bool connect(const system::chain::block& block);
+
+    /**
+     * Disconnect the top block, reversing its changes to the view.
+     * @return  False if only the start block is retained.
+     */
+    bool disconnect();
+
+    /**
+     * True if the block is retained.
+     */
+    bool contains(const system::hash_digest& hash) const;
+
+    /**
+     * The height and hash of the top block.
+     */
+    size_t top_height() const;
+    system::hash_digest top_hash() const;
+
+    /**
+     * The number of unspent outputs in the view.
+     */
+    size_t unspent() const;
+
+private:
+    typedef std::array<uint8_t, 1 + system::short_hash_size> address_key;
+    typedef std::pair<system::hash_digest, uint32_t> point_key;
+
+    struct change
+    {
+        bool add;
+        chain_follower::output output;
+    };
+
+    struct block_entry
+    {
+        size_t height;
+        system::hash_digest hash;
+        std::vector<change> changes;
+    };
+
+    static address_key to_key(const system::wallet::payment_address& address);
+    static point_key to_key(const system::chain::output_point& point);
+
+    bool followed(const system::chain::script& script,
+        system::wallet::payment_address& out) const;
+    void apply(block_entry& entry, bool add,
+        const chain_follower::output& output);
+
+    const size_t depth_;
+    const uint8_t p2kh_version_;
+    const uint8_t p2sh_version_;
+    const handler notify_;
+    std::set<address_key> addresses_;
+    std::deque<block_entry> blocks_;
+    std::map<point_key, chain_follower::output> unspent_;
+};
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
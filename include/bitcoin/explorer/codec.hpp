@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_CODEC_HPP
+#define BX_CODEC_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * Encode data as lower case Base16, two characters per table lookup.
+ * @param[in]  data  The data to encode.
+ * @return           The encoded value.
+ */
+BCX_API std::string to_base16(system::data_slice data);
+
+/**
+ * Decode Base16 of either case. Invalid characters are accumulated and
+ * checked once, so the loop does not branch on the input.
+ * @param[out] out  The decoded data.
+ * @param[in]  in   The value to decode.
+ * @return          False if the value is of odd length or not Base16.
+ */
+BCX_API bool from_base16(system::data_chunk& out, const std::string& in);
+
+/**
+ * Encode data as Base58. The value is converted in limbs of 58^5, four
+ * bytes at a time, so a limb operation replaces twenty byte operations.
+ * @param[in]  data  The data to encode.
+ * @return           The encoded value.
+ */
+BCX_API std::string to_base58(system::data_slice data);
+
+/**
+ * Decode Base58, five characters at a time into 32 bit limbs.
+ * @param[out] out  The decoded data.
+ * @param[in]  in   The value to decode.
+ * @return          False if the value is not Base58.
+ */
+BCX_API bool from_base58(system::data_chunk& out, const std::string& in);
+
+/**
+ * Decode Base58 of an expected size into a buffer, without allocation.
+ * @param[out] out   The buffer of the decoded value.
+ * @param[in]  size  The size of the buffer, at most 64 bytes.
+ * @param[in]  in    The value to decode.
+ * @return           False if the value is not Base58 of exactly the size.
+ */
+BCX_API bool from_base58(uint8_t* out, size_t size, const std::string& in);
+
+/**
+ * Encode a version and payload as Base58Check.
+ * @param[in]  version  The version byte.
+ * @param[in]  payload  The payload.
+ * @return              The encoded value.
+ */
+BCX_API std::string to_base58check(uint8_t version,
+    system::data_slice payload);
+
+/**
+ * Encode data as padded Base64, three bytes per 24 bit word.
+ * @param[in]  data  The data to encode.
+ * @return           The encoded value.
+ */
+BCX_API std::string to_base64(system::data_slice data);
+
+/**
+ * Decode padded Base64, four characters per 24 bit word.
+ * @param[out] out  The decoded data.
+ * @param[in]  in   The value to decode.
+ * @return          False if the value is not padded Base64.
+ */
+BCX_API bool from_base64(system::data_chunk& out, const std::string& in);
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_COIN_SELECTION_HPP
+#define BX_COIN_SELECTION_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/explorer/define.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * Select by branch and bound a set of values whose total lies within
+ * [target, target + cost_of_change], minimizing the excess over the target.
+ * The search ends at an exact match, or once it has taken the maximum number
+ * of steps or passed the deadline, with the best selection found.
+ * @param[out] out             The indexes of the selected values, ascending.
+ * @param[in]  values          The effective values, in descending order.
+ * @param[in]  target          The total to be selected.
+ * @param[in]  cost_of_change  The cost of creating and spending change.
+ * @param[in]  steps           The maximum number of search steps.
+ * @param[in]  deadline        The time at which the search is ended.
+ * @return                     True if a selection is found.
+ */
+BCX_API bool branch_and_bound(std::vector<size_t>& out,
+    const std::vector<uint64_t>& values, uint64_t target,
+    uint64_t cost_of_change, size_t steps,
+    const std::chrono::steady_clock::time_point& deadline);
+
+/**
+ * Select the largest values until their total reaches the target.
+ * @param[out] out     The indexes of the selected values, ascending.
+ * @param[in]  values  The effective values, in descending order.
+ * @param[in]  target  The total to be selected.
+ * @return             True if the values are sufficient.
+ */
+BCX_API bool largest_first(std::vector<size_t>& out,
+    const std::vector<uint64_t>& values, uint64_t target);
+
+/**
+ * Select values that require no change by branch and bound, otherwise the
+ * largest values that fund the target and change of at least dust. If the
+ * values cannot fund such change, the largest values that fund the target
+ * are selected without change, leaving the remainder to the fee.
+ * @param[out] out             The indexes of the selected values, ascending.
+ * @param[out] changeless      True if the selection requires no change.
+ * @param[in]  values          The effective values, in descending order.
+ * @param[in]  target          The total to be selected without change.
+ * @param[in]  change_fee      The cost of creating change.
+ * @param[in]  dust            The least value of change.
+ * @param[in]  cost_of_change  The cost of creating and spending change.
+ * @param[in]  steps           The maximum number of search steps.
+ * @param[in]  deadline        The time at which the search is ended.
+ * @return                     True if the values are sufficient.
+ */
+BCX_API bool select_coins(std::vector<size_t>& out, bool& changeless,
+    const std::vector<uint64_t>& values, uint64_t target,
+    uint64_t change_fee, uint64_t dust, uint64_t cost_of_change,
+    size_t steps, const std::chrono::steady_clock::time_point& deadline);
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
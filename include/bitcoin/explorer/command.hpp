@@ -39,7 +39,9 @@
 #include <bitcoin/explorer/config/hashtype.hpp>
 #include <bitcoin/explorer/config/hd_key.hpp>
 #include <bitcoin/explorer/config/language.hpp>
+#include <bitcoin/explorer/config/merkle_proof.hpp>
 #include <bitcoin/explorer/config/raw.hpp>
+#include <bitcoin/explorer/config/severity.hpp>
 #include <bitcoin/explorer/config/signature.hpp>
 #include <bitcoin/explorer/config/wrapper.hpp>
 #include <bitcoin/explorer/utility.hpp>
@@ -130,6 +132,15 @@ public:
         return false;
     }
 
+    /**
+     * Determines if the command uses the network, and so the network log.
+     * @return  True if the command is a network command.
+     */
+    virtual bool requires_network()
+    {
+        return false;
+    }
+
     /**
      * Invoke the command.
      * @param[out]  output  The input stream for the command execution.
@@ -267,6 +278,11 @@ public:
             value<boost::filesystem::path>(&setting_.network.error_file)->default_value("error.log"),
             "The error log file path, defaults to 'error.log'."
         )
+        (
+            "network.log_severity",
+            value<explorer::config::severity>(&setting_.network.log_severity)->default_value({ "info" }),
+            "The minimum severity of network log records, one of 'debug', 'info', 'warning', 'error' and 'fatal', defaults to 'info'."
+        )
         (
             "network.seed",
             value<std::vector<system::config::endpoint>>(&setting_.network.seeds),
@@ -311,6 +327,36 @@ public:
             "server.client_private_key",
             value<system::config::sodium>(&setting_.server.client_private_key),
             "The Z85-encoded private key of the client."
+        )
+        (
+            "server.agent",
+            value<boost::filesystem::path>(&setting_.server.agent),
+            "The path of the socket of a local bx agent. If the agent is running, server requests are made through it."
+        )
+        (
+            "server.hedge_url",
+            value<system::config::endpoint>(&setting_.server.hedge_url),
+            "The URL of a second Libbitcoin query service. A request that is slower than the hedge percentile of recent requests is also sent to it and the first response is used, defaults to none."
+        )
+        (
+            "server.hedge_server_public_key",
+            value<system::config::sodium>(&setting_.server.hedge_server_public_key),
+            "The Z85-encoded public key of the hedge server, defaults to the public key of the server."
+        )
+        (
+            "server.hedge_percentile",
+            value<uint16_t>(&setting_.server.hedge_percentile)->default_value(95),
+            "The latency percentile of recent requests after which a request is hedged, defaults to 95."
+        )
+        (
+            "server.request_timeout_milliseconds",
+            value<uint32_t>(&setting_.server.request_timeout_milliseconds)->default_value(0),
+            "The time limit for a server request, defaults to 0 (none)."
+        )
+        (
+            "server.headers_file",
+            value<boost::filesystem::path>(&setting_.server.headers_file),
+            "The path of the local header chain written by header-sync. If present, fetch-header by height is served from it for headers at least 144 below its top, defaults to none."
         );
     }
 
@@ -363,6 +409,22 @@ public:
         return option_metadata_;
     }
 
+    /**
+     * Get the input stream of the command, which defaults to STDIN.
+     */
+    virtual std::istream& get_input()
+    {
+        return *input_;
+    }
+
+    /**
+     * Set the input stream of the command.
+     */
+    virtual void set_input(std::istream& input)
+    {
+        input_ = &input;
+    }
+
     /**
      * Get the value of the wallet.wif_version setting.
      */
@@ -587,6 +649,22 @@ public:
         setting_.network.error_file = value;
     }
 
+    /**
+     * Get the value of the network.log_severity setting.
+     */
+    virtual explorer::config::severity get_network_log_severity_setting() const
+    {
+        return setting_.network.log_severity;
+    }
+
+    /**
+     * Set the value of the network.log_severity setting.
+     */
+    virtual void set_network_log_severity_setting(explorer::config::severity value)
+    {
+        setting_.network.log_severity = value;
+    }
+
     /**
      * Get the value of the network.seed settings.
      */
@@ -731,6 +809,102 @@ public:
         setting_.server.client_private_key = value;
     }
 
+    /**
+     * Get the value of the server.agent setting.
+     */
+    virtual boost::filesystem::path get_server_agent_setting() const
+    {
+        return setting_.server.agent;
+    }
+
+    /**
+     * Set the value of the server.agent setting.
+     */
+    virtual void set_server_agent_setting(boost::filesystem::path value)
+    {
+        setting_.server.agent = value;
+    }
+
+    /**
+     * Get the value of the server.hedge_url setting.
+     */
+    virtual system::config::endpoint get_server_hedge_url_setting() const
+    {
+        return setting_.server.hedge_url;
+    }
+
+    /**
+     * Set the value of the server.hedge_url setting.
+     */
+    virtual void set_server_hedge_url_setting(system::config::endpoint value)
+    {
+        setting_.server.hedge_url = value;
+    }
+
+    /**
+     * Get the value of the server.hedge_server_public_key setting.
+     */
+    virtual system::config::sodium get_server_hedge_server_public_key_setting() const
+    {
+        return setting_.server.hedge_server_public_key;
+    }
+
+    /**
+     * Set the value of the server.hedge_server_public_key setting.
+     */
+    virtual void set_server_hedge_server_public_key_setting(system::config::sodium value)
+    {
+        setting_.server.hedge_server_public_key = value;
+    }
+
+    /**
+     * Get the value of the server.hedge_percentile setting.
+     */
+    virtual uint16_t get_server_hedge_percentile_setting() const
+    {
+        return setting_.server.hedge_percentile;
+    }
+
+    /**
+     * Set the value of the server.hedge_percentile setting.
+     */
+    virtual void set_server_hedge_percentile_setting(uint16_t value)
+    {
+        setting_.server.hedge_percentile = value;
+    }
+
+    /**
+     * Get the value of the server.request_timeout_milliseconds setting.
+     */
+    virtual uint32_t get_server_request_timeout_milliseconds_setting() const
+    {
+        return setting_.server.request_timeout_milliseconds;
+    }
+
+    /**
+     * Set the value of the server.request_timeout_milliseconds setting.
+     */
+    virtual void set_server_request_timeout_milliseconds_setting(uint32_t value)
+    {
+        setting_.server.request_timeout_milliseconds = value;
+    }
+
+    /**
+     * Get the value of the server.headers_file setting.
+     */
+    virtual boost::filesystem::path get_server_headers_file_setting() const
+    {
+        return setting_.server.headers_file;
+    }
+
+    /**
+     * Set the value of the server.headers_file setting.
+     */
+    virtual void set_server_headers_file_setting(boost::filesystem::path value)
+    {
+        setting_.server.headers_file = value;
+    }
+
 protected:
 
     /**
@@ -738,11 +912,17 @@ protected:
      * construction here.
      */
     command()
+      : input_(&std::cin)
     {
     }
 
 private:
 
+    /**
+     * The input stream of the command.
+     */
+    std::istream* input_;
+
     /**
      * Command line argument metadata.
      */
@@ -805,6 +985,7 @@ private:
                 hosts_file(),
                 debug_file(),
                 error_file(),
+                log_severity(),
                 seeds()
             {
             }
@@ -816,6 +997,7 @@ private:
             boost::filesystem::path hosts_file;
             boost::filesystem::path debug_file;
             boost::filesystem::path error_file;
+            explorer::config::severity log_severity;
             std::vector<system::config::endpoint> seeds;
         } network;
 
@@ -829,7 +1011,13 @@ private:
                 connect_retries(),
                 connect_timeout_seconds(),
                 server_public_key(),
-                client_private_key()
+                client_private_key(),
+                agent(),
+                hedge_url(),
+                hedge_server_public_key(),
+                hedge_percentile(),
+                request_timeout_milliseconds(),
+                headers_file()
             {
             }
 
@@ -841,6 +1029,12 @@ private:
             uint16_t connect_timeout_seconds;
             system::config::sodium server_public_key;
             system::config::sodium client_private_key;
+            boost::filesystem::path agent;
+            system::config::endpoint hedge_url;
+            system::config::sodium hedge_server_public_key;
+            uint16_t hedge_percentile;
+            uint32_t request_timeout_milliseconds;
+            boost::filesystem::path headers_file;
         } server;
 
         setting()
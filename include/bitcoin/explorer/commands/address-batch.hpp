@@ -0,0 +1,279 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_ADDRESS_BATCH_HPP
+#define BX_ADDRESS_BATCH_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/program_options.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/command.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/generated.hpp>
+#include <bitcoin/explorer/config/address.hpp>
+#include <bitcoin/explorer/config/address_format.hpp>
+#include <bitcoin/explorer/config/algorithm.hpp>
+#include <bitcoin/explorer/config/btc.hpp>
+#include <bitcoin/explorer/config/byte.hpp>
+#include <bitcoin/explorer/config/cert_key.hpp>
+#include <bitcoin/explorer/config/ec_private.hpp>
+#include <bitcoin/explorer/config/electrum.hpp>
+#include <bitcoin/explorer/config/encoding.hpp>
+#include <bitcoin/explorer/config/endorsement.hpp>
+#include <bitcoin/explorer/config/hashtype.hpp>
+#include <bitcoin/explorer/config/hd_key.hpp>
+#include <bitcoin/explorer/config/language.hpp>
+#include <bitcoin/explorer/config/raw.hpp>
+#include <bitcoin/explorer/config/signature.hpp>
+#include <bitcoin/explorer/config/wrapper.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+/********* GENERATED SOURCE CODE, DO NOT EDIT EXCEPT EXPERIMENTALLY **********/
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+/**
+ * Various localizable strings.
+ */
+#define BX_ADDRESS_BATCH_FILE_FAILURE \
+    "The file could not be read: %1%"
+#define BX_ADDRESS_BATCH_INVALID \
+    "invalid"
+
+/**
+ * Class to implement the address-batch command.
+ */
+class BCX_API address_batch
+  : public command
+{
+public:
+
+    /**
+     * The symbolic (not localizable) command name, lower case.
+     */
+    static const char* symbol()
+    {
+        return "address-batch";
+    }
+
+
+    /**
+     * Destructor.
+     */
+    virtual ~address_batch()
+    {
+    }
+
+    /**
+     * The member symbolic (not localizable) command name, lower case.
+     */
+    virtual const char* name()
+    {
+        return address_batch::symbol();
+    }
+
+    /**
+     * The localizable command category name, upper case.
+     */
+    virtual const char* category()
+    {
+        return "WALLET";
+    }
+
+    /**
+     * The localizable command description.
+     */
+    virtual const char* description()
+    {
+        return "Decode and validate a set of payment and witness addresses, one per line, in parallel. The Base16 key hash or script hash of each address is written, one per line in order of the addresses, or 'invalid' for a line that is not a valid address. A Base58Check address is valid if its version is the configured pay to key hash or pay to script hash version. A witness address is valid if its prefix is that of the network selected by the network.identifier setting and its version is zero.";
+    }
+
+    /**
+     * Load program argument definitions.
+     * A value of -1 indicates that the number of instances is unlimited.
+     * @return  The loaded program argument definitions.
+     */
+    virtual system::arguments_metadata& load_arguments()
+    {
+        return get_argument_metadata();
+    }
+
+    /**
+     * Load parameter fallbacks from file or input as appropriate.
+     * @param[in]  input  The input stream for loading the parameters.
+     * @param[in]         The loaded variables.
+     */
+    virtual void load_fallbacks(std::istream& input,
+        po::variables_map& variables)
+    {
+    }
+
+    /**
+     * Load program option definitions.
+     * BUGBUG: see boost bug/fix: svn.boost.org/trac/boost/ticket/8009
+     * @return  The loaded program option definitions.
+     */
+    virtual system::options_metadata& load_options()
+    {
+        using namespace po;
+        options_description& options = get_option_metadata();
+        options.add_options()
+        (
+            BX_HELP_VARIABLE ",h",
+            value<bool>()->zero_tokens(),
+            "Get a description and instructions for this command."
+        )
+        (
+            BX_CONFIG_VARIABLE ",c",
+            value<boost::filesystem::path>(),
+            "The path to the configuration settings file."
+        )
+        (
+            "file,f",
+            value<boost::filesystem::path>(&option_.file),
+            "The path to a file of addresses, one per line, or '-' for STDIN, defaults to STDIN."
+        )
+        (
+            "key,k",
+            value<bool>(&option_.key)->zero_tokens(),
+            "Write the payments search key of each address, as address-to-key and witness-to-key, instead of its hash."
+        )
+        (
+            "valid,v",
+            value<bool>(&option_.valid)->zero_tokens(),
+            "Write only 'true' or 'false' for each line, for whether it is a valid address."
+        );
+
+        return options;
+    }
+
+    /**
+     * Set variable defaults from configuration variable values.
+     * @param[in]  variables  The loaded variables.
+     */
+    virtual void set_defaults_from_config(po::variables_map& variables)
+    {
+    }
+
+    /**
+     * Invoke the command.
+     * @param[out]  output  The input stream for the command execution.
+     * @param[out]  error   The input stream for the command execution.
+     * @return              The appropriate console return code { -1, 0, 1 }.
+     */
+    virtual system::console_result invoke(std::ostream& output,
+        std::ostream& cerr);
+
+    /* Properties */
+
+    /**
+     * Get the value of the file option.
+     */
+    virtual boost::filesystem::path& get_file_option()
+    {
+        return option_.file;
+    }
+
+    /**
+     * Set the value of the file option.
+     */
+    virtual void set_file_option(
+        const boost::filesystem::path& value)
+    {
+        option_.file = value;
+    }
+
+    /**
+     * Get the value of the key option.
+     */
+    virtual bool& get_key_option()
+    {
+        return option_.key;
+    }
+
+    /**
+     * Set the value of the key option.
+     */
+    virtual void set_key_option(
+        const bool& value)
+    {
+        option_.key = value;
+    }
+
+    /**
+     * Get the value of the valid option.
+     */
+    virtual bool& get_valid_option()
+    {
+        return option_.valid;
+    }
+
+    /**
+     * Set the value of the valid option.
+     */
+    virtual void set_valid_option(
+        const bool& value)
+    {
+        option_.valid = value;
+    }
+
+private:
+
+    /**
+     * Command line argument bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct argument
+    {
+        argument()
+        {
+        }
+
+    } argument_;
+
+    /**
+     * Command line option bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct option
+    {
+        option()
+          : file(),
+            key(),
+            valid()
+        {
+        }
+
+        boost::filesystem::path file;
+        bool key;
+        bool valid;
+    } option_;
+};
+
+} // namespace commands
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -57,6 +57,8 @@ namespace commands {
  */
 #define BX_SEND_TX_P2P_OUTPUT \
     "Sent transaction."
+#define BX_BROADCAST_TX_ACCEPTANCE \
+    "Transaction %1% requested by %2% of %3% nodes."
 
 /**
  * Class to implement the broadcast-tx command.
@@ -113,6 +115,15 @@ public:
         return "Broadcast a transaction to the Bitcoin network via the Bitcoin peer-to-peer network.";
     }
 
+    /**
+     * Determines if the command uses the network, and so the network log.
+     * @return  True if the command is a network command.
+     */
+    virtual bool requires_network()
+    {
+        return true;
+    }
+
     /**
      * Load program argument definitions.
      * A value of -1 indicates that the number of instances is unlimited.
@@ -121,7 +132,7 @@ public:
     virtual system::arguments_metadata& load_arguments()
     {
         return get_argument_metadata()
-            .add("TRANSACTION", 1);
+            .add("TRANSACTION", -1);
     }
 
     /**
@@ -133,7 +144,7 @@ public:
         po::variables_map& variables)
     {
         const auto raw = requires_raw_input();
-        load_input(get_transaction_argument(), "TRANSACTION", variables, input, raw);
+        load_input(get_transactions_argument(), "TRANSACTION", variables, input, raw);
     }
 
     /**
@@ -159,12 +170,17 @@ public:
         (
             "nodes,n",
             value<size_t>(&option_.nodes)->default_value(2),
-            "The number of network nodes to send the transaction to, defaults to 2."
+            "The number of network nodes to send the transactions to, defaults to 2."
+        )
+        (
+            "duration,d",
+            value<uint32_t>(&option_.duration)->default_value(60),
+            "The maximum duration in seconds to wait for nodes to request announced transactions, defaults to 60. Applies only to a batch of more than one transaction."
         )
         (
             "TRANSACTION",
-            value<system::config::transaction>(&argument_.transaction),
-            "The Base16 transaction to send. If not specified the transaction is read from STDIN."
+            value<std::vector<system::config::transaction>>(&argument_.transactions),
+            "The set of Base16 transactions to send. A single transaction is sent directly to each node. A batch of transactions is announced to each node and sent upon request. If not specified the transactions are read from STDIN."
         );
 
         return options;
@@ -190,20 +206,20 @@ public:
     /* Properties */
 
     /**
-     * Get the value of the TRANSACTION argument.
+     * Get the value of the TRANSACTION arguments.
      */
-    virtual system::config::transaction& get_transaction_argument()
+    virtual std::vector<system::config::transaction>& get_transactions_argument()
     {
-        return argument_.transaction;
+        return argument_.transactions;
     }
 
     /**
-     * Set the value of the TRANSACTION argument.
+     * Set the value of the TRANSACTION arguments.
      */
-    virtual void set_transaction_argument(
-        const system::config::transaction& value)
+    virtual void set_transactions_argument(
+        const std::vector<system::config::transaction>& value)
     {
-        argument_.transaction = value;
+        argument_.transactions = value;
     }
 
     /**
@@ -223,6 +239,23 @@ public:
         option_.nodes = value;
     }
 
+    /**
+     * Get the value of the duration option.
+     */
+    virtual uint32_t& get_duration_option()
+    {
+        return option_.duration;
+    }
+
+    /**
+     * Set the value of the duration option.
+     */
+    virtual void set_duration_option(
+        const uint32_t& value)
+    {
+        option_.duration = value;
+    }
+
 private:
 
     /**
@@ -233,11 +266,11 @@ private:
     struct argument
     {
         argument()
-          : transaction()
+          : transactions()
         {
         }
 
-        system::config::transaction transaction;
+        std::vector<system::config::transaction> transactions;
     } argument_;
 
     /**
@@ -248,11 +281,13 @@ private:
     struct option
     {
         option()
-          : nodes()
+          : nodes(),
+            duration()
         {
         }
 
         size_t nodes;
+        uint32_t duration;
     } option_;
 };
 
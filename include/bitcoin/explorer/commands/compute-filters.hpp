@@ -0,0 +1,273 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_COMPUTE_FILTERS_HPP
+#define BX_COMPUTE_FILTERS_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/program_options.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/command.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/generated.hpp>
+#include <bitcoin/explorer/config/address.hpp>
+#include <bitcoin/explorer/config/address_format.hpp>
+#include <bitcoin/explorer/config/algorithm.hpp>
+#include <bitcoin/explorer/config/btc.hpp>
+#include <bitcoin/explorer/config/byte.hpp>
+#include <bitcoin/explorer/config/cert_key.hpp>
+#include <bitcoin/explorer/config/ec_private.hpp>
+#include <bitcoin/explorer/config/electrum.hpp>
+#include <bitcoin/explorer/config/encoding.hpp>
+#include <bitcoin/explorer/config/endorsement.hpp>
+#include <bitcoin/explorer/config/hashtype.hpp>
+#include <bitcoin/explorer/config/hd_key.hpp>
+#include <bitcoin/explorer/config/language.hpp>
+#include <bitcoin/explorer/config/raw.hpp>
+#include <bitcoin/explorer/config/signature.hpp>
+#include <bitcoin/explorer/config/wrapper.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+/********* GENERATED SOURCE CODE, DO NOT EDIT EXCEPT EXPERIMENTALLY **********/
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+/**
+ * Various localizable strings.
+ */
+#define BX_COMPUTE_FILTERS_COUNT_REQUIRED \
+    "The count must be greater than zero."
+#define BX_COMPUTE_FILTERS_FILTER_MISMATCH \
+    "The computed filter for block %1% at height %2% does not match the served filter."
+#define BX_COMPUTE_FILTERS_HEADER_MISMATCH \
+    "The computed filter for block %1% at height %2% does not match the served filter header chain."
+#define BX_COMPUTE_FILTERS_HEADERS_INVALID \
+    "The served filter headers starting at height %1% are incomplete."
+#define BX_COMPUTE_FILTERS_PREVOUT_MISSING \
+    "The previous outputs spent by block %1% at height %2% could not be resolved."
+#define BX_COMPUTE_FILTERS_SUMMARY \
+    "Verified %1% of %2% filters."
+
+/**
+ * Class to implement the compute-filters command.
+ */
+class BCX_API compute_filters
+  : public command
+{
+public:
+
+    /**
+     * The symbolic (not localizable) command name, lower case.
+     */
+    static const char* symbol()
+    {
+        return "compute-filters";
+    }
+
+
+    /**
+     * Destructor.
+     */
+    virtual ~compute_filters()
+    {
+    }
+
+    /**
+     * The member symbolic (not localizable) command name, lower case.
+     */
+    virtual const char* name()
+    {
+        return compute_filters::symbol();
+    }
+
+    /**
+     * The localizable command category name, upper case.
+     */
+    virtual const char* category()
+    {
+        return "ONLINE";
+    }
+
+    /**
+     * The localizable command description.
+     */
+    virtual const char* description()
+    {
+        return "Compute the neutrino compact filter and filter header of each block in a height range, from blocks and previous outputs retrieved via a Libbitcoin server, and verify them against the filters and filter headers served by the same server.";
+    }
+
+    /**
+     * Determines if the command uses the network, and so the network log.
+     * @return  True if the command is a network command.
+     */
+    virtual bool requires_network()
+    {
+        return true;
+    }
+
+    /**
+     * Load program argument definitions.
+     * A value of -1 indicates that the number of instances is unlimited.
+     * @return  The loaded program argument definitions.
+     */
+    virtual system::arguments_metadata& load_arguments()
+    {
+        return get_argument_metadata()
+            .add("height", 1);
+    }
+
+    /**
+     * Load parameter fallbacks from file or input as appropriate.
+     * @param[in]  input  The input stream for loading the parameters.
+     * @param[in]         The loaded variables.
+     */
+    virtual void load_fallbacks(std::istream& input,
+        po::variables_map& variables)
+    {
+    }
+
+    /**
+     * Load program option definitions.
+     * BUGBUG: see boost bug/fix: svn.boost.org/trac/boost/ticket/8009
+     * @return  The loaded program option definitions.
+     */
+    virtual system::options_metadata& load_options()
+    {
+        using namespace po;
+        options_description& options = get_option_metadata();
+        options.add_options()
+        (
+            BX_HELP_VARIABLE ",h",
+            value<bool>()->zero_tokens(),
+            "Get a description and instructions for this command."
+        )
+        (
+            BX_CONFIG_VARIABLE ",c",
+            value<boost::filesystem::path>(),
+            "The path to the configuration settings file."
+        )
+        (
+            "count,n",
+            value<uint32_t>(&option_.count)->default_value(1),
+            "The number of blocks to compute and verify, defaults to 1."
+        )
+        (
+            "height",
+            value<uint32_t>(&argument_.height),
+            "The height of the first block."
+        );
+
+        return options;
+    }
+
+    /**
+     * Set variable defaults from configuration variable values.
+     * @param[in]  variables  The loaded variables.
+     */
+    virtual void set_defaults_from_config(po::variables_map& variables)
+    {
+    }
+
+    /**
+     * Invoke the command.
+     * @param[out]  output  The input stream for the command execution.
+     * @param[out]  error   The input stream for the command execution.
+     * @return              The appropriate console return code { -1, 0, 1 }.
+     */
+    virtual system::console_result invoke(std::ostream& output,
+        std::ostream& cerr);
+
+    /* Properties */
+
+    /**
+     * Get the value of the height argument.
+     */
+    virtual uint32_t& get_height_argument()
+    {
+        return argument_.height;
+    }
+
+    /**
+     * Set the value of the height argument.
+     */
+    virtual void set_height_argument(
+        const uint32_t& value)
+    {
+        argument_.height = value;
+    }
+
+    /**
+     * Get the value of the count option.
+     */
+    virtual uint32_t& get_count_option()
+    {
+        return option_.count;
+    }
+
+    /**
+     * Set the value of the count option.
+     */
+    virtual void set_count_option(
+        const uint32_t& value)
+    {
+        option_.count = value;
+    }
+
+private:
+
+    /**
+     * Command line argument bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct argument
+    {
+        argument()
+          : height()
+        {
+        }
+
+        uint32_t height;
+    } argument_;
+
+    /**
+     * Command line option bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct option
+    {
+        option()
+          : count()
+        {
+        }
+
+        uint32_t count;
+    } option_;
+};
+
+} // namespace commands
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
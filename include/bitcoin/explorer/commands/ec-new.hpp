@@ -59,6 +59,8 @@ namespace commands {
     "The seed is less than 128 bits long."
 #define BX_EC_NEW_INVALID_KEY \
     "The seed produced an invalid key."
+#define BX_EC_NEW_BIT_LENGTH_UNSUPPORTED \
+    "The bit length is not supported."
 
 /**
  * Class to implement the ec-new command.
@@ -135,6 +137,11 @@ public:
         po::variables_map& variables)
     {
         const auto raw = requires_raw_input();
+
+        // The input is not read in batch mode.
+        if (variables.find("count") != variables.end())
+            return;
+
         load_input(get_seed_argument(), "SEED", variables, input, raw);
     }
 
@@ -158,6 +165,16 @@ public:
             value<boost::filesystem::path>(),
             "The path to the configuration settings file."
         )
+        (
+            "count,n",
+            value<uint32_t>(&option_.count),
+            "If nonzero, generate this number of keys in parallel, one per line, each from new random entropy of the bit length. The seed is then neither used nor read from STDIN."
+        )
+        (
+            "bit_length,b",
+            value<uint16_t>(&option_.bit_length)->default_value(128),
+            "The length in bits of the entropy of each key generated by count. Must be divisible by 8 and must not be less than 128, defaults to 128."
+        )
         (
             "SEED",
             value<system::config::base16>(&argument_.seed),
@@ -184,6 +201,18 @@ public:
     virtual system::console_result invoke(std::ostream& output,
         std::ostream& cerr);
 
+    /**
+     * Evaluate the command with typed parameters and result, without
+     * program options parsing, stream formatting or exceptions.
+     * The parameters are the arguments and then the options, in order,
+     * excluding batch options, which are applied by invoke.
+     * @param[out]  result  The typed result of the command.
+     * @return              The outcome, which invoke maps to a message.
+     */
+    static evaluation evaluate(
+        explorer::config::ec_private& result,
+        const system::config::base16& seed);
+
     /* Properties */
 
     /**
@@ -203,6 +232,40 @@ public:
         argument_.seed = value;
     }
 
+    /**
+     * Get the value of the count option.
+     */
+    virtual uint32_t& get_count_option()
+    {
+        return option_.count;
+    }
+
+    /**
+     * Set the value of the count option.
+     */
+    virtual void set_count_option(
+        const uint32_t& value)
+    {
+        option_.count = value;
+    }
+
+    /**
+     * Get the value of the bit_length option.
+     */
+    virtual uint16_t& get_bit_length_option()
+    {
+        return option_.bit_length;
+    }
+
+    /**
+     * Set the value of the bit_length option.
+     */
+    virtual void set_bit_length_option(
+        const uint16_t& value)
+    {
+        option_.bit_length = value;
+    }
+
 private:
 
     /**
@@ -228,9 +291,13 @@ private:
     struct option
     {
         option()
+          : count(),
+            bit_length()
         {
         }
 
+        uint32_t count;
+        uint16_t bit_length;
     } option_;
 };
 
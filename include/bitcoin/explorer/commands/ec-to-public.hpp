@@ -181,6 +181,19 @@ public:
     virtual system::console_result invoke(std::ostream& output,
         std::ostream& cerr);
 
+    /**
+     * Evaluate the command with typed parameters and result, without
+     * program options parsing, stream formatting or exceptions.
+     * The parameters are the arguments and then the options, in order,
+     * excluding batch options, which are applied by invoke.
+     * @param[out]  result  The typed result of the command.
+     * @return              The outcome, which invoke maps to a message.
+     */
+    static evaluation evaluate(
+        system::wallet::ec_public& result,
+        const explorer::config::ec_private& ec_private_key,
+        const bool& uncompressed);
+
     /* Properties */
 
     /**
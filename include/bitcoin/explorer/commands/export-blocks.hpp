@@ -0,0 +1,294 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_EXPORT_BLOCKS_HPP
+#define BX_EXPORT_BLOCKS_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/program_options.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/command.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/generated.hpp>
+#include <bitcoin/explorer/config/address.hpp>
+#include <bitcoin/explorer/config/address_format.hpp>
+#include <bitcoin/explorer/config/algorithm.hpp>
+#include <bitcoin/explorer/config/btc.hpp>
+#include <bitcoin/explorer/config/byte.hpp>
+#include <bitcoin/explorer/config/cert_key.hpp>
+#include <bitcoin/explorer/config/ec_private.hpp>
+#include <bitcoin/explorer/config/electrum.hpp>
+#include <bitcoin/explorer/config/encoding.hpp>
+#include <bitcoin/explorer/config/endorsement.hpp>
+#include <bitcoin/explorer/config/hashtype.hpp>
+#include <bitcoin/explorer/config/hd_key.hpp>
+#include <bitcoin/explorer/config/language.hpp>
+#include <bitcoin/explorer/config/raw.hpp>
+#include <bitcoin/explorer/config/signature.hpp>
+#include <bitcoin/explorer/config/wrapper.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+/********* GENERATED SOURCE CODE, DO NOT EDIT EXCEPT EXPERIMENTALLY **********/
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+/**
+ * Various localizable strings.
+ */
+#define BX_EXPORT_BLOCKS_EXPORTED \
+    "Exported %1% blocks with %2% transactions, %3% inputs, %4% outputs and %5% addresses."
+#define BX_EXPORT_BLOCKS_FETCH_FAILURE \
+    "The block at height %1% could not be fetched: %2%"
+#define BX_EXPORT_BLOCKS_HEIGHT_FAILURE \
+    "The server height could not be fetched: %1%"
+#define BX_EXPORT_BLOCKS_INVALID_RANGE \
+    "The start height %1% is above the stop height %2%."
+#define BX_EXPORT_BLOCKS_WRITE_FAILURE \
+    "The column files could not be written: %1%"
+
+/**
+ * Class to implement the export-blocks command.
+ */
+class BCX_API export_blocks
+  : public command
+{
+public:
+
+    /**
+     * The symbolic (not localizable) command name, lower case.
+     */
+    static const char* symbol()
+    {
+        return "export-blocks";
+    }
+
+
+    /**
+     * Destructor.
+     */
+    virtual ~export_blocks()
+    {
+    }
+
+    /**
+     * The member symbolic (not localizable) command name, lower case.
+     */
+    virtual const char* name()
+    {
+        return export_blocks::symbol();
+    }
+
+    /**
+     * The localizable command category name, upper case.
+     */
+    virtual const char* category()
+    {
+        return "ONLINE";
+    }
+
+    /**
+     * The localizable command description.
+     */
+    virtual const char* description()
+    {
+        return "Export a range of blocks into column files for analytics. Each block is decomposed into transaction hashes, input outpoints, output values, output script types and output addresses, each a file of fixed width little-endian records, with addresses dictionary encoded. A block file records the first row of each block in each column. Blocks are requested in pipelined ranges and decomposed in parallel. Requires a Libbitcoin server connection.";
+    }
+
+    /**
+     * Determines if the command uses the network, and so the network log.
+     * @return  True if the command is a network command.
+     */
+    virtual bool requires_network()
+    {
+        return true;
+    }
+
+    /**
+     * Load program argument definitions.
+     * A value of -1 indicates that the number of instances is unlimited.
+     * @return  The loaded program argument definitions.
+     */
+    virtual system::arguments_metadata& load_arguments()
+    {
+        return get_argument_metadata();
+    }
+
+    /**
+     * Load parameter fallbacks from file or input as appropriate.
+     * @param[in]  input  The input stream for loading the parameters.
+     * @param[in]         The loaded variables.
+     */
+    virtual void load_fallbacks(std::istream& input,
+        po::variables_map& variables)
+    {
+    }
+
+    /**
+     * Load program option definitions.
+     * BUGBUG: see boost bug/fix: svn.boost.org/trac/boost/ticket/8009
+     * @return  The loaded program option definitions.
+     */
+    virtual system::options_metadata& load_options()
+    {
+        using namespace po;
+        options_description& options = get_option_metadata();
+        options.add_options()
+        (
+            BX_HELP_VARIABLE ",h",
+            value<bool>()->zero_tokens(),
+            "Get a description and instructions for this command."
+        )
+        (
+            BX_CONFIG_VARIABLE ",c",
+            value<boost::filesystem::path>(),
+            "The path to the configuration settings file."
+        )
+        (
+            "directory,d",
+            value<boost::filesystem::path>(&option_.directory),
+            "The directory of the column files, which are replaced, defaults to the current directory."
+        )
+        (
+            "start,s",
+            value<uint32_t>(&option_.start),
+            "The height of the first block, defaults to zero."
+        )
+        (
+            "stop,s",
+            value<uint32_t>(&option_.stop),
+            "The height of the last block, defaults to the server top."
+        );
+
+        return options;
+    }
+
+    /**
+     * Set variable defaults from configuration variable values.
+     * @param[in]  variables  The loaded variables.
+     */
+    virtual void set_defaults_from_config(po::variables_map& variables)
+    {
+    }
+
+    /**
+     * Invoke the command.
+     * @param[out]  output  The input stream for the command execution.
+     * @param[out]  error   The input stream for the command execution.
+     * @return              The appropriate console return code { -1, 0, 1 }.
+     */
+    virtual system::console_result invoke(std::ostream& output,
+        std::ostream& cerr);
+
+    /* Properties */
+
+    /**
+     * Get the value of the directory option.
+     */
+    virtual boost::filesystem::path& get_directory_option()
+    {
+        return option_.directory;
+    }
+
+    /**
+     * Set the value of the directory option.
+     */
+    virtual void set_directory_option(
+        const boost::filesystem::path& value)
+    {
+        option_.directory = value;
+    }
+
+    /**
+     * Get the value of the start option.
+     */
+    virtual uint32_t& get_start_option()
+    {
+        return option_.start;
+    }
+
+    /**
+     * Set the value of the start option.
+     */
+    virtual void set_start_option(
+        const uint32_t& value)
+    {
+        option_.start = value;
+    }
+
+    /**
+     * Get the value of the stop option.
+     */
+    virtual uint32_t& get_stop_option()
+    {
+        return option_.stop;
+    }
+
+    /**
+     * Set the value of the stop option.
+     */
+    virtual void set_stop_option(
+        const uint32_t& value)
+    {
+        option_.stop = value;
+    }
+
+private:
+
+    /**
+     * Command line argument bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct argument
+    {
+        argument()
+        {
+        }
+
+    } argument_;
+
+    /**
+     * Command line option bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct option
+    {
+        option()
+          : directory(),
+            start(),
+            stop()
+        {
+        }
+
+        boost::filesystem::path directory;
+        uint32_t start;
+        uint32_t stop;
+    } option_;
+};
+
+} // namespace commands
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,352 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_FETCH_BLOCK_TXS_HPP
+#define BX_FETCH_BLOCK_TXS_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/program_options.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/command.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/generated.hpp>
+#include <bitcoin/explorer/config/address.hpp>
+#include <bitcoin/explorer/config/address_format.hpp>
+#include <bitcoin/explorer/config/algorithm.hpp>
+#include <bitcoin/explorer/config/btc.hpp>
+#include <bitcoin/explorer/config/byte.hpp>
+#include <bitcoin/explorer/config/cert_key.hpp>
+#include <bitcoin/explorer/config/ec_private.hpp>
+#include <bitcoin/explorer/config/electrum.hpp>
+#include <bitcoin/explorer/config/encoding.hpp>
+#include <bitcoin/explorer/config/endorsement.hpp>
+#include <bitcoin/explorer/config/hashtype.hpp>
+#include <bitcoin/explorer/config/hd_key.hpp>
+#include <bitcoin/explorer/config/language.hpp>
+#include <bitcoin/explorer/config/raw.hpp>
+#include <bitcoin/explorer/config/signature.hpp>
+#include <bitcoin/explorer/config/wrapper.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+/********* GENERATED SOURCE CODE, DO NOT EDIT EXCEPT EXPERIMENTALLY **********/
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+/**
+ * Class to implement the fetch-block-txs command.
+ */
+class BCX_API fetch_block_txs
+  : public command
+{
+public:
+
+    /**
+     * The symbolic (not localizable) command name, lower case.
+     */
+    static const char* symbol()
+    {
+        return "fetch-block-txs";
+    }
+
+
+    /**
+     * Destructor.
+     */
+    virtual ~fetch_block_txs()
+    {
+    }
+
+    /**
+     * The member symbolic (not localizable) command name, lower case.
+     */
+    virtual const char* name()
+    {
+        return fetch_block_txs::symbol();
+    }
+
+    /**
+     * The localizable command category name, upper case.
+     */
+    virtual const char* category()
+    {
+        return "ONLINE";
+    }
+
+    /**
+     * The localizable command description.
+     */
+    virtual const char* description()
+    {
+        return "Get the transactions of the block from the specified hash or height, in block order. Height is ignored if both are specified. Transactions are requested concurrently over one or more connections, with a bounded number outstanding on each, and each is written as soon as it and all preceding transactions are obtained. Requires a Libbitcoin server connection.";
+    }
+
+    /**
+     * Determines if the command uses the network, and so the network log.
+     * @return  True if the command is a network command.
+     */
+    virtual bool requires_network()
+    {
+        return true;
+    }
+
+    /**
+     * Load program argument definitions.
+     * A value of -1 indicates that the number of instances is unlimited.
+     * @return  The loaded program argument definitions.
+     */
+    virtual system::arguments_metadata& load_arguments()
+    {
+        return get_argument_metadata();
+    }
+
+    /**
+     * Load parameter fallbacks from file or input as appropriate.
+     * @param[in]  input  The input stream for loading the parameters.
+     * @param[in]         The loaded variables.
+     */
+    virtual void load_fallbacks(std::istream& input,
+        po::variables_map& variables)
+    {
+    }
+
+    /**
+     * Load program option definitions.
+     * BUGBUG: see boost bug/fix: svn.boost.org/trac/boost/ticket/8009
+     * @return  The loaded program option definitions.
+     */
+    virtual system::options_metadata& load_options()
+    {
+        using namespace po;
+        options_description& options = get_option_metadata();
+        options.add_options()
+        (
+            BX_HELP_VARIABLE ",h",
+            value<bool>()->zero_tokens(),
+            "Get a description and instructions for this command."
+        )
+        (
+            BX_CONFIG_VARIABLE ",c",
+            value<boost::filesystem::path>(),
+            "The path to the configuration settings file."
+        )
+        (
+            "connections,c",
+            value<uint32_t>(&option_.connections)->default_value(1),
+            "The number of server connections, defaults to 1."
+        )
+        (
+            "format,f",
+            value<explorer::config::encoding>(&option_.format),
+            "The output format. Options are 'info', 'json' and 'xml', defaults to 'info'."
+        )
+        (
+            "hash,s",
+            value<system::config::hash256>(&option_.hash),
+            "The Base16 block hash."
+        )
+        (
+            "height,t",
+            value<uint32_t>(&option_.height),
+            "The block height."
+        )
+        (
+            "window,w",
+            value<uint32_t>(&option_.window)->default_value(100),
+            "The maximum number of transaction requests outstanding on each connection, defaults to 100."
+        )
+        (
+            "witness,w",
+            value<bool>(&option_.witness)->zero_tokens(),
+            "Include witness as applicable. Requires a version 3.4 or later Libbitcoin server connection."
+        );
+
+        return options;
+    }
+
+    /**
+     * Set variable defaults from configuration variable values.
+     * @param[in]  variables  The loaded variables.
+     */
+    virtual void set_defaults_from_config(po::variables_map& variables)
+    {
+    }
+
+    /**
+     * Invoke the command.
+     * @param[out]  output  The input stream for the command execution.
+     * @param[out]  error   The input stream for the command execution.
+     * @return              The appropriate console return code { -1, 0, 1 }.
+     */
+    virtual system::console_result invoke(std::ostream& output,
+        std::ostream& cerr);
+
+    /* Properties */
+
+    /**
+     * Get the value of the connections option.
+     */
+    virtual uint32_t& get_connections_option()
+    {
+        return option_.connections;
+    }
+
+    /**
+     * Set the value of the connections option.
+     */
+    virtual void set_connections_option(
+        const uint32_t& value)
+    {
+        option_.connections = value;
+    }
+
+    /**
+     * Get the value of the format option.
+     */
+    virtual explorer::config::encoding& get_format_option()
+    {
+        return option_.format;
+    }
+
+    /**
+     * Set the value of the format option.
+     */
+    virtual void set_format_option(
+        const explorer::config::encoding& value)
+    {
+        option_.format = value;
+    }
+
+    /**
+     * Get the value of the hash option.
+     */
+    virtual system::config::hash256& get_hash_option()
+    {
+        return option_.hash;
+    }
+
+    /**
+     * Set the value of the hash option.
+     */
+    virtual void set_hash_option(
+        const system::config::hash256& value)
+    {
+        option_.hash = value;
+    }
+
+    /**
+     * Get the value of the height option.
+     */
+    virtual uint32_t& get_height_option()
+    {
+        return option_.height;
+    }
+
+    /**
+     * Set the value of the height option.
+     */
+    virtual void set_height_option(
+        const uint32_t& value)
+    {
+        option_.height = value;
+    }
+
+    /**
+     * Get the value of the window option.
+     */
+    virtual uint32_t& get_window_option()
+    {
+        return option_.window;
+    }
+
+    /**
+     * Set the value of the window option.
+     */
+    virtual void set_window_option(
+        const uint32_t& value)
+    {
+        option_.window = value;
+    }
+
+    /**
+     * Get the value of the witness option.
+     */
+    virtual bool& get_witness_option()
+    {
+        return option_.witness;
+    }
+
+    /**
+     * Set the value of the witness option.
+     */
+    virtual void set_witness_option(
+        const bool& value)
+    {
+        option_.witness = value;
+    }
+
+private:
+
+    /**
+     * Command line argument bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct argument
+    {
+        argument()
+        {
+        }
+
+    } argument_;
+
+    /**
+     * Command line option bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct option
+    {
+        option()
+          : connections(),
+            format(),
+            hash(),
+            height(),
+            window(),
+            witness()
+        {
+        }
+
+        uint32_t connections;
+        explorer::config::encoding format;
+        system::config::hash256 hash;
+        uint32_t height;
+        uint32_t window;
+        bool witness;
+    } option_;
+};
+
+} // namespace commands
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
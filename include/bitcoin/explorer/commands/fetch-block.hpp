@@ -100,6 +100,15 @@ public:
         return "Get the block from the specified hash or height. Height is ignored if both are specified. Requires a Libbitcoin server connection.";
     }
 
+    /**
+     * Determines if the command uses the network, and so the network log.
+     * @return  True if the command is a network command.
+     */
+    virtual bool requires_network()
+    {
+        return true;
+    }
+
     /**
      * Load program argument definitions.
      * A value of -1 indicates that the number of instances is unlimited.
@@ -106,6 +106,15 @@ public:
         return "Retrieve compact filter checkpoint via a Libbitcoin server.";
     }
 
+    /**
+     * Determines if the command uses the network, and so the network log.
+     * @return  True if the command is a network command.
+     */
+    virtual bool requires_network()
+    {
+        return true;
+    }
+
     /**
      * Load program argument definitions.
      * A value of -1 indicates that the number of instances is unlimited.
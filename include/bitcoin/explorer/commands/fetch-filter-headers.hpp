@@ -106,6 +106,15 @@ public:
         return "Retrieve compact filter headers via a Libbitcoin server. The distance between provided height and hash must be strictly less than 2000.";
     }
 
+    /**
+     * Determines if the command uses the network, and so the network log.
+     * @return  True if the command is a network command.
+     */
+    virtual bool requires_network()
+    {
+        return true;
+    }
+
     /**
      * Load program argument definitions.
      * A value of -1 indicates that the number of instances is unlimited.
@@ -97,7 +97,16 @@ public:
      */
     virtual const char* description()
     {
-        return "Get the block header from the specified hash or height. Height is ignored if both are specified. Requires a Libbitcoin server connection.";
+        return "Get the block header from the specified hash or height. Height is ignored if both are specified. A header by height is obtained from the local header chain if it is at least 144 below its top, as a header above it may have been reorganized since the chain was synchronized, see header-sync. Requires a Libbitcoin server connection.";
+    }
+
+    /**
+     * Determines if the command uses the network, and so the network log.
+     * @return  True if the command is a network command.
+     */
+    virtual bool requires_network()
+    {
+        return true;
     }
 
     /**
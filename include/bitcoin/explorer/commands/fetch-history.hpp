@@ -106,6 +106,15 @@ public:
         return "Get list of output points, values, and spends for a payment key. Requires a Libbitcoin server connection.";
     }
 
+    /**
+     * Determines if the command uses the network, and so the network log.
+     * @return  True if the command is a network command.
+     */
+    virtual bool requires_network()
+    {
+        return true;
+    }
+
     /**
      * Load program argument definitions.
      * A value of -1 indicates that the number of instances is unlimited.
@@ -55,8 +55,8 @@ namespace commands {
 /**
  * Various localizable strings.
  */
-#define BX_FETCH_PUBLIC_KEY_NOT_IMPLEMENTED \
-    "This command is not yet implemented."
+#define BX_FETCH_PUBLIC_KEY_NOT_FOUND \
+    "No public key has been revealed for key: %1%"
 
 /**
  * Class to implement the fetch-public-key command.
@@ -110,7 +110,16 @@ public:
      */
     virtual const char* description()
     {
-        return "Get the EC public key of the address, if it exists on the blockchain. Requires a Libbitcoin server connection.";
+        return "Get the EC public key of each payments search key, if it has been revealed by a p2pkh, p2wpkh or p2sh-p2wpkh spend on the blockchain. Requires a version 3.4 or later Libbitcoin server connection.";
+    }
+
+    /**
+     * Determines if the command uses the network, and so the network log.
+     * @return  True if the command is a network command.
+     */
+    virtual bool requires_network()
+    {
+        return true;
     }
 
     /**
@@ -121,7 +130,7 @@ public:
     virtual system::arguments_metadata& load_arguments()
     {
         return get_argument_metadata()
-            .add("hash", 1);
+            .add("KEY", -1);
     }
 
     /**
@@ -133,7 +142,7 @@ public:
         po::variables_map& variables)
     {
         const auto raw = requires_raw_input();
-        load_input(get_hash_argument(), "hash", variables, input, raw);
+        load_input(get_keys_argument(), "KEY", variables, input, raw);
     }
 
     /**
@@ -157,9 +166,9 @@ public:
             "The path to the configuration settings file."
         )
         (
-            "hash",
-            value<system::config::hash256>(&argument_.hash),
-            "The Base16 payments search key of the public key. If not specified the key is read from STDIN."
+            "KEY",
+            value<std::vector<system::config::hash256>>(&argument_.keys),
+            "The set of Base16 payments search keys of the public keys. If not specified the keys are read from STDIN."
         );
 
         return options;
@@ -185,20 +194,20 @@ public:
     /* Properties */
 
     /**
-     * Get the value of the hash argument.
+     * Get the value of the KEY arguments.
      */
-    virtual system::config::hash256& get_hash_argument()
+    virtual std::vector<system::config::hash256>& get_keys_argument()
     {
-        return argument_.hash;
+        return argument_.keys;
     }
 
     /**
-     * Set the value of the hash argument.
+     * Set the value of the KEY arguments.
      */
-    virtual void set_hash_argument(
-        const system::config::hash256& value)
+    virtual void set_keys_argument(
+        const std::vector<system::config::hash256>& value)
     {
-        argument_.hash = value;
+        argument_.keys = value;
     }
 
 private:
@@ -211,11 +220,11 @@ private:
     struct argument
     {
         argument()
-          : hash()
+          : keys()
         {
         }
 
-        system::config::hash256 hash;
+        std::vector<system::config::hash256> keys;
     } argument_;
 
     /**
@@ -0,0 +1,374 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_FETCH_WALLET_HPP
+#define BX_FETCH_WALLET_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/program_options.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/command.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/generated.hpp>
+#include <bitcoin/explorer/config/address.hpp>
+#include <bitcoin/explorer/config/address_format.hpp>
+#include <bitcoin/explorer/config/algorithm.hpp>
+#include <bitcoin/explorer/config/btc.hpp>
+#include <bitcoin/explorer/config/byte.hpp>
+#include <bitcoin/explorer/config/cert_key.hpp>
+#include <bitcoin/explorer/config/ec_private.hpp>
+#include <bitcoin/explorer/config/electrum.hpp>
+#include <bitcoin/explorer/config/encoding.hpp>
+#include <bitcoin/explorer/config/endorsement.hpp>
+#include <bitcoin/explorer/config/hashtype.hpp>
+#include <bitcoin/explorer/config/hd_key.hpp>
+#include <bitcoin/explorer/config/language.hpp>
+#include <bitcoin/explorer/config/raw.hpp>
+#include <bitcoin/explorer/config/signature.hpp>
+#include <bitcoin/explorer/config/wrapper.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+/********* GENERATED SOURCE CODE, DO NOT EDIT EXCEPT EXPERIMENTALLY **********/
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+/**
+ * Various localizable strings.
+ */
+#define BX_FETCH_WALLET_INVALID_KEY \
+    "The HD public key at position %1% is not valid."
+
+/**
+ * Class to implement the fetch-wallet command.
+ */
+class BCX_API fetch_wallet
+  : public command
+{
+public:
+
+    /**
+     * The symbolic (not localizable) command name, lower case.
+     */
+    static const char* symbol()
+    {
+        return "fetch-wallet";
+    }
+
+
+    /**
+     * Destructor.
+     */
+    virtual ~fetch_wallet()
+    {
+    }
+
+    /**
+     * The member symbolic (not localizable) command name, lower case.
+     */
+    virtual const char* name()
+    {
+        return fetch_wallet::symbol();
+    }
+
+    /**
+     * The localizable command category name, upper case.
+     */
+    virtual const char* category()
+    {
+        return "ONLINE";
+    }
+
+    /**
+     * The localizable command description.
+     */
+    virtual const char* description()
+    {
+        return "Discover the used addresses of one or more HD (BIP32) account public keys, with the balance and unspent outputs of each. The receive and change chains of each key are scanned until the gap limit of consecutive unused addresses follows the last used address. Addresses are derived ahead on a thread of their own while history requests are pipelined, and the gap window advances as each result arrives. Requires a Libbitcoin server connection.";
+    }
+
+    /**
+     * Determines if the command uses the network, and so the network log.
+     * @return  True if the command is a network command.
+     */
+    virtual bool requires_network()
+    {
+        return true;
+    }
+
+    /**
+     * Load program argument definitions.
+     * A value of -1 indicates that the number of instances is unlimited.
+     * @return  The loaded program argument definitions.
+     */
+    virtual system::arguments_metadata& load_arguments()
+    {
+        return get_argument_metadata()
+            .add("HD_PUBLIC_KEY", -1);
+    }
+
+    /**
+     * Load parameter fallbacks from file or input as appropriate.
+     * @param[in]  input  The input stream for loading the parameters.
+     * @param[in]         The loaded variables.
+     */
+    virtual void load_fallbacks(std::istream& input,
+        po::variables_map& variables)
+    {
+        const auto raw = requires_raw_input();
+        load_input(get_hd_public_keys_argument(), "HD_PUBLIC_KEY", variables, input, raw);
+    }
+
+    /**
+     * Load program option definitions.
+     * BUGBUG: see boost bug/fix: svn.boost.org/trac/boost/ticket/8009
+     * @return  The loaded program option definitions.
+     */
+    virtual system::options_metadata& load_options()
+    {
+        using namespace po;
+        options_description& options = get_option_metadata();
+        options.add_options()
+        (
+            BX_HELP_VARIABLE ",h",
+            value<bool>()->zero_tokens(),
+            "Get a description and instructions for this command."
+        )
+        (
+            BX_CONFIG_VARIABLE ",c",
+            value<boost::filesystem::path>(),
+            "The path to the configuration settings file."
+        )
+        (
+            "format,f",
+            value<explorer::config::encoding>(&option_.format),
+            "The output format. Options are 'info', 'json' and 'xml', defaults to 'info'."
+        )
+        (
+            "gap,g",
+            value<uint32_t>(&option_.gap)->default_value(20),
+            "The number of consecutive unused addresses that ends the scan of a chain, defaults to 20."
+        )
+        (
+            "public_version,p",
+            value<uint32_t>(&option_.public_version)->default_value(76067358),
+            "The expected version for an HD public key, defaults to 76067358."
+        )
+        (
+            "version,v",
+            value<explorer::config::byte>(&option_.version)->default_value(0),
+            "The desired payment address version."
+        )
+        (
+            "window,w",
+            value<uint32_t>(&option_.window)->default_value(100),
+            "The maximum number of history requests outstanding, defaults to 100."
+        )
+        (
+            "HD_PUBLIC_KEY",
+            value<std::vector<explorer::config::hd_key>>(&argument_.hd_public_keys),
+            "The set of HD public keys of the accounts to scan. If not specified the keys are read from STDIN."
+        );
+
+        return options;
+    }
+
+    /**
+     * Set variable defaults from configuration variable values.
+     * @param[in]  variables  The loaded variables.
+     */
+    virtual void set_defaults_from_config(po::variables_map& variables)
+    {
+        const auto& option_public_version = variables["public_version"];
+        const auto& option_public_version_config = variables["wallet.hd_public_version"];
+        if (option_public_version.defaulted() && !option_public_version_config.defaulted())
+        {
+            option_.public_version = option_public_version_config.as<uint32_t>();
+        }
+
+        const auto& option_version = variables["version"];
+        const auto& option_version_config = variables["wallet.pay_to_public_key_hash_version"];
+        if (option_version.defaulted() && !option_version_config.defaulted())
+        {
+            option_.version = option_version_config.as<explorer::config::byte>();
+        }
+    }
+
+    /**
+     * Invoke the command.
+     * @param[out]  output  The input stream for the command execution.
+     * @param[out]  error   The input stream for the command execution.
+     * @return              The appropriate console return code { -1, 0, 1 }.
+     */
+    virtual system::console_result invoke(std::ostream& output,
+        std::ostream& cerr);
+
+    /* Properties */
+
+    /**
+     * Get the value of the HD_PUBLIC_KEY arguments.
+     */
+    virtual std::vector<explorer::config::hd_key>& get_hd_public_keys_argument()
+    {
+        return argument_.hd_public_keys;
+    }
+
+    /**
+     * Set the value of the HD_PUBLIC_KEY arguments.
+     */
+    virtual void set_hd_public_keys_argument(
+        const std::vector<explorer::config::hd_key>& value)
+    {
+        argument_.hd_public_keys = value;
+    }
+
+    /**
+     * Get the value of the format option.
+     */
+    virtual explorer::config::encoding& get_format_option()
+    {
+        return option_.format;
+    }
+
+    /**
+     * Set the value of the format option.
+     */
+    virtual void set_format_option(
+        const explorer::config::encoding& value)
+    {
+        option_.format = value;
+    }
+
+    /**
+     * Get the value of the gap option.
+     */
+    virtual uint32_t& get_gap_option()
+    {
+        return option_.gap;
+    }
+
+    /**
+     * Set the value of the gap option.
+     */
+    virtual void set_gap_option(
+        const uint32_t& value)
+    {
+        option_.gap = value;
+    }
+
+    /**
+     * Get the value of the public_version option.
+     */
+    virtual uint32_t& get_public_version_option()
+    {
+        return option_.public_version;
+    }
+
+    /**
+     * Set the value of the public_version option.
+     */
+    virtual void set_public_version_option(
+        const uint32_t& value)
+    {
+        option_.public_version = value;
+    }
+
+    /**
+     * Get the value of the version option.
+     */
+    virtual explorer::config::byte& get_version_option()
+    {
+        return option_.version;
+    }
+
+    /**
+     * Set the value of the version option.
+     */
+    virtual void set_version_option(
+        const explorer::config::byte& value)
+    {
+        option_.version = value;
+    }
+
+    /**
+     * Get the value of the window option.
+     */
+    virtual uint32_t& get_window_option()
+    {
+        return option_.window;
+    }
+
+    /**
+     * Set the value of the window option.
+     */
+    virtual void set_window_option(
+        const uint32_t& value)
+    {
+        option_.window = value;
+    }
+
+private:
+
+    /**
+     * Command line argument bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct argument
+    {
+        argument()
+          : hd_public_keys()
+        {
+        }
+
+        std::vector<explorer::config::hd_key> hd_public_keys;
+    } argument_;
+
+    /**
+     * Command line option bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct option
+    {
+        option()
+          : format(),
+            gap(),
+            public_version(),
+            version(),
+            window()
+        {
+        }
+
+        explorer::config::encoding format;
+        uint32_t gap;
+        uint32_t public_version;
+        explorer::config::byte version;
+        uint32_t window;
+    } option_;
+};
+
+} // namespace commands
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -57,6 +57,20 @@ namespace commands {
  */
 #define BX_BIP157_UNSUPPORTED \
     "The peer does not indicate support for BIP157."
+#define BX_GET_FILTERS_START_REQUIRED \
+    "The start block hash is required for parallel retrieval."
+#define BX_GET_FILTERS_HEADERS_FAILURE \
+    "The headers from the start block to the provided block hash could not be obtained."
+#define BX_GET_FILTERS_BATCH_FAILURE \
+    "The filters from height %1% to %2% could not be obtained."
+#define BX_GET_FILTERS_CHECKPOINT_MISMATCH \
+    "The filters from height %1% to %2% do not match the filter header checkpoint."
+#define BX_GET_FILTERS_HEADERS_MISMATCH \
+    "The filters from height %1% to %2% do not match the filter headers."
+#define BX_GET_FILTERS_TIMEOUT \
+    "The filters could not be obtained within %1% seconds."
+#define BX_GET_FILTERS_UNVERIFIED \
+    "The filters from height %1% to %2% could not be verified."
 
 /**
  * Class to implement the get-filters command.
@@ -103,7 +117,16 @@ public:
      */
     virtual const char* description()
     {
-        return "Retrieve compact filters via a single Bitcoin network node. The distance between provided height and hash must be strictly less than 100.";
+        return "Retrieve compact filters via a single Bitcoin network node, or in parallel via a set of nodes. For a single node the distance between provided height and hash must be strictly less than 100. Filters retrieved in parallel are verified against the filter header checkpoints. Filters that no checkpoint commits to must be confirmed by the filter headers of two nodes other than the node that served them, and are otherwise reported as unverified.";
+    }
+
+    /**
+     * Determines if the command uses the network, and so the network log.
+     * @return  True if the command is a network command.
+     */
+    virtual bool requires_network()
+    {
+        return true;
     }
 
     /**
@@ -165,6 +188,21 @@ public:
             value<uint16_t>(&option_.port)->default_value(8333),
             "The IP port of the Bitcoin service on the node. Defaults to 8333, the standard for mainnet."
         )
+        (
+            "peers,n",
+            value<size_t>(&option_.peers)->default_value(0),
+            "The number of BIP157 nodes from the hosts file or seeds from which to retrieve filters in parallel. Zero retrieves from the single node specified by host and port, defaults to 0."
+        )
+        (
+            "start,s",
+            value<system::config::hash256>(&option_.start),
+            "The Base16 hash of the block at the provided height. Required when peers is nonzero."
+        )
+        (
+            "duration,d",
+            value<uint32_t>(&option_.duration)->default_value(600),
+            "The maximum duration of a parallel retrieval in seconds, defaults to 600."
+        )
         (
             "height",
             value<uint32_t>(&argument_.height),
@@ -283,6 +321,57 @@ public:
         option_.port = value;
     }
 
+    /**
+     * Get the value of the peers option.
+     */
+    virtual size_t& get_peers_option()
+    {
+        return option_.peers;
+    }
+
+    /**
+     * Set the value of the peers option.
+     */
+    virtual void set_peers_option(
+        const size_t& value)
+    {
+        option_.peers = value;
+    }
+
+    /**
+     * Get the value of the start option.
+     */
+    virtual system::config::hash256& get_start_option()
+    {
+        return option_.start;
+    }
+
+    /**
+     * Set the value of the start option.
+     */
+    virtual void set_start_option(
+        const system::config::hash256& value)
+    {
+        option_.start = value;
+    }
+
+    /**
+     * Get the value of the duration option.
+     */
+    virtual uint32_t& get_duration_option()
+    {
+        return option_.duration;
+    }
+
+    /**
+     * Set the value of the duration option.
+     */
+    virtual void set_duration_option(
+        const uint32_t& value)
+    {
+        option_.duration = value;
+    }
+
 private:
 
     /**
@@ -312,13 +401,19 @@ private:
         option()
           : format(),
             host(),
-            port()
+            port(),
+            peers(),
+            start(),
+            duration()
         {
         }
 
         explorer::config::encoding format;
         std::string host;
         uint16_t port;
+        size_t peers;
+        system::config::hash256 start;
+        uint32_t duration;
     } option_;
 };
 
@@ -59,6 +59,8 @@ namespace commands {
     "The seed is less than 128 bits long."
 #define BX_HD_NEW_INVALID_KEY \
     "The seed produced an invalid key."
+#define BX_HD_NEW_BIT_LENGTH_UNSUPPORTED \
+    "The bit length is not supported."
 
 /**
  * Class to implement the hd-new command.
@@ -135,6 +137,11 @@ public:
         po::variables_map& variables)
     {
         const auto raw = requires_raw_input();
+
+        // The input is not read in batch mode.
+        if (variables.find("count") != variables.end())
+            return;
+
         load_input(get_seed_argument(), "SEED", variables, input, raw);
     }
 
@@ -158,6 +165,16 @@ public:
             value<boost::filesystem::path>(),
             "The path to the configuration settings file."
         )
+        (
+            "count,n",
+            value<uint32_t>(&option_.count),
+            "If nonzero, generate this number of keys in parallel, one per line, each from new random entropy of the bit length. The seed is then neither used nor read from STDIN."
+        )
+        (
+            "bit_length,b",
+            value<uint16_t>(&option_.bit_length)->default_value(128),
+            "The length in bits of the entropy of each key generated by count. Must be divisible by 8 and must not be less than 128, defaults to 128."
+        )
         (
             "version,v",
             value<uint32_t>(&option_.version)->default_value(76066276),
@@ -195,6 +212,19 @@ public:
     virtual system::console_result invoke(std::ostream& output,
         std::ostream& cerr);
 
+    /**
+     * Evaluate the command with typed parameters and result, without
+     * program options parsing, stream formatting or exceptions.
+     * The parameters are the arguments and then the options, in order,
+     * excluding batch options, which are applied by invoke.
+     * @param[out]  result  The typed result of the command.
+     * @return              The outcome, which invoke maps to a message.
+     */
+    static evaluation evaluate(
+        system::wallet::hd_private& result,
+        const system::config::base16& seed,
+        const uint32_t& version);
+
     /* Properties */
 
     /**
@@ -214,6 +244,40 @@ public:
         argument_.seed = value;
     }
 
+    /**
+     * Get the value of the count option.
+     */
+    virtual uint32_t& get_count_option()
+    {
+        return option_.count;
+    }
+
+    /**
+     * Set the value of the count option.
+     */
+    virtual void set_count_option(
+        const uint32_t& value)
+    {
+        option_.count = value;
+    }
+
+    /**
+     * Get the value of the bit_length option.
+     */
+    virtual uint16_t& get_bit_length_option()
+    {
+        return option_.bit_length;
+    }
+
+    /**
+     * Set the value of the bit_length option.
+     */
+    virtual void set_bit_length_option(
+        const uint16_t& value)
+    {
+        option_.bit_length = value;
+    }
+
     /**
      * Get the value of the version option.
      */
@@ -256,10 +320,14 @@ private:
     struct option
     {
         option()
-          : version()
+          : count(),
+            bit_length(),
+            version()
         {
         }
 
+        uint32_t count;
+        uint16_t bit_length;
         uint32_t version;
     } option_;
 };
@@ -57,6 +57,8 @@ namespace commands {
  */
 #define BX_MNEMONIC_NEW_INVALID_SEED \
     "The seed length in bytes is not evenly divisible by 32 bits."
+#define BX_MNEMONIC_NEW_BIT_LENGTH_UNSUPPORTED \
+    "The bit length is not supported."
 
 /**
  * Class to implement the mnemonic-new command.
@@ -126,6 +128,11 @@ public:
         po::variables_map& variables)
     {
         const auto raw = requires_raw_input();
+
+        // The input is not read in batch mode.
+        if (variables.find("count") != variables.end())
+            return;
+
         load_input(get_seed_argument(), "SEED", variables, input, raw);
     }
 
@@ -149,6 +156,16 @@ public:
             value<boost::filesystem::path>(),
             "The path to the configuration settings file."
         )
+        (
+            "count,n",
+            value<uint32_t>(&option_.count),
+            "If nonzero, generate this number of mnemonics in parallel, one per line, each from new random entropy of the bit length. The seed is then neither used nor read from STDIN."
+        )
+        (
+            "bit_length,b",
+            value<uint16_t>(&option_.bit_length)->default_value(128),
+            "The length in bits of the entropy of each mnemonic generated by count. Must be divisible by 32, defaults to 128."
+        )
         (
             "language,l",
             value<explorer::config::language>(&option_.language),
@@ -199,6 +216,40 @@ public:
         argument_.seed = value;
     }
 
+    /**
+     * Get the value of the count option.
+     */
+    virtual uint32_t& get_count_option()
+    {
+        return option_.count;
+    }
+
+    /**
+     * Set the value of the count option.
+     */
+    virtual void set_count_option(
+        const uint32_t& value)
+    {
+        option_.count = value;
+    }
+
+    /**
+     * Get the value of the bit_length option.
+     */
+    virtual uint16_t& get_bit_length_option()
+    {
+        return option_.bit_length;
+    }
+
+    /**
+     * Set the value of the bit_length option.
+     */
+    virtual void set_bit_length_option(
+        const uint16_t& value)
+    {
+        option_.bit_length = value;
+    }
+
     /**
      * Get the value of the language option.
      */
@@ -241,10 +292,14 @@ private:
     struct option
     {
         option()
-          : language()
+          : count(),
+            bit_length(),
+            language()
         {
         }
 
+        uint32_t count;
+        uint16_t bit_length;
         explorer::config::language language;
     } option_;
 };
@@ -0,0 +1,282 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_PIPELINE_HPP
+#define BX_PIPELINE_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/program_options.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/command.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/generated.hpp>
+#include <bitcoin/explorer/config/address.hpp>
+#include <bitcoin/explorer/config/address_format.hpp>
+#include <bitcoin/explorer/config/algorithm.hpp>
+#include <bitcoin/explorer/config/btc.hpp>
+#include <bitcoin/explorer/config/byte.hpp>
+#include <bitcoin/explorer/config/cert_key.hpp>
+#include <bitcoin/explorer/config/ec_private.hpp>
+#include <bitcoin/explorer/config/electrum.hpp>
+#include <bitcoin/explorer/config/encoding.hpp>
+#include <bitcoin/explorer/config/endorsement.hpp>
+#include <bitcoin/explorer/config/hashtype.hpp>
+#include <bitcoin/explorer/config/hd_key.hpp>
+#include <bitcoin/explorer/config/language.hpp>
+#include <bitcoin/explorer/config/raw.hpp>
+#include <bitcoin/explorer/config/signature.hpp>
+#include <bitcoin/explorer/config/wrapper.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+/********* GENERATED SOURCE CODE, DO NOT EDIT EXCEPT EXPERIMENTALLY **********/
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+/**
+ * Various localizable strings.
+ */
+#define BX_PIPELINE_FILE_FAILURE \
+    "The file could not be read: %1%"
+#define BX_PIPELINE_STAGE_INVALID \
+    "The stage is not a valid command: %1%"
+#define BX_PIPELINE_STAGE_REQUIRED \
+    "At least one stage is required."
+
+/**
+ * Class to implement the pipeline command.
+ */
+class BCX_API pipeline
+  : public command
+{
+public:
+
+    /**
+     * The symbolic (not localizable) command name, lower case.
+     */
+    static const char* symbol()
+    {
+        return "pipeline";
+    }
+
+
+    /**
+     * Destructor.
+     */
+    virtual ~pipeline()
+    {
+    }
+
+    /**
+     * The member symbolic (not localizable) command name, lower case.
+     */
+    virtual const char* name()
+    {
+        return pipeline::symbol();
+    }
+
+    /**
+     * The localizable command category name, upper case.
+     */
+    virtual const char* category()
+    {
+        return "META";
+    }
+
+    /**
+     * The localizable command description.
+     */
+    virtual const char* description()
+    {
+        return "Run a pipeline of commands in one process, passing the output of each stage to the next as its input. Each stage is a command followed by its options and arguments, separated by spaces (for example 'hd-private -i 0'). Each stage runs on its own thread. The pipeline runs once for each line of the input file, or the specified number of times without input if there is no file.";
+    }
+
+    /**
+     * Load program argument definitions.
+     * A value of -1 indicates that the number of instances is unlimited.
+     * @return  The loaded program argument definitions.
+     */
+    virtual system::arguments_metadata& load_arguments()
+    {
+        return get_argument_metadata()
+            .add("STAGE", -1);
+    }
+
+    /**
+     * Load parameter fallbacks from file or input as appropriate.
+     * @param[in]  input  The input stream for loading the parameters.
+     * @param[in]         The loaded variables.
+     */
+    virtual void load_fallbacks(std::istream& input,
+        po::variables_map& variables)
+    {
+    }
+
+    /**
+     * Load program option definitions.
+     * BUGBUG: see boost bug/fix: svn.boost.org/trac/boost/ticket/8009
+     * @return  The loaded program option definitions.
+     */
+    virtual system::options_metadata& load_options()
+    {
+        using namespace po;
+        options_description& options = get_option_metadata();
+        options.add_options()
+        (
+            BX_HELP_VARIABLE ",h",
+            value<bool>()->zero_tokens(),
+            "Get a description and instructions for this command."
+        )
+        (
+            BX_CONFIG_VARIABLE ",c",
+            value<boost::filesystem::path>(),
+            "The path to the configuration settings file."
+        )
+        (
+            "count,n",
+            value<uint32_t>(&option_.count)->default_value(1),
+            "The number of times to run the pipeline when there is no input file, defaults to 1."
+        )
+        (
+            "file,f",
+            value<boost::filesystem::path>(&option_.file),
+            "The path to a file of first stage inputs, one per line, or '-' for STDIN."
+        )
+        (
+            "STAGE",
+            value<std::vector<std::string>>(&argument_.stages),
+            "The ordered set of pipeline stages."
+        );
+
+        return options;
+    }
+
+    /**
+     * Set variable defaults from configuration variable values.
+     * @param[in]  variables  The loaded variables.
+     */
+    virtual void set_defaults_from_config(po::variables_map& variables)
+    {
+    }
+
+    /**
+     * Invoke the command.
+     * @param[out]  output  The input stream for the command execution.
+     * @param[out]  error   The input stream for the command execution.
+     * @return              The appropriate console return code { -1, 0, 1 }.
+     */
+    virtual system::console_result invoke(std::ostream& output,
+        std::ostream& cerr);
+
+    /* Properties */
+
+    /**
+     * Get the value of the STAGE arguments.
+     */
+    virtual std::vector<std::string>& get_stages_argument()
+    {
+        return argument_.stages;
+    }
+
+    /**
+     * Set the value of the STAGE arguments.
+     */
+    virtual void set_stages_argument(
+        const std::vector<std::string>& value)
+    {
+        argument_.stages = value;
+    }
+
+    /**
+     * Get the value of the count option.
+     */
+    virtual uint32_t& get_count_option()
+    {
+        return option_.count;
+    }
+
+    /**
+     * Set the value of the count option.
+     */
+    virtual void set_count_option(
+        const uint32_t& value)
+    {
+        option_.count = value;
+    }
+
+    /**
+     * Get the value of the file option.
+     */
+    virtual boost::filesystem::path& get_file_option()
+    {
+        return option_.file;
+    }
+
+    /**
+     * Set the value of the file option.
+     */
+    virtual void set_file_option(
+        const boost::filesystem::path& value)
+    {
+        option_.file = value;
+    }
+
+private:
+
+    /**
+     * Command line argument bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct argument
+    {
+        argument()
+          : stages()
+        {
+        }
+
+        std::vector<std::string> stages;
+    } argument_;
+
+    /**
+     * Command line option bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct option
+    {
+        option()
+          : count(),
+            file()
+        {
+        }
+
+        uint32_t count;
+        boost::filesystem::path file;
+    } option_;
+};
+
+} // namespace commands
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
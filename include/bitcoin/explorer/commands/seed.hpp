@@ -146,6 +146,11 @@ public:
             value<boost::filesystem::path>(),
             "The path to the configuration settings file."
         )
+        (
+            "count,n",
+            value<uint32_t>(&option_.count),
+            "If nonzero, generate this number of seeds in parallel, one per line."
+        )
         (
             "bit_length,b",
             value<uint16_t>(&option_.bit_length)->default_value(192),
@@ -172,8 +177,37 @@ public:
     virtual system::console_result invoke(std::ostream& output,
         std::ostream& cerr);
 
+    /**
+     * Evaluate the command with typed parameters and result, without
+     * program options parsing, stream formatting or exceptions.
+     * The parameters are the arguments and then the options, in order,
+     * excluding batch options, which are applied by invoke.
+     * @param[out]  result  The typed result of the command.
+     * @return              The outcome, which invoke maps to a message.
+     */
+    static evaluation evaluate(
+        system::config::base16& result,
+        const uint16_t& bit_length);
+
     /* Properties */
 
+    /**
+     * Get the value of the count option.
+     */
+    virtual uint32_t& get_count_option()
+    {
+        return option_.count;
+    }
+
+    /**
+     * Set the value of the count option.
+     */
+    virtual void set_count_option(
+        const uint32_t& value)
+    {
+        option_.count = value;
+    }
+
     /**
      * Get the value of the bit_length option.
      */
@@ -214,10 +248,12 @@ private:
     struct option
     {
         option()
-          : bit_length()
+          : count(),
+            bit_length()
         {
         }
 
+        uint32_t count;
         uint16_t bit_length;
     } option_;
 };
@@ -0,0 +1,346 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_SELECT_UTXO_HPP
+#define BX_SELECT_UTXO_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/program_options.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/command.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/generated.hpp>
+#include <bitcoin/explorer/config/address.hpp>
+#include <bitcoin/explorer/config/address_format.hpp>
+#include <bitcoin/explorer/config/algorithm.hpp>
+#include <bitcoin/explorer/config/btc.hpp>
+#include <bitcoin/explorer/config/byte.hpp>
+#include <bitcoin/explorer/config/cert_key.hpp>
+#include <bitcoin/explorer/config/ec_private.hpp>
+#include <bitcoin/explorer/config/electrum.hpp>
+#include <bitcoin/explorer/config/encoding.hpp>
+#include <bitcoin/explorer/config/endorsement.hpp>
+#include <bitcoin/explorer/config/hashtype.hpp>
+#include <bitcoin/explorer/config/hd_key.hpp>
+#include <bitcoin/explorer/config/language.hpp>
+#include <bitcoin/explorer/config/raw.hpp>
+#include <bitcoin/explorer/config/signature.hpp>
+#include <bitcoin/explorer/config/wrapper.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+/********* GENERATED SOURCE CODE, DO NOT EDIT EXCEPT EXPERIMENTALLY **********/
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+/**
+ * Various localizable strings.
+ */
+#define BX_SELECT_UTXO_INSUFFICIENT \
+    "The unspent outputs of the keys are insufficient to pay %1% satoshi at the fee rate."
+#define BX_SELECT_UTXO_SATOSHI_REQUIRED \
+    "The amount must be greater than zero."
+#define BX_SELECT_UTXO_SNAPSHOT_INVALID \
+    "The snapshot file is not valid: %1%"
+#define BX_SELECT_UTXO_SNAPSHOT_WRITE_FAILURE \
+    "The snapshot file could not be written: %1%"
+#define BX_SELECT_UTXO_SUMMARY \
+    "Selected %1% satoshi in %2% outputs with a fee of %3% satoshi and change of %4% satoshi."
+
+/**
+ * Class to implement the select-utxo command.
+ */
+class BCX_API select_utxo
+  : public command
+{
+public:
+
+    /**
+     * The symbolic (not localizable) command name, lower case.
+     */
+    static const char* symbol()
+    {
+        return "select-utxo";
+    }
+
+
+    /**
+     * Destructor.
+     */
+    virtual ~select_utxo()
+    {
+    }
+
+    /**
+     * The member symbolic (not localizable) command name, lower case.
+     */
+    virtual const char* name()
+    {
+        return select_utxo::symbol();
+    }
+
+    /**
+     * The localizable command category name, upper case.
+     */
+    virtual const char* category()
+    {
+        return "ONLINE";
+    }
+
+    /**
+     * The localizable command description.
+     */
+    virtual const char* description()
+    {
+        return "Select unspent transaction outputs across a set of payments search keys to pay a number of satoshi at a fee rate, preferring a changeless selection found by branch-and-bound search. The selected points are written one per line as TXHASH:INDEX for use as tx-encode inputs. Requires a Libbitcoin server connection.";
+    }
+
+    /**
+     * Determines if the command uses the network, and so the network log.
+     * @return  True if the command is a network command.
+     */
+    virtual bool requires_network()
+    {
+        return true;
+    }
+
+    /**
+     * Load program argument definitions.
+     * A value of -1 indicates that the number of instances is unlimited.
+     * @return  The loaded program argument definitions.
+     */
+    virtual system::arguments_metadata& load_arguments()
+    {
+        return get_argument_metadata()
+            .add("SATOSHI", 1)
+            .add("KEY", -1);
+    }
+
+    /**
+     * Load parameter fallbacks from file or input as appropriate.
+     * @param[in]  input  The input stream for loading the parameters.
+     * @param[in]         The loaded variables.
+     */
+    virtual void load_fallbacks(std::istream& input,
+        po::variables_map& variables)
+    {
+        const auto raw = requires_raw_input();
+        load_input(get_keys_argument(), "KEY", variables, input, raw);
+    }
+
+    /**
+     * Load program option definitions.
+     * BUGBUG: see boost bug/fix: svn.boost.org/trac/boost/ticket/8009
+     * @return  The loaded program option definitions.
+     */
+    virtual system::options_metadata& load_options()
+    {
+        using namespace po;
+        options_description& options = get_option_metadata();
+        options.add_options()
+        (
+            BX_HELP_VARIABLE ",h",
+            value<bool>()->zero_tokens(),
+            "Get a description and instructions for this command."
+        )
+        (
+            BX_CONFIG_VARIABLE ",c",
+            value<boost::filesystem::path>(),
+            "The path to the configuration settings file."
+        )
+        (
+            "budget,b",
+            value<uint32_t>(&option_.budget)->default_value(100),
+            "The time budget in milliseconds for the changeless search, defaults to 100."
+        )
+        (
+            "fee_rate,r",
+            value<uint64_t>(&option_.fee_rate)->default_value(1),
+            "The fee rate in satoshi per virtual byte, defaults to 1."
+        )
+        (
+            "snapshot,s",
+            value<boost::filesystem::path>(&option_.snapshot),
+            "The path to an unspent output snapshot file. Keys present in the snapshot are not fetched, and keys that are fetched are added to the snapshot."
+        )
+        (
+            "SATOSHI",
+            value<uint64_t>(&argument_.satoshi)->required(),
+            "The whole number of satoshi to pay."
+        )
+        (
+            "KEY",
+            value<std::vector<system::config::hash256>>(&argument_.keys),
+            "The set of Base16 payments search keys. If not specified the keys are read from STDIN."
+        );
+
+        return options;
+    }
+
+    /**
+     * Set variable defaults from configuration variable values.
+     * @param[in]  variables  The loaded variables.
+     */
+    virtual void set_defaults_from_config(po::variables_map& variables)
+    {
+    }
+
+    /**
+     * Invoke the command.
+     * @param[out]  output  The input stream for the command execution.
+     * @param[out]  error   The input stream for the command execution.
+     * @return              The appropriate console return code { -1, 0, 1 }.
+     */
+    virtual system::console_result invoke(std::ostream& output,
+        std::ostream& cerr);
+
+    /* Properties */
+
+    /**
+     * Get the value of the SATOSHI argument.
+     */
+    virtual uint64_t& get_satoshi_argument()
+    {
+        return argument_.satoshi;
+    }
+
+    /**
+     * Set the value of the SATOSHI argument.
+     */
+    virtual void set_satoshi_argument(
+        const uint64_t& value)
+    {
+        argument_.satoshi = value;
+    }
+
+    /**
+     * Get the value of the KEY arguments.
+     */
+    virtual std::vector<system::config::hash256>& get_keys_argument()
+    {
+        return argument_.keys;
+    }
+
+    /**
+     * Set the value of the KEY arguments.
+     */
+    virtual void set_keys_argument(
+        const std::vector<system::config::hash256>& value)
+    {
+        argument_.keys = value;
+    }
+
+    /**
+     * Get the value of the budget option.
+     */
+    virtual uint32_t& get_budget_option()
+    {
+        return option_.budget;
+    }
+
+    /**
+     * Set the value of the budget option.
+     */
+    virtual void set_budget_option(
+        const uint32_t& value)
+    {
+        option_.budget = value;
+    }
+
+    /**
+     * Get the value of the fee_rate option.
+     */
+    virtual uint64_t& get_fee_rate_option()
+    {
+        return option_.fee_rate;
+    }
+
+    /**
+     * Set the value of the fee_rate option.
+     */
+    virtual void set_fee_rate_option(
+        const uint64_t& value)
+    {
+        option_.fee_rate = value;
+    }
+
+    /**
+     * Get the value of the snapshot option.
+     */
+    virtual boost::filesystem::path& get_snapshot_option()
+    {
+        return option_.snapshot;
+    }
+
+    /**
+     * Set the value of the snapshot option.
+     */
+    virtual void set_snapshot_option(
+        const boost::filesystem::path& value)
+    {
+        option_.snapshot = value;
+    }
+
+private:
+
+    /**
+     * Command line argument bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct argument
+    {
+        argument()
+          : satoshi(),
+            keys()
+        {
+        }
+
+        uint64_t satoshi;
+        std::vector<system::config::hash256> keys;
+    } argument_;
+
+    /**
+     * Command line option bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct option
+    {
+        option()
+          : budget(),
+            fee_rate(),
+            snapshot()
+        {
+        }
+
+        uint32_t budget;
+        uint64_t fee_rate;
+        boost::filesystem::path snapshot;
+    } option_;
+};
+
+} // namespace commands
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
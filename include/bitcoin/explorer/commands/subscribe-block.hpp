@@ -55,8 +55,16 @@ namespace commands {
 /**
  * Various localizable strings.
  */
+#define BX_SUBSCRIBE_BLOCK_ADDED \
+    "added %1% %2%:%3% %4% %5%"
+#define BX_SUBSCRIBE_BLOCK_CATCH_UP_FAILURE \
+    "Missed blocks could not be fetched: %1%"
 #define BX_SUBSCRIBE_BLOCK_FAILED \
     "Failed to subscribe to transaction service: %1%"
+#define BX_SUBSCRIBE_BLOCK_REMOVED \
+    "removed %1% %2%:%3% %4% %5%"
+#define BX_SUBSCRIBE_BLOCK_REORGANIZATION_DEPTH \
+    "The chain reorganized below the %1% retained blocks."
 
 /**
  * Class to implement the subscribe-block command.
@@ -106,6 +114,15 @@ public:
         return "Watch the network for all blocks. Requires a Libbitcoin server connection.";
     }
 
+    /**
+     * Determines if the command uses the network, and so the network log.
+     * @return  True if the command is a network command.
+     */
+    virtual bool requires_network()
+    {
+        return true;
+    }
+
     /**
      * Load program argument definitions.
      * A value of -1 indicates that the number of instances is unlimited.
@@ -147,16 +164,36 @@ public:
             value<boost::filesystem::path>(),
             "The path to the configuration settings file."
         )
+        (
+            "address,a",
+            value<std::vector<system::wallet::payment_address>>(&option_.addresses),
+            "A payment address to follow, with --follow. Multiple addresses may be specified."
+        )
+        (
+            "depth,n",
+            value<uint32_t>(&option_.depth)->default_value(144),
+            "The number of most recent blocks retained for reorganization, with --follow, defaults to 144."
+        )
         (
             "duration,d",
             value<uint32_t>(&option_.duration)->default_value(600),
             "The duration of the subscription in seconds, defaults to 600."
         )
+        (
+            "follow,w",
+            value<bool>(&option_.follow)->zero_tokens(),
+            "Follow the chain from the server top and write a line for each output paying a followed address or key as it is added to or removed from the unspent outputs, including by reorganization. The outputs unspent at the server top are fetched when following starts, so that their spends are reported. Blocks missed while disconnected are fetched when the next block is received."
+        )
         (
             "format,f",
             value<explorer::config::encoding>(&option_.format),
             "The output format. Options are 'info', 'json' and 'xml', defaults to 'info'."
         )
+        (
+            "key,k",
+            value<std::vector<system::wallet::ec_public>>(&option_.keys),
+            "A Base16 EC public key to follow, as its pay to key hash address, with --follow. Multiple keys may be specified."
+        )
         (
             "server-url",
             value<std::string>(&argument_.server_url),
@@ -202,6 +239,40 @@ public:
         argument_.server_url = value;
     }
 
+    /**
+     * Get the value of the address options.
+     */
+    virtual std::vector<system::wallet::payment_address>& get_addresses_option()
+    {
+        return option_.addresses;
+    }
+
+    /**
+     * Set the value of the address options.
+     */
+    virtual void set_addresses_option(
+        const std::vector<system::wallet::payment_address>& value)
+    {
+        option_.addresses = value;
+    }
+
+    /**
+     * Get the value of the depth option.
+     */
+    virtual uint32_t& get_depth_option()
+    {
+        return option_.depth;
+    }
+
+    /**
+     * Set the value of the depth option.
+     */
+    virtual void set_depth_option(
+        const uint32_t& value)
+    {
+        option_.depth = value;
+    }
+
     /**
      * Get the value of the duration option.
      */
@@ -219,6 +290,23 @@ public:
         option_.duration = value;
     }
 
+    /**
+     * Get the value of the follow option.
+     */
+    virtual bool& get_follow_option()
+    {
+        return option_.follow;
+    }
+
+    /**
+     * Set the value of the follow option.
+     */
+    virtual void set_follow_option(
+        const bool& value)
+    {
+        option_.follow = value;
+    }
+
     /**
      * Get the value of the format option.
      */
@@ -236,6 +324,23 @@ public:
         option_.format = value;
     }
 
+    /**
+     * Get the value of the key options.
+     */
+    virtual std::vector<system::wallet::ec_public>& get_keys_option()
+    {
+        return option_.keys;
+    }
+
+    /**
+     * Set the value of the key options.
+     */
+    virtual void set_keys_option(
+        const std::vector<system::wallet::ec_public>& value)
+    {
+        option_.keys = value;
+    }
+
 private:
 
     /**
@@ -261,13 +366,21 @@ private:
     struct option
     {
         option()
-          : duration(),
-            format()
+          : addresses(),
+            depth(),
+            duration(),
+            follow(),
+            format(),
+            keys()
         {
         }
 
+        std::vector<system::wallet::payment_address> addresses;
+        uint32_t depth;
         uint32_t duration;
+        bool follow;
         explorer::config::encoding format;
+        std::vector<system::wallet::ec_public> keys;
     } option_;
 };
 
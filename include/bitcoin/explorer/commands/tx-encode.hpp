@@ -57,8 +57,20 @@ namespace commands {
  */
 #define BX_TX_ENCODE_INVALID_OUTPUT \
     "An output is not valid."
+#define BX_TX_ENCODE_INVALID_RECORD \
+    "The record on line %1% of the file is not valid."
+#define BX_TX_ENCODE_FILE_FAILURE \
+    "The file could not be read: %1%"
 #define BX_TX_ENCODE_LOCKTIME_CONFLICT \
     "The specified lock time is ineffective because all sequences are set to the maximum value."
+#define BX_TX_ENCODE_SPLIT_INSUFFICIENT \
+    "The inputs are insufficient to fund the outputs at the fee rate."
+#define BX_TX_ENCODE_SPLIT_OVERWEIGHT \
+    "An output does not fit in a transaction under the weight limit."
+#define BX_TX_ENCODE_SPLIT_REQUIREMENTS \
+    "Splitting requires a change address and the value of every input."
+#define BX_TX_ENCODE_SPLIT_UNUSED \
+    "The inputs from input %1% are not required to fund the outputs."
 
 /**
  * Class to implement the tx-encode command.
@@ -172,6 +184,26 @@ public:
             "output,o",
             value<std::vector<system::config::output>>(&option_.outputs),
             "The set of transaction output data encoded as TARGET:SATOSHI:SEED. TARGET is an address (including stealth or pay-to-script-hash) or a Base16 script. SATOSHI is the 64 bit spend amount in satoshi. SEED is required for stealth outputs and not used otherwise. The same seed should NOT be used for multiple outputs."
+        )
+        (
+            "file,f",
+            value<boost::filesystem::path>(&option_.file),
+            "The path to a file of comma separated records, one per line, or '-' for STDIN. An 'input,TXHASH:INDEX:SEQUENCE,SATOSHI' record adds an input, where SATOSHI is the value of the spent output and is required only for splitting. A 'TARGET,SATOSHI,SEED' record, optionally prefixed with 'output,', adds an output. Blank lines and lines starting with '#' are ignored. Records follow any input and output options."
+        )
+        (
+            "max_weight,m",
+            value<uint32_t>(&option_.max_weight)->default_value(0),
+            "The weight limit of each transaction. If nonzero the outputs are split in order across as many transactions as required, each funded by the next inputs in order and paying any change to the change address. Defaults to zero (no splitting)."
+        )
+        (
+            "change,g",
+            value<system::wallet::payment_address>(&option_.change),
+            "The payment address for the change of each split transaction."
+        )
+        (
+            "fee_rate,r",
+            value<uint64_t>(&option_.fee_rate)->default_value(1),
+            "The fee rate in satoshi per virtual byte of each split transaction, defaults to 1."
         );
 
         return options;
@@ -294,6 +326,74 @@ public:
         option_.outputs = value;
     }
 
+    /**
+     * Get the value of the file option.
+     */
+    virtual boost::filesystem::path& get_file_option()
+    {
+        return option_.file;
+    }
+
+    /**
+     * Set the value of the file option.
+     */
+    virtual void set_file_option(
+        const boost::filesystem::path& value)
+    {
+        option_.file = value;
+    }
+
+    /**
+     * Get the value of the max_weight option.
+     */
+    virtual uint32_t& get_max_weight_option()
+    {
+        return option_.max_weight;
+    }
+
+    /**
+     * Set the value of the max_weight option.
+     */
+    virtual void set_max_weight_option(
+        const uint32_t& value)
+    {
+        option_.max_weight = value;
+    }
+
+    /**
+     * Get the value of the change option.
+     */
+    virtual system::wallet::payment_address& get_change_option()
+    {
+        return option_.change;
+    }
+
+    /**
+     * Set the value of the change option.
+     */
+    virtual void set_change_option(
+        const system::wallet::payment_address& value)
+    {
+        option_.change = value;
+    }
+
+    /**
+     * Get the value of the fee_rate option.
+     */
+    virtual uint64_t& get_fee_rate_option()
+    {
+        return option_.fee_rate;
+    }
+
+    /**
+     * Set the value of the fee_rate option.
+     */
+    virtual void set_fee_rate_option(
+        const uint64_t& value)
+    {
+        option_.fee_rate = value;
+    }
+
 private:
 
     /**
@@ -321,7 +421,11 @@ private:
             lock_time(),
             version(),
             inputs(),
-            outputs()
+            outputs(),
+            file(),
+            max_weight(),
+            change(),
+            fee_rate()
         {
         }
 
@@ -330,6 +434,10 @@ private:
         uint32_t version;
         std::vector<system::config::input> inputs;
         std::vector<system::config::output> outputs;
+        boost::filesystem::path file;
+        uint32_t max_weight;
+        system::wallet::payment_address change;
+        uint64_t fee_rate;
     } option_;
 };
 
@@ -57,6 +57,12 @@ namespace commands {
  */
 #define BX_WATCH_KEY_WAITING \
     "Watching key: %1%..."
+#define BX_WATCH_KEY_REMOVED \
+    "Removed key: %1%"
+#define BX_WATCH_KEY_INVALID_COMMAND \
+    "Invalid pipe command: %1%"
+#define BX_WATCH_KEY_PIPE_FAILURE \
+    "Failed to open pipe: %1%"
 
 /**
  * Class to implement the watch-key command.
@@ -113,6 +119,15 @@ public:
         return "Watch the network for transactions in which a payment key participates. Requires a Libbitcoin server connection.";
     }
 
+    /**
+     * Determines if the command uses the network, and so the network log.
+     * @return  True if the command is a network command.
+     */
+    virtual bool requires_network()
+    {
+        return true;
+    }
+
     /**
      * Load program argument definitions.
      * A value of -1 indicates that the number of instances is unlimited.
@@ -121,7 +136,7 @@ public:
     virtual system::arguments_metadata& load_arguments()
     {
         return get_argument_metadata()
-            .add("hash", 1);
+            .add("KEY", -1);
     }
 
     /**
@@ -133,7 +148,7 @@ public:
         po::variables_map& variables)
     {
         const auto raw = requires_raw_input();
-        load_input(get_hash_argument(), "hash", variables, input, raw);
+        load_input(get_keys_argument(), "KEY", variables, input, raw);
     }
 
     /**
@@ -162,9 +177,19 @@ public:
             "The duration of the watch in seconds, defaults to 600."
         )
         (
-            "hash",
-            value<system::config::hash256>(&argument_.hash),
-            "The Base16 payments search key. If not specified the address is read from STDIN."
+            "renew,r",
+            value<uint32_t>(&option_.renew)->default_value(300),
+            "The interval in seconds at which all subscriptions are renewed, defaults to 300. Zero disables renewal."
+        )
+        (
+            "pipe,p",
+            value<boost::filesystem::path>(&option_.pipe),
+            "The path to a named pipe for changing the watched key set at runtime. Each line is a Base16 payments search key prefixed with '+' to add or '-' to remove the key."
+        )
+        (
+            "KEY",
+            value<std::vector<system::config::hash256>>(&argument_.keys),
+            "The set of Base16 payments search keys. If not specified the keys are read from STDIN."
         );
 
         return options;
@@ -190,20 +215,20 @@ public:
     /* Properties */
 
     /**
-     * Get the value of the hash argument.
+     * Get the value of the KEY arguments.
      */
-    virtual system::config::hash256& get_hash_argument()
+    virtual std::vector<system::config::hash256>& get_keys_argument()
     {
-        return argument_.hash;
+        return argument_.keys;
     }
 
     /**
-     * Set the value of the hash argument.
+     * Set the value of the KEY arguments.
      */
-    virtual void set_hash_argument(
-        const system::config::hash256& value)
+    virtual void set_keys_argument(
+        const std::vector<system::config::hash256>& value)
     {
-        argument_.hash = value;
+        argument_.keys = value;
     }
 
     /**
@@ -223,6 +248,40 @@ public:
         option_.duration = value;
     }
 
+    /**
+     * Get the value of the renew option.
+     */
+    virtual uint32_t& get_renew_option()
+    {
+        return option_.renew;
+    }
+
+    /**
+     * Set the value of the renew option.
+     */
+    virtual void set_renew_option(
+        const uint32_t& value)
+    {
+        option_.renew = value;
+    }
+
+    /**
+     * Get the value of the pipe option.
+     */
+    virtual boost::filesystem::path& get_pipe_option()
+    {
+        return option_.pipe;
+    }
+
+    /**
+     * Set the value of the pipe option.
+     */
+    virtual void set_pipe_option(
+        const boost::filesystem::path& value)
+    {
+        option_.pipe = value;
+    }
+
 private:
 
     /**
@@ -233,11 +292,11 @@ private:
     struct argument
     {
         argument()
-          : hash()
+          : keys()
         {
         }
 
-        system::config::hash256 hash;
+        std::vector<system::config::hash256> keys;
     } argument_;
 
     /**
@@ -248,11 +307,15 @@ private:
     struct option
     {
         option()
-          : duration()
+          : duration(),
+            renew(),
+            pipe()
         {
         }
 
         uint32_t duration;
+        uint32_t renew;
+        boost::filesystem::path pipe;
     } option_;
 };
 
@@ -57,8 +57,6 @@ namespace commands {
  */
 #define BX_WATCH_TX_WAITING \
     "Watching transaction: %1%..."
-#define BX_WATCH_TX_NOT_IMPLEMENTED \
-    "This command is not yet implemented."
 
 /**
  * Class to implement the watch-tx command.
@@ -112,7 +110,16 @@ public:
      */
     virtual const char* description()
     {
-        return "Watch the network for a transaction by hash. Requires a Libbitcoin server connection.";
+        return "Watch the blockchain for the confirmation and reorganization of a set of transactions by hash. Requires a Libbitcoin server connection.";
+    }
+
+    /**
+     * Determines if the command uses the network, and so the network log.
+     * @return  True if the command is a network command.
+     */
+    virtual bool requires_network()
+    {
+        return true;
     }
 
     /**
@@ -123,7 +130,7 @@ public:
     virtual system::arguments_metadata& load_arguments()
     {
         return get_argument_metadata()
-            .add("HASH", 1);
+            .add("HASH", -1);
     }
 
     /**
@@ -135,7 +142,7 @@ public:
         po::variables_map& variables)
     {
         const auto raw = requires_raw_input();
-        load_input(get_hash_argument(), "HASH", variables, input, raw);
+        load_input(get_hashes_argument(), "HASH", variables, input, raw);
     }
 
     /**
@@ -163,10 +170,20 @@ public:
             value<explorer::config::encoding>(&option_.format),
             "The output format. Options are 'info', 'json' and 'xml', defaults to 'info'."
         )
+        (
+            "duration,d",
+            value<uint32_t>(&option_.duration)->default_value(600),
+            "The duration of the watch in seconds, defaults to 600."
+        )
+        (
+            "interval,i",
+            value<uint32_t>(&option_.interval)->default_value(10),
+            "The interval in seconds at which the chain tip is polled, defaults to 10."
+        )
         (
             "HASH",
-            value<system::config::hash256>(&argument_.hash),
-            "The Base16 transaction hash to watch. If not specified the hash is read from STDIN."
+            value<std::vector<system::config::hash256>>(&argument_.hashes),
+            "The set of Base16 transaction hashes to watch. If not specified the hashes are read from STDIN."
         );
 
         return options;
@@ -192,20 +209,20 @@ public:
     /* Properties */
 
     /**
-     * Get the value of the HASH argument.
+     * Get the value of the HASH arguments.
      */
-    virtual system::config::hash256& get_hash_argument()
+    virtual std::vector<system::config::hash256>& get_hashes_argument()
     {
-        return argument_.hash;
+        return argument_.hashes;
     }
 
     /**
-     * Set the value of the HASH argument.
+     * Set the value of the HASH arguments.
      */
-    virtual void set_hash_argument(
-        const system::config::hash256& value)
+    virtual void set_hashes_argument(
+        const std::vector<system::config::hash256>& value)
     {
-        argument_.hash = value;
+        argument_.hashes = value;
     }
 
     /**
@@ -225,6 +242,40 @@ public:
         option_.format = value;
     }
 
+    /**
+     * Get the value of the duration option.
+     */
+    virtual uint32_t& get_duration_option()
+    {
+        return option_.duration;
+    }
+
+    /**
+     * Set the value of the duration option.
+     */
+    virtual void set_duration_option(
+        const uint32_t& value)
+    {
+        option_.duration = value;
+    }
+
+    /**
+     * Get the value of the interval option.
+     */
+    virtual uint32_t& get_interval_option()
+    {
+        return option_.interval;
+    }
+
+    /**
+     * Set the value of the interval option.
+     */
+    virtual void set_interval_option(
+        const uint32_t& value)
+    {
+        option_.interval = value;
+    }
+
 private:
 
     /**
@@ -235,11 +286,11 @@ private:
     struct argument
     {
         argument()
-          : hash()
+          : hashes()
         {
         }
 
-        system::config::hash256 hash;
+        std::vector<system::config::hash256> hashes;
     } argument_;
 
     /**
@@ -250,11 +301,15 @@ private:
     struct option
     {
         option()
-          : format()
+          : format(),
+            duration(),
+            interval()
         {
         }
 
         explorer::config::encoding format;
+        uint32_t duration;
+        uint32_t interval;
     } option_;
 };
 
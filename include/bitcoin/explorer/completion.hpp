@@ -0,0 +1,67 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_COMPLETION_HPP
+#define BX_COMPLETION_HPP
+
+#include <future>
+#include <mutex>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * The completion of a network command, which is raced by the network and
+ * the console stop signal. The first result to complete the command wins.
+ */
+class BCX_API completion
+{
+public:
+    /**
+     * Construct an incomplete instance.
+     */
+    completion();
+
+    /**
+     * Complete with the result, if not already completed.
+     * @param[in]  ec  The result.
+     */
+    void stop(const system::code& ec);
+
+    /**
+     * Reset completion, so that the command may be invoked again in process.
+     */
+    void restart();
+
+    /**
+     * Get the future of the result, once for each restart.
+     */
+    std::future<system::code> get_future();
+
+private:
+    std::mutex mutex_;
+    std::promise<system::code> complete_;
+    bool completed_;
+};
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
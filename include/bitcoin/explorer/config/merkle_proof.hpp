@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_MERKLE_PROOF_HPP
+#define BX_MERKLE_PROOF_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace config {
+
+/**
+ * Serialization helper to convert between a merkle proof of transaction
+ * inclusion and its text form, 'HEIGHT:INDEX:TXID[:BRANCH]...'. The branch
+ * is the sibling of each level of the merkle tree, from the leaf level up.
+ */
+class BCX_API merkle_proof
+{
+public:
+
+    /**
+     * Default constructor.
+     */
+    merkle_proof();
+
+    /**
+     * Initialization constructor.
+     * @param[in]  text  The value to initialize with.
+     */
+    merkle_proof(const std::string& text);
+
+    /**
+     * Initialization constructor.
+     * @param[in]  height  The height of the block.
+     * @param[in]  index   The position of the transaction in the block.
+     * @param[in]  hash    The transaction hash.
+     * @param[in]  branch  The merkle branch of the transaction.
+     */
+    merkle_proof(uint32_t height, uint32_t index,
+        const system::hash_digest& hash, const system::hash_list& branch);
+
+    /**
+     * Copy constructor.
+     * @param[in]  other  The object to copy into self on construct.
+     */
+    merkle_proof(const merkle_proof& other);
+
+    /**
+     * The height of the block.
+     */
+    uint32_t height() const;
+
+    /**
+     * The position of the transaction in the block.
+     */
+    uint32_t index() const;
+
+    /**
+     * The transaction hash.
+     */
+    const system::hash_digest& hash() const;
+
+    /**
+     * The merkle branch of the transaction.
+     */
+    const system::hash_list& branch() const;
+
+    /**
+     * Overload stream in. Throws if input is invalid.
+     * @param[in]   input     The input stream to read the value from.
+     * @param[out]  argument  The object to receive the read value.
+     * @return                The input stream reference.
+     */
+    friend std::istream& operator>>(std::istream& input,
+        merkle_proof& argument);
+
+    /**
+     * Overload stream out.
+     * @param[in]   output    The output stream to write the value to.
+     * @param[out]  argument  The object from which to obtain the value.
+     * @return                The output stream reference.
+     */
+    friend std::ostream& operator<<(std::ostream& output,
+        const merkle_proof& argument);
+
+private:
+
+    /**
+     * The state of this object.
+     */
+    uint32_t height_;
+    uint32_t index_;
+    system::hash_digest hash_;
+    system::hash_list branch_;
+};
+
+} // namespace explorer
+} // namespace config
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,81 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_DECODED_ADDRESS_HPP
+#define BX_DECODED_ADDRESS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * The hash of a payment or witness address, in a fixed size buffer so that
+ * a batch of Base58Check addresses is decoded without allocation.
+ */
+struct BCX_API decoded_address
+{
+    /// True for a script hash (P2SH or P2WSH), false for a key hash.
+    bool script;
+
+    /// True for a version zero witness (bech32) address.
+    bool witness;
+
+    /// The size of the hash, 20 or 32 bytes.
+    size_t size;
+
+    /// The hash, in its first size bytes.
+    system::hash_digest hash;
+};
+
+/**
+ * Get the bech32 prefix of the witness addresses of the network of the
+ * message header identifier. An unknown identifier is taken to be mainnet.
+ * @param[in]  identifier  The network identifier (magic).
+ * @return                 The prefix.
+ */
+BCX_API std::string witness_prefix(uint32_t identifier);
+
+/**
+ * Decode and validate a Base58Check payment address of either version, or
+ * a version zero witness address of the prefix.
+ * @param[out] out           The decoded address.
+ * @param[in]  text          The address.
+ * @param[in]  p2kh_version  The version of a pay to key hash address.
+ * @param[in]  p2sh_version  The version of a pay to script hash address.
+ * @param[in]  prefix        The bech32 prefix of a witness address.
+ * @return                   True if the address is valid.
+ */
+BCX_API bool decode_address(decoded_address& out, const std::string& text,
+    uint8_t p2kh_version, uint8_t p2sh_version, const std::string& prefix);
+
+/**
+ * The payments search key of the address, the SHA256 of its output script.
+ * @param[in]  address  The decoded address.
+ * @return              The key.
+ */
+BCX_API system::hash_digest payments_key(const decoded_address& address);
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
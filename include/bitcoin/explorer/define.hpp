@@ -63,6 +63,12 @@
  */
 #define BX_ENVIRONMENT_VARIABLE_PREFIX "BX_"
 
+/**
+ * Environment variable for the socket path of a local bx agent, which takes
+ * precedence over the server.agent setting.
+ */
+#define BX_AGENT_VARIABLE "BX_AGENT"
+
 /**
  * Conventional command line argument sentinel for indicating that a file
  * should be read from STDIN or written to STDOUT.
@@ -97,6 +103,20 @@ BC_CONSTEXPR size_t minimum_seed_bits = 128;
  */
 BC_CONSTEXPR size_t minimum_seed_size = minimum_seed_bits / bc::byte_bits;
 
+/**
+ * The outcome of the typed evaluation of a command.
+ */
+enum class evaluation
+{
+    okay,
+    invalid_key,
+    invalid_version,
+    hard_option_conflict,
+    short_seed,
+    unsupported_length,
+    no_entropy
+};
+
 /**
  * Suppported output encoding engines.
  */
@@ -23,10 +23,12 @@
 #include <memory>
 #include <string>
 #include <bitcoin/explorer/command.hpp>
+#include <bitcoin/explorer/commands/address-batch.hpp>
 #include <bitcoin/explorer/commands/address-decode.hpp>
 #include <bitcoin/explorer/commands/address-embed.hpp>
 #include <bitcoin/explorer/commands/address-encode.hpp>
 #include <bitcoin/explorer/commands/address-to-key.hpp>
+#include <bitcoin/explorer/commands/agent.hpp>
 #include <bitcoin/explorer/commands/base16-decode.hpp>
 #include <bitcoin/explorer/commands/base16-encode.hpp>
 #include <bitcoin/explorer/commands/base58-decode.hpp>
@@ -41,6 +43,7 @@
 #include <bitcoin/explorer/commands/btc-to-satoshi.hpp>
 #include <bitcoin/explorer/commands/cert-new.hpp>
 #include <bitcoin/explorer/commands/cert-public.hpp>
+#include <bitcoin/explorer/commands/compute-filters.hpp>
 #include <bitcoin/explorer/commands/ec-add.hpp>
 #include <bitcoin/explorer/commands/ec-add-secrets.hpp>
 #include <bitcoin/explorer/commands/ec-decompress.hpp>
@@ -61,10 +64,12 @@
 #include <bitcoin/explorer/commands/ek-to-ec.hpp>
 #include <bitcoin/explorer/commands/electrum-new.hpp>
 #include <bitcoin/explorer/commands/electrum-to-seed.hpp>
+#include <bitcoin/explorer/commands/export-blocks.hpp>
 #include <bitcoin/explorer/commands/fetch-balance.hpp>
 #include <bitcoin/explorer/commands/fetch-block.hpp>
 #include <bitcoin/explorer/commands/fetch-block-hashes.hpp>
 #include <bitcoin/explorer/commands/fetch-block-height.hpp>
+#include <bitcoin/explorer/commands/fetch-block-txs.hpp>
 #include <bitcoin/explorer/commands/fetch-filter.hpp>
 #include <bitcoin/explorer/commands/fetch-filter-checkpoint.hpp>
 #include <bitcoin/explorer/commands/fetch-filter-headers.hpp>
@@ -75,6 +80,7 @@
 #include <bitcoin/explorer/commands/fetch-tx.hpp>
 #include <bitcoin/explorer/commands/fetch-tx-index.hpp>
 #include <bitcoin/explorer/commands/fetch-utxo.hpp>
+#include <bitcoin/explorer/commands/fetch-wallet.hpp>
 #include <bitcoin/explorer/commands/get-filter-checkpoint.hpp>
 #include <bitcoin/explorer/commands/get-filter-headers.hpp>
 #include <bitcoin/explorer/commands/get-filters.hpp>
@@ -85,18 +91,23 @@
 #include <bitcoin/explorer/commands/hd-to-ec.hpp>
 #include <bitcoin/explorer/commands/hd-to-public.hpp>
 #include <bitcoin/explorer/commands/hd-to-wif.hpp>
+#include <bitcoin/explorer/commands/header-sync.hpp>
 #include <bitcoin/explorer/commands/help.hpp>
 #include <bitcoin/explorer/commands/input-set.hpp>
 #include <bitcoin/explorer/commands/input-sign.hpp>
 #include <bitcoin/explorer/commands/input-validate.hpp>
 #include <bitcoin/explorer/commands/match-neutrino-address.hpp>
 #include <bitcoin/explorer/commands/match-neutrino-script.hpp>
+#include <bitcoin/explorer/commands/merkle-branch.hpp>
+#include <bitcoin/explorer/commands/merkle-verify.hpp>
+#include <bitcoin/explorer/commands/message-batch.hpp>
 #include <bitcoin/explorer/commands/message-sign.hpp>
 #include <bitcoin/explorer/commands/message-validate.hpp>
 #include <bitcoin/explorer/commands/mnemonic-decode.hpp>
 #include <bitcoin/explorer/commands/mnemonic-encode.hpp>
 #include <bitcoin/explorer/commands/mnemonic-new.hpp>
 #include <bitcoin/explorer/commands/mnemonic-to-seed.hpp>
+#include <bitcoin/explorer/commands/pipeline.hpp>
 #include <bitcoin/explorer/commands/put-tx.hpp>
 #include <bitcoin/explorer/commands/qrcode.hpp>
 #include <bitcoin/explorer/commands/ripemd160.hpp>
@@ -106,6 +117,7 @@
 #include <bitcoin/explorer/commands/script-to-address.hpp>
 #include <bitcoin/explorer/commands/script-to-key.hpp>
 #include <bitcoin/explorer/commands/seed.hpp>
+#include <bitcoin/explorer/commands/select-utxo.hpp>
 #include <bitcoin/explorer/commands/send-tx.hpp>
 #include <bitcoin/explorer/commands/settings.hpp>
 #include <bitcoin/explorer/commands/sha160.hpp>
@@ -155,6 +167,8 @@ namespace explorer {
     "Could not connect to server: %1%"
 #define BX_DEPRECATED_COMMAND \
     "The '%1%' command has been replaced by '%2%'."
+#define BX_ENTROPY_UNAVAILABLE \
+    "Entropy could not be obtained from the operating system."
 #define BX_HELP_DESCRIPTION \
     "Get a description and instructions for this command."
 #define BX_INVALID_COMMAND \
@@ -171,6 +185,8 @@ namespace explorer {
     "Usage: %1% %2% %3%"
 #define BX_PRINTER_VALUE_TEXT \
     "VALUE"
+#define BX_RELAY_REPORT \
+    "Requests: %1%, answered: %2%, hedged: %3%, hedge wins: %4%, timed out: %5%, latency p50/p90/p99: %6%/%7%/%8% ms."
 #define BX_VERSION_MESSAGE \
     "Version: %1%"
 
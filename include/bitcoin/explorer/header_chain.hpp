@@ -0,0 +1,184 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_HEADER_CHAIN_HPP
+#define BX_HEADER_CHAIN_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * A local chain of block headers, stored as a file of fixed size wire
+ * encoded records in order of height. The file is memory mapped for reading,
+ * so a header is obtained by height without a search.
+ */
+class BCX_API header_chain
+{
+public:
+    /**
+     * The size of a header record.
+     */
+    static const size_t record_size = 80;
+
+    /**
+     * The depth below the top of the chain at which a header is confirmed,
+     * as a header above it may be reorganized since the chain was written.
+     */
+    static const size_t confirmation_depth = 144;
+
+    /**
+     * The rules of a network that determine the work required of a header.
+     */
+    struct work_rules
+    {
+        /// The proof of work limit, in compact form.
+        uint32_t limit;
+
+        /// False if the work required is never retargeted (regtest).
+        bool retarget;
+
+        /// True if a header late by twice the spacing may be of the limit.
+        bool easy_blocks;
+
+        /// The hash of the genesis header.
+        system::hash_digest genesis;
+    };
+
+    /**
+     * The state of the chain that determines the work required of the
+     * header at its height.
+     */
+    struct work_state
+    {
+        /// The height of the header.
+        size_t height;
+
+        /// The bits of the preceding header.
+        uint32_t bits;
+
+        /// The bits of the last header of the period not of the limit.
+        uint32_t last_bits;
+
+        /// The timestamp of the preceding header.
+        uint32_t time;
+
+        /// The timestamp of the first header of the preceding period.
+        uint32_t period_time;
+    };
+
+    /**
+     * Get the work rules of the network of the message header identifier.
+     * An unknown identifier is taken to be mainnet.
+     * @param[in]  identifier  The network identifier (magic).
+     */
+    static work_rules rules(uint32_t identifier);
+
+    /**
+     * Get the work required of a header.
+     * @param[in]  rules  The work rules of the network.
+     * @param[in]  state  The state of the chain at the header.
+     * @param[in]  time   The timestamp of the header.
+     * @return            The required bits, in compact form.
+     */
+    static uint32_t work_required(const work_rules& rules,
+        const work_state& state, uint32_t time);
+
+    /**
+     * Construct a header chain over the file, which is not opened.
+     * @param[in]  file  The path of the header file.
+     */
+    header_chain(const boost::filesystem::path& file);
+
+    /**
+     * Map the header file for reading.
+     * @return  True if the file exists and is mapped, false if not.
+     */
+    bool open();
+
+    /**
+     * Unmap the header file.
+     */
+    void close();
+
+    /**
+     * The number of headers, one more than the height of the top header.
+     */
+    size_t size() const;
+
+    /**
+     * Get the header at the height.
+     * @param[out] out     The header.
+     * @param[in]  height  The height of the header.
+     * @return             True if the chain is open and has the height.
+     */
+    bool get(system::chain::header& out, size_t height) const;
+
+    /**
+     * Get the header at the height if it is confirmed in the chain.
+     * @param[out] out     The header.
+     * @param[in]  height  The height of the header.
+     * @return             True if the chain is open and the header is at
+     *                     least the confirmation depth below its top.
+     */
+    bool get_confirmed(system::chain::header& out, size_t height) const;
+
+    /**
+     * Get the state of the chain at the height, from the headers below it.
+     * @param[out] out     The state.
+     * @param[in]  rules   The work rules of the network.
+     * @param[in]  height  The height, at most the size of the chain.
+     * @return             True if the chain is open and has the headers.
+     */
+    bool get_state(work_state& out, const work_rules& rules,
+        size_t height) const;
+
+    /**
+     * Verify the work required of each header in order, and then its proof
+     * of work and link to the preceding header in parallel chunks. A header
+     * at height zero must instead be the genesis header of the network.
+     * @param[in]  headers   The headers, in order of height.
+     * @param[in]  previous  The hash of the header preceding the first.
+     * @param[in]  rules     The work rules of the network.
+     * @param[in]  state     The state at the first header, advanced past
+     *                       the headers of the required work.
+     * @return               The index of the first invalid header, or the
+     *                       number of headers if all are valid.
+     */
+    static size_t verify(const system::chain::header::list& headers,
+        const system::hash_digest& previous, const work_rules& rules,
+        work_state& state);
+
+private:
+    const boost::filesystem::path file_;
+    std::unique_ptr<boost::interprocess::file_mapping> mapping_;
+    std::unique_ptr<boost::interprocess::mapped_region> region_;
+};
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -20,6 +20,7 @@
 #define BX_PROPERTY_TREE_IPP
 
 #include <string>
+#include <utility>
 #include <boost/property_tree/ptree.hpp>
 #include <bitcoin/explorer/define.hpp>
 
@@ -27,20 +28,35 @@ namespace libbitcoin {
 namespace explorer {
 namespace config {
 
+// Children are appended empty and then filled or swapped into place, as
+// boost::property_tree has no move semantics and would otherwise deep copy
+// each element (and all of its descendants) into the parent.
+
+inline pt::ptree& emplace_child(pt::ptree& out_list, const std::string& name,
+    bool json)
+{
+    // HACK: work around invalid assertions in boost::property_tree.
+    // It is sufficient to call push_back as long as the name is empty.
+    const auto& key = json ? std::string() : name;
+    return out_list.push_back({ key, pt::ptree() })->second;
+}
+
+void inline add_child(pt::ptree& out_list, const std::string& name,
+    pt::ptree&& element, bool json)
+{
+    emplace_child(out_list, name, json).swap(element);
+}
+
 void inline add_child(pt::ptree& out_list, const std::string& name,
     const pt::ptree& element, bool json)
 {
-    if (json)
-    {
-        // HACK: work around invalid assertions in boost::property_tree.
-        // It is sufficient to call push_back as long as the name is empty.
-        out_list.push_back({ "", element });
-        ////out_list.add_child("", element);
-    }
-    else
-    {
-        out_list.add_child(name, element);
-    }
+    emplace_child(out_list, name, json) = element;
+}
+
+void inline add_child(pt::ptree& out_tree, const std::string& name,
+    pt::ptree&& element)
+{
+    add_child(out_tree, name, std::move(element), false);
 }
 
 template <typename Values>
@@ -70,12 +86,8 @@ pt::ptree prop_value_list(const std::string& name, const Values& values,
     bool json)
 {
     pt::ptree list;
-    pt::ptree element;
     for (const auto& value: values)
-    {
-        element.put_value(value);
-        add_child(list, name, element, json);
-    }
+        emplace_child(list, name, json).put_value(value);
 
     return list;
 }
@@ -85,12 +97,8 @@ pt::ptree prop_encoded_value_list(const std::string& name, const Values& values,
     bool json)
 {
     pt::ptree list;
-    pt::ptree element;
     for (const auto& value: values)
-    {
-        element.put_value(encode_base16(value));
-        add_child(list, name, element, json);
-    }
+        emplace_child(list, name, json).put_value(encode_base16(value));
 
     return list;
 }
@@ -29,6 +29,7 @@
 #include <cstddef>
 #include <iostream>
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <system_error>
 #include <tuple>
@@ -43,6 +44,7 @@
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
+#include <bitcoin/client.hpp>
 #include <bitcoin/explorer/define.hpp>
 
 namespace libbitcoin {
@@ -115,6 +117,39 @@ void write_file(std::ostream& output, const std::string& path,
     }
 }
 
+template <typename Item, typename Fetch>
+system::code fetch_range(client::obelisk_client& client,
+    std::vector<Item>& out, size_t start, size_t count, size_t& failed,
+    Fetch fetch)
+{
+    system::code result;
+    out.resize(count);
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        const range_handler<Item> on_done = [&, index](
+            const system::code& ec, const Item& item)
+        {
+            if (!ec)
+            {
+                out[index] = item;
+                return;
+            }
+
+            if (!result)
+            {
+                result = ec;
+                failed = start + index;
+            }
+        };
+
+        fetch(on_done, static_cast<uint32_t>(start + index));
+    }
+
+    client.wait();
+    return result;
+}
+
 } // namespace explorer
 } // namespace libbitcoin
 
@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_MERKLE_HPP
+#define BX_MERKLE_HPP
+
+#include <cstddef>
+#include <vector>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/config/merkle_proof.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * Hash each pair of nodes of a merkle tree level into the next level. An odd
+ * last node is paired with itself. The pairs are independent, so a large
+ * level is hashed in parallel chunks.
+ * @param[in]  level  The nodes of the level, at least one.
+ * @return            The nodes of the next level.
+ */
+BCX_API system::hash_list merkle_level(const system::hash_list& level);
+
+/**
+ * Compute the merkle root implied by the branch of a leaf.
+ * @param[in]  leaf    The leaf hash.
+ * @param[in]  index   The position of the leaf in the tree.
+ * @param[in]  branch  The sibling of each level, from the leaf level up.
+ * @return             The merkle root.
+ */
+BCX_API system::hash_digest merkle_root(const system::hash_digest& leaf,
+    size_t index, const system::hash_list& branch);
+
+/**
+ * Compute the merkle root implied by each proof, in parallel chunks.
+ * @param[in]  proofs  The proofs.
+ * @return             The root of each proof, in order of the proofs.
+ */
+BCX_API system::hash_list merkle_roots(
+    const std::vector<config::merkle_proof>& proofs);
+
+/**
+ * All levels of a merkle tree, so that the branches of any number of leaves
+ * are read from the same levels.
+ */
+class BCX_API merkle_tree
+{
+public:
+    /**
+     * Construct the tree of the leaves.
+     * @param[in]  leaves  The leaf hashes, in order.
+     */
+    merkle_tree(const system::hash_list& leaves);
+
+    /**
+     * The merkle root, or null_hash if there are no leaves.
+     */
+    system::hash_digest root() const;
+
+    /**
+     * Get the merkle branch of the leaf.
+     * @param[out] out    The sibling of each level, from the leaf level up.
+     * @param[in]  index  The position of the leaf.
+     * @return            True if the tree has the leaf.
+     */
+    bool branch(system::hash_list& out, size_t index) const;
+
+private:
+    std::vector<system::hash_list> levels_;
+};
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
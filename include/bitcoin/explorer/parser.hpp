@@ -44,6 +44,9 @@ public:
 
     virtual bool help() const;
 
+    /// The variables of the last successful parse.
+    virtual const system::variables_map& variables() const;
+
     /// Load command line options (named).
     virtual system::options_metadata load_options();
 
@@ -69,6 +72,7 @@ private:
 
     bool help_;
     command& instance_;
+    system::variables_map variables_;
 };
 
 } // namespace explorer
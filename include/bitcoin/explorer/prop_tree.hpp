@@ -28,6 +28,9 @@
 
 namespace libbitcoin {
 namespace explorer {
+
+struct used_address;
+
 namespace config {
 
 class base2;
@@ -163,6 +166,46 @@ BCX_API pt::ptree prop_list(const client::history::list& rows,
 BCX_API pt::ptree prop_tree(const client::history::list& rows,
     const system::wallet::payment_address& balance_address);
 
+/**
+ * Generate a property list for a used address of a wallet scan, with its
+ * balance and unspent outputs. The key is the position of its HD key.
+ * @param[in]  used  The used address.
+ * @param[in]  json  Use json array formatting.
+ * @return           A property list.
+ */
+BCX_API pt::ptree prop_list(const used_address& used, bool json);
+
+/**
+ * Generate a property tree for the used addresses of a wallet scan.
+ * @param[in]  addresses  The used addresses.
+ * @param[in]  json       Use json array formatting.
+ * @return                A property tree.
+ */
+BCX_API pt::ptree prop_tree(const std::vector<used_address>& addresses,
+    bool json);
+
+/**
+ * Generate a property list for a transaction confirmation event.
+ * @param[in]  event   The event name.
+ * @param[in]  hash    The transaction hash.
+ * @param[in]  height  The height of the confirming block, zero if none.
+ * @param[in]  index   The position of the transaction in the block.
+ * @return             A property list.
+ */
+BCX_API pt::ptree prop_list(const std::string& event,
+    const system::hash_digest& hash, size_t height, size_t index);
+
+/**
+ * Generate a property tree for a transaction confirmation event.
+ * @param[in]  event   The event name.
+ * @param[in]  hash    The transaction hash.
+ * @param[in]  height  The height of the confirming block, zero if none.
+ * @param[in]  index   The position of the transaction in the block.
+ * @return             A property tree.
+ */
+BCX_API pt::ptree prop_tree(const std::string& event,
+    const system::hash_digest& hash, size_t height, size_t index);
+
 /**
  * Generate a property list for a transaction input.
  * @param[in]  tx_input  The input.
@@ -0,0 +1,163 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_RELAY_HPP
+#define BX_RELAY_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <boost/filesystem.hpp>
+#include <bitcoin/client.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * Relay the requests of local obelisk clients to a server, and its block and
+ * transaction notifications to local subscribers. Each request id is
+ * replaced, so that the requests of many clients share one connection.
+ * A request that is not answered within the hedge delay, a percentile of the
+ * observed latencies, is also sent to the hedge server and the first response
+ * wins. A request that is not answered within the timeout, or a minute if
+ * there is none, fails with error::channel_timeout. A subscription remains
+ * routed after its first response, so that its notifications reach the
+ * subscriber, until it is unsubscribed or expires.
+ */
+class BCX_API relay
+{
+public:
+    /**
+     * Request counts and response latencies in milliseconds.
+     */
+    struct statistics
+    {
+        size_t requests;
+        size_t responses;
+        size_t hedged;
+        size_t hedge_wins;
+        size_t timeouts;
+        uint32_t median;
+        uint32_t ninetieth;
+        uint32_t ninety_ninth;
+    };
+
+    /**
+     * Construct a relay.
+     * @param[in]  server      The server connection settings.
+     * @param[in]  hedge       The hedge server, or none to disable hedging.
+     * @param[in]  hedge_key   The hedge server key, or none for the server's.
+     * @param[in]  timeout     The request timeout in milliseconds, or zero.
+     * @param[in]  percentile  The latency percentile of the hedge delay.
+     */
+    relay(const client::connection_settings& server,
+        const system::config::endpoint& hedge,
+        const system::config::sodium& hedge_key, uint32_t timeout,
+        uint16_t percentile);
+
+    /**
+     * Stop the relay if it is running.
+     */
+    ~relay();
+
+    /**
+     * Bind the local sockets and start relaying on a new thread. The query
+     * socket is bound last, as clients detect the relay by its file.
+     * @param[in]  socket  The path of the local query socket.
+     * @return             True if the relay is bound and connected.
+     */
+    bool start(const boost::filesystem::path& socket);
+
+    /**
+     * Stop relaying, join the relay thread and remove the socket files.
+     */
+    void stop();
+
+    /**
+     * Get the request statistics.
+     */
+    statistics report() const;
+
+    /**
+     * Write the request statistics as a line of text.
+     */
+    void write_report(std::ostream& stream) const;
+
+private:
+    void run(std::promise<bool>& started);
+    void record(uint32_t latency, bool hedge);
+
+    const client::connection_settings server_;
+    const system::config::endpoint hedge_;
+    const system::config::sodium hedge_key_;
+    const uint32_t timeout_;
+    const uint16_t percentile_;
+
+    boost::filesystem::path socket_;
+    std::atomic<bool> stopped_;
+    std::thread thread_;
+
+    // These are protected by the mutex.
+    mutable std::mutex mutex_;
+    statistics statistics_;
+    std::deque<uint32_t> latencies_;
+    uint32_t hedge_delay_;
+};
+
+/**
+ * Determine whether a relay is answering on the socket, as the socket file
+ * remains if its agent was killed.
+ * @param[in]  socket   The path of the local query socket.
+ * @param[in]  timeout  The time to wait for the answer in milliseconds.
+ * @return              True if the relay answered within the timeout.
+ */
+BCX_API bool ping_relay(const boost::filesystem::path& socket,
+    int32_t timeout);
+
+/**
+ * Get the socket of the relay of this process, starting it on first use.
+ * @param[in]  server      The server connection settings.
+ * @param[in]  hedge       The hedge server, or none to disable hedging.
+ * @param[in]  hedge_key   The hedge server key, or none for the server's.
+ * @param[in]  timeout     The request timeout in milliseconds, or zero.
+ * @param[in]  percentile  The latency percentile of the hedge delay.
+ * @return                 The socket, or empty if the relay did not start.
+ */
+BCX_API boost::filesystem::path start_process_relay(
+    const client::connection_settings& server,
+    const system::config::endpoint& hedge,
+    const system::config::sodium& hedge_key, uint32_t timeout,
+    uint16_t percentile);
+
+/**
+ * Stop the relay of this process if started and write its statistics.
+ * @param[in]  stream  The stream to write the statistics into.
+ */
+BCX_API void stop_process_relay(std::ostream& stream);
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
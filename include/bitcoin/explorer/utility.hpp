@@ -24,6 +24,7 @@
 #include <iostream>
 #include <cstdint>
 #include <fstream>
+#include <functional>
 #include <string>
 #include <system_error>
 #include <tuple>
@@ -48,6 +49,23 @@ namespace explorer {
 typedef std::pair<std::string, std::string> name_value_pair;
 typedef std::vector<name_value_pair> name_value_pairs;
 
+/**
+ * Type for writing the value generated from a seed, false if invalid.
+ */
+typedef std::function<bool(std::ostream&, const system::data_chunk&)>
+    seed_writer;
+
+/**
+ * Type for appending the result of a line of input.
+ */
+typedef std::function<void(std::string&, const std::string&)> line_writer;
+
+/**
+ * Type for handling the response to a request for the item at a height.
+ */
+template <typename Item>
+using range_handler = std::function<void(const system::code&, const Item&)>;
+
 /**
  * Forward declaration to break header cycle.
  */
@@ -121,11 +139,51 @@ void write_file(std::ostream& output, const std::string& path,
     const Instance& instance, bool terminate=true);
 
 /**
- * Get the connection settings for the configured network.
+ * Request each item of a range of heights before waiting for any response,
+ * so that the server processes the range as a pipeline.
+ * @param      <Item>    The type of the item at a height.
+ * @param      <Fetch>   The type of the request function.
+ * @param[in]  client    The connected client that the requests are sent on.
+ * @param[out] out       The items, in order of height.
+ * @param[in]  start     The height of the first item.
+ * @param[in]  count     The number of items.
+ * @param[out] failed    The height of the first failed request, if any.
+ * @param[in]  fetch     Sends the request, as fetch(range_handler, height).
+ * @returns              The error of the first failed request, if any.
+ */
+template <typename Item, typename Fetch>
+system::code fetch_range(client::obelisk_client& client,
+    std::vector<Item>& out, size_t start, size_t count, size_t& failed,
+    Fetch fetch);
+
+/**
+ * Get the connection settings for the configured network. If a local agent
+ * is configured and running the settings are those of the agent. Otherwise if
+ * hedging or a request timeout is configured the query service is that of a
+ * relay started for this process.
  * @param    command  The command.
+ * @param    agent    Use the agent if it is running (defaults to true).
  * @returns           A structure containing the connection settings.
  */
-BCX_API client::connection_settings get_connection(const command& command);
+BCX_API client::connection_settings get_connection(const command& command,
+    bool agent=true);
+
+/**
+ * Get the socket path of the local agent, from the environment variable or
+ * otherwise the server.agent setting.
+ * @param    command  The command.
+ * @returns           The socket path, empty if not configured.
+ */
+BCX_API boost::filesystem::path get_agent_path(const command& command);
+
+/**
+ * Get the endpoint of a local agent service.
+ * @param    path     The socket path of the agent.
+ * @param    service  The service name, empty for the query service.
+ * @returns           The ipc endpoint of the service.
+ */
+BCX_API system::config::endpoint get_agent_endpoint(
+    const boost::filesystem::path& path, const std::string& service);
 
 /**
  * Generate a new ec key from a seed.
@@ -135,12 +193,44 @@ BCX_API client::connection_settings get_connection(const command& command);
 BCX_API system::ec_secret new_key(const system::data_chunk& seed);
 
 /**
- * Generate a new pseudorandom seed.
+ * Fill the buffer from the secure random number generator of the operating
+ * system.
+ * @param[out] out  The buffer to fill.
+ * @return          False if the generator could not be read.
+ */
+BCX_API bool random_fill(system::data_chunk& out);
+
+/**
+ * Generate a new random seed.
  * @param[in]  seed  The seed length in bits. Will be aligned to nearest byte.
- * @return           The new key.
+ * @return           The new seed, empty if the generator could not be read.
  */
 BCX_API system::data_chunk new_seed(size_t bit_length=minimum_seed_bits);
 
+/**
+ * Write values generated from new random seeds, in parallel and in order.
+ * Each thread draws the entropy for a batch of seeds at once.
+ * @param[out] output     The stream to write.
+ * @param[in]  count      The number of values to generate.
+ * @param[in]  seed_size  The length of each seed in bytes.
+ * @param[in]  writer     The function to write the value of each seed.
+ * @return                no_entropy if the generator could not be read, or
+ *                        invalid_key if any seed produced an invalid value.
+ */
+BCX_API evaluation write_seeded(std::ostream& output, size_t count,
+    size_t seed_size, seed_writer writer);
+
+/**
+ * Write the result of each line of the input, in order of the lines. Lines
+ * are read in chunks, without line endings but otherwise untrimmed, and each
+ * chunk is shared across threads.
+ * @param[out] output  The stream to write.
+ * @param[in]  input   The stream of lines.
+ * @param[in]  writer  The function to append the result of a line.
+ */
+BCX_API void write_lines(std::ostream& output, std::istream& input,
+    line_writer writer);
+
 /**
  * Convert a list of indexes to a list of strings. This could be generalized.
  * @param[in]  indexes  The list of indexes to convert.
@@ -0,0 +1,140 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_WALLET_SCANNER_HPP
+#define BX_WALLET_SCANNER_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <bitcoin/client.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * A used address of a wallet scan, with its history.
+ */
+struct BCX_API used_address
+{
+    typedef std::vector<used_address> list;
+
+    size_t key;
+    uint32_t chain;
+    uint32_t index;
+    system::wallet::payment_address address;
+    client::history::list rows;
+};
+
+/**
+ * A gap limit scan of the receive and change chains of a set of HD public
+ * keys. Addresses are derived ahead of the scan on a thread of their own,
+ * so that derivation proceeds while the history of earlier addresses is
+ * queried. Each chain is scanned until the number of consecutive unused
+ * addresses that follow its last used address is the gap limit.
+ */
+class BCX_API wallet_scanner
+{
+public:
+    /**
+     * Construct a scan of the keys and start deriving.
+     * @param[in]  keys     The HD public keys, each of an account.
+     * @param[in]  gap      The gap limit, at least one.
+     * @param[in]  version  The payment address version.
+     */
+    wallet_scanner(const std::vector<system::wallet::hd_public>& keys,
+        uint32_t gap, uint8_t version);
+
+    /**
+     * Stop deriving.
+     */
+    ~wallet_scanner();
+
+    /**
+     * Obtain the next address to query, waiting for its derivation.
+     * @param[out] chain  The identifier of the chain of the address.
+     * @param[out] index  The index of the address in its chain.
+     * @param[out] key    The payments search key of the address.
+     * @return            False if no address is to be queried until a
+     *                    query completes.
+     */
+    bool next(size_t& chain, uint32_t& index, system::hash_digest& key);
+
+    /**
+     * Record the history of a queried address, which advances the gap
+     * window of its chain if it is used.
+     */
+    void complete(size_t chain, uint32_t index,
+        const client::history::list& rows);
+
+    /**
+     * True if all chains are scanned.
+     */
+    bool done() const;
+
+    /**
+     * The used addresses, ordered by key, chain and index.
+     */
+    used_address::list used() const;
+
+private:
+    struct derived_address
+    {
+        system::wallet::payment_address address;
+        system::hash_digest key;
+    };
+
+    struct chain_scan
+    {
+        size_t key;
+        uint32_t chain;
+        system::wallet::hd_public parent;
+        std::vector<derived_address> derived;
+        uint32_t next;
+        uint32_t horizon;
+        size_t pending;
+        std::map<uint32_t, client::history::list> used;
+    };
+
+    bool scanned(const chain_scan& scan) const;
+    bool behind(size_t& chain) const;
+    void derive();
+
+    const uint32_t gap_;
+    const uint8_t version_;
+    size_t cursor_;
+    bool stopped_;
+    std::vector<chain_scan> chains_;
+
+    // The chains are protected by the mutex, as derivation is concurrent.
+    mutable std::mutex mutex_;
+    std::condition_variable derived_;
+    std::condition_variable needed_;
+    std::thread deriver_;
+};
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
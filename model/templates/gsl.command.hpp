@@ -112,6 +112,15 @@ public:
         return false;
     }
 
+    /**
+     * Determines if the command uses the network, and so the network log.
+     * @return  True if the command is a network command.
+     */
+    virtual bool requires_network()
+    {
+        return false;
+    }
+
     /**
      * Invoke the command.
      * @param[out]  output  The input stream for the command execution.
@@ -245,6 +254,22 @@ public:
         return option_metadata_;
     }
 
+    /**
+     * Get the input stream of the command, which defaults to STDIN.
+     */
+    virtual std::istream& get_input()
+    {
+        return *input_;
+    }
+
+    /**
+     * Set the input stream of the command.
+     */
+    virtual void set_input(std::istream& input)
+    {
+        input_ = &input;
+    }
+
 .for configuration
 .   for setting
 .       is_vector = is_xml_true(multiple)
@@ -277,11 +302,17 @@ protected:
      * construction here.
      */
     command()
+      : input_(&std::cin)
     {
     }
 
 private:
 
+    /**
+     * The input stream of the command.
+     */
+    std::istream* input_;
+
     /**
      * Command line argument metadata.
      */
@@ -137,6 +137,17 @@ public:
         return true;
     }
 .endif
+.if (is_xml_true(network))
+
+    /**
+     * Determines if the command uses the network, and so the network log.
+     * @return  True if the command is a network command.
+     */
+    virtual bool requires_network()
+    {
+        return true;
+    }
+.endif
 
     /**
      * Load program argument definitions.
@@ -171,6 +182,15 @@ public:
 .   endif
 .   if (is_xml_true(argument.stdin))
         const auto raw = requires_raw_input();
+.       if (count(command.option, is_xml_true(count.batch)) > 0)
+
+        // The input is not read in batch mode.
+.           for option where is_xml_true(option.batch) & !defined(option.default)
+        if (variables.find("$(name:lower,c)") != variables.end())
+            return;
+.           endfor
+
+.       endif
         load_input($(getter), "$(name)", variables, input, raw);
 .   endif
 .endfor
@@ -273,6 +293,38 @@ public:
     virtual system::console_result invoke(std::ostream& output,
         std::ostream& cerr);
 
+.if (defined(command.result))
+.   result_type = normalize_type(!true(), !true(), command.result)
+.   remaining = count(command.argument) + \
+        count(command.option, !is_xml_true(count.batch))
+    /**
+     * Evaluate the command with typed parameters and result, without
+     * program options parsing, stream formatting or exceptions.
+     * The parameters are the arguments and then the options, in order,
+     * excluding batch options, which are applied by invoke.
+     * @param[out]  result  The typed result of the command.
+     * @return              The outcome, which invoke maps to a message.
+     */
+    static evaluation evaluate(
+        $(result_type)& result$(if_else(remaining > 0, ",", ");"))
+.   for argument
+.       remaining = remaining - 1
+.       is_vector = !is_default(limit, 1)
+.       argument_type = normalize_type(!true(), !true(), type)
+.       vtype = vectored_type(argument_type, is_vector)
+.       pluralized_name = pluralize(name, is_vector)
+        const $(vtype)& $(pluralized_name:lower,c)$(if_else(remaining > 0, ",", ");"))
+.   endfor
+.   for option where !is_xml_true(option.batch)
+.       remaining = remaining - 1
+.       is_vector = is_xml_true(multiple)
+.       option_type = normalize_type(true(), !true(), type)
+.       vtype = vectored_type(option_type, is_vector)
+.       pluralized_name = pluralize(name, is_vector)
+        const $(vtype)& $(pluralized_name:lower,c)$(if_else(remaining > 0, ",", ");"))
+.   endfor
+
+.endif
     /* Properties */
 
 .for argument
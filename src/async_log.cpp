@@ -0,0 +1,114 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/async_log.hpp>
+
+#include <algorithm>
+#include <ios>
+#include <string>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/log/attributes/clock.hpp>
+#include <boost/log/core.hpp>
+#include <boost/log/expressions.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/config/severity.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+using namespace bc::system;
+using namespace boost::log::expressions;
+using namespace boost::log::sinks;
+
+// The attributes of a record of the libbitcoin log source.
+static const auto channel_name = "Channel";
+static const auto severity_name = "Severity";
+static const auto timestamp_name = "TimeStamp";
+
+// This runs on the thread of the sink, not the logging thread.
+static void format_record(const boost::log::record_view& record,
+    boost::log::formatting_ostream& stream)
+{
+    using boost::log::extract;
+    const auto time = extract<boost::posix_time::ptime>(timestamp_name,
+        record);
+    const auto level = extract<log::severity>(severity_name, record);
+    const auto channel = extract<std::string>(channel_name, record);
+
+    if (time)
+        stream << boost::posix_time::to_simple_string(*time) << " ";
+
+    if (level)
+        stream << config::severity(*level) << " ";
+
+    if (channel)
+        stream << "[" << *channel << "] ";
+
+    stream << record[smessage];
+}
+
+async_log::async_log(const boost::filesystem::path& debug_file,
+    const boost::filesystem::path& error_file, log::severity minimum)
+  : debug_(add_sink(debug_file, minimum)),
+    error_(add_sink(error_file, std::max(minimum, log::severity::warning)))
+{
+    // An existing timestamp attribute is retained.
+    boost::log::core::get()->add_global_attribute(timestamp_name,
+        boost::log::attributes::utc_clock());
+}
+
+async_log::~async_log()
+{
+    remove_sink(debug_);
+    remove_sink(error_);
+}
+
+boost::shared_ptr<async_log::file_sink> async_log::add_sink(
+    const boost::filesystem::path& file, log::severity minimum)
+{
+    const auto backend = boost::make_shared<text_file_backend>(
+        boost::log::keywords::file_name = file.string(),
+        boost::log::keywords::open_mode =
+            std::ios_base::out | std::ios_base::app);
+
+    // Flushing is on the thread of the sink, so each record is flushed.
+    backend->auto_flush(true);
+
+    const auto sink = boost::make_shared<file_sink>(backend);
+    sink->set_formatter(&format_record);
+
+    // A filtered record is discarded before it is formatted or queued.
+    sink->set_filter(attr<log::severity>(severity_name) >= minimum);
+
+    boost::log::core::get()->add_sink(sink);
+    return sink;
+}
+
+void async_log::remove_sink(const boost::shared_ptr<file_sink>& sink)
+{
+    boost::log::core::get()->remove_sink(sink);
+    sink->stop();
+    sink->flush();
+}
+
+} // namespace explorer
+} // namespace libbitcoin
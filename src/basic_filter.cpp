@@ -0,0 +1,310 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/basic_filter.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+using namespace bc::system;
+using namespace bc::system::chain;
+
+// BIP158 basic filter parameters.
+static const uint8_t golomb_bits = 19;
+static const uint64_t golomb_modulus = 784931;
+static const uint8_t op_return = 0x6a;
+
+// SipHash-2-4.
+//-----------------------------------------------------------------------------
+
+static inline uint64_t rotate_left(uint64_t value, size_t bits)
+{
+    return (value << bits) | (value >> (64 - bits));
+}
+
+static inline uint64_t read_little_endian(const uint8_t* data)
+{
+    uint64_t value = 0;
+    for (size_t byte = 0; byte < sizeof(uint64_t); ++byte)
+        value |= static_cast<uint64_t>(data[byte]) << (8 * byte);
+
+    return value;
+}
+
+static inline void sip_round(uint64_t& v0, uint64_t& v1, uint64_t& v2,
+    uint64_t& v3)
+{
+    v0 += v1; v1 = rotate_left(v1, 13); v1 ^= v0; v0 = rotate_left(v0, 32);
+    v2 += v3; v3 = rotate_left(v3, 16); v3 ^= v2;
+    v0 += v3; v3 = rotate_left(v3, 21); v3 ^= v0;
+    v2 += v1; v1 = rotate_left(v1, 17); v1 ^= v2; v2 = rotate_left(v2, 32);
+}
+
+uint64_t sip_hash(uint64_t k0, uint64_t k1, const data_chunk& data)
+{
+    auto v0 = UINT64_C(0x736f6d6570736575) ^ k0;
+    auto v1 = UINT64_C(0x646f72616e646f6d) ^ k1;
+    auto v2 = UINT64_C(0x6c7967656e657261) ^ k0;
+    auto v3 = UINT64_C(0x7465646279746573) ^ k1;
+
+    const auto size = data.size();
+    const auto end = size - (size % sizeof(uint64_t));
+
+    for (size_t offset = 0; offset < end; offset += sizeof(uint64_t))
+    {
+        const auto word = read_little_endian(&data[offset]);
+        v3 ^= word;
+        sip_round(v0, v1, v2, v3);
+        sip_round(v0, v1, v2, v3);
+        v0 ^= word;
+    }
+
+    auto last = static_cast<uint64_t>(size) << 56;
+    for (size_t byte = 0; end + byte < size; ++byte)
+        last |= static_cast<uint64_t>(data[end + byte]) << (8 * byte);
+
+    v3 ^= last;
+    sip_round(v0, v1, v2, v3);
+    sip_round(v0, v1, v2, v3);
+    v0 ^= last;
+
+    v2 ^= 0xff;
+    sip_round(v0, v1, v2, v3);
+    sip_round(v0, v1, v2, v3);
+    sip_round(v0, v1, v2, v3);
+    sip_round(v0, v1, v2, v3);
+    return v0 ^ v1 ^ v2 ^ v3;
+}
+
+// Golomb-coded set.
+//-----------------------------------------------------------------------------
+
+// The high word of the 128 bit product maps a hash uniformly into [0, range).
+static inline uint64_t map_into_range(uint64_t hash, uint64_t range)
+{
+#ifdef __SIZEOF_INT128__
+    return static_cast<uint64_t>(
+        (static_cast<unsigned __int128>(hash) * range) >> 64);
+#else
+    const uint64_t hash_high = hash >> 32;
+    const uint64_t hash_low = hash & 0xffffffff;
+    const uint64_t range_high = range >> 32;
+    const uint64_t range_low = range & 0xffffffff;
+
+    const auto low_low = hash_low * range_low;
+    const auto low_high = hash_low * range_high;
+    const auto high_low = hash_high * range_low;
+    const auto high_high = hash_high * range_high;
+
+    const auto middle = (low_low >> 32) + (low_high & 0xffffffff) +
+        (high_low & 0xffffffff);
+
+    return high_high + (low_high >> 32) + (high_low >> 32) + (middle >> 32);
+#endif
+}
+
+// Accumulates bits most significant first in a word and emits whole bytes.
+class bit_writer
+{
+public:
+    bit_writer(data_chunk& out)
+      : out_(out), buffer_(0), bits_(0)
+    {
+    }
+
+    // Write the low count bits of value, count must not exceed 32.
+    void write(uint64_t value, size_t count)
+    {
+        buffer_ = (buffer_ << count) | (value & ((UINT64_C(1) << count) - 1));
+        bits_ += count;
+
+        while (bits_ >= 8)
+        {
+            bits_ -= 8;
+            out_.push_back(static_cast<uint8_t>(buffer_ >> bits_));
+        }
+    }
+
+    // Write the quotient in unary and the remainder in golomb_bits. The
+    // quotient is unbounded, so its unary bits are written in words.
+    void write_golomb(uint64_t delta)
+    {
+        auto quotient = delta >> golomb_bits;
+        for (; quotient >= 32; quotient -= 32)
+            write(0xffffffff, 32);
+
+        write(((UINT64_C(1) << quotient) - 1) << 1, quotient + 1);
+        write(delta, golomb_bits);
+    }
+
+    // Pad the last partial byte with zeros.
+    void flush()
+    {
+        if (bits_ == 0)
+            return;
+
+        out_.push_back(static_cast<uint8_t>(buffer_ << (8 - bits_)));
+        bits_ = 0;
+    }
+
+private:
+    data_chunk& out_;
+    uint64_t buffer_;
+    size_t bits_;
+};
+
+static void write_compact_size(data_chunk& out, uint64_t value)
+{
+    size_t width;
+
+    if (value < 0xfd)
+    {
+        out.push_back(static_cast<uint8_t>(value));
+        return;
+    }
+    else if (value <= 0xffff)
+    {
+        out.push_back(0xfd);
+        width = sizeof(uint16_t);
+    }
+    else if (value <= 0xffffffff)
+    {
+        out.push_back(0xfe);
+        width = sizeof(uint32_t);
+    }
+    else
+    {
+        out.push_back(0xff);
+        width = sizeof(uint64_t);
+    }
+
+    for (size_t byte = 0; byte < width; ++byte)
+        out.push_back(static_cast<uint8_t>(value >> (8 * byte)));
+}
+
+data_chunk golomb_encode(const std::vector<uint64_t>& values)
+{
+    data_chunk out;
+    out.reserve((values.size() * (golomb_bits + 2) + 7) / 8);
+    bit_writer writer(out);
+    uint64_t previous = 0;
+
+    for (const auto value: values)
+    {
+        writer.write_golomb(value - previous);
+        previous = value;
+    }
+
+    writer.flush();
+    return out;
+}
+
+// The element set is consumed (sorted and deduplicated) by construction.
+data_chunk compute_filter(const hash_digest& block_hash, data_stack& elements)
+{
+    std::sort(elements.begin(), elements.end());
+    elements.erase(std::unique(elements.begin(), elements.end()),
+        elements.end());
+
+    const uint64_t count = elements.size();
+
+    data_chunk out;
+    write_compact_size(out, count);
+
+    if (count == 0)
+        return out;
+
+    // The key is the first 16 bytes of the block hash in internal order.
+    const auto k0 = read_little_endian(&block_hash[0]);
+    const auto k1 = read_little_endian(&block_hash[8]);
+    const auto range = count * golomb_modulus;
+
+    std::vector<uint64_t> values;
+    values.reserve(count);
+
+    for (const auto& element: elements)
+        values.push_back(map_into_range(sip_hash(k0, k1, element), range));
+
+    std::sort(values.begin(), values.end());
+    extend_data(out, golomb_encode(values));
+    return out;
+}
+
+hash_digest filter_header(const data_chunk& filter,
+    const hash_digest& previous)
+{
+    return bitcoin_hash(build_chunk({ bitcoin_hash(filter), previous }));
+}
+
+// Filter elements.
+//-----------------------------------------------------------------------------
+
+static const transaction* find_transaction(const hash_digest& hash,
+    const transaction_index& confirmed, const transaction_map& previous)
+{
+    const auto local = confirmed.find(hash);
+    if (local != confirmed.end())
+        return local->second;
+
+    const auto remote = previous.find(hash);
+    return remote == previous.end() ? nullptr : &remote->second;
+}
+
+bool filter_elements(data_stack& out, const block& block,
+    const transaction_index& confirmed, const transaction_map& previous)
+{
+    for (const auto& tx: block.transactions())
+    {
+        for (const auto& output: tx.outputs())
+        {
+            auto script = output.script().to_data(false);
+            if (!script.empty() && script.front() != op_return)
+                out.push_back(std::move(script));
+        }
+
+        if (tx.is_coinbase())
+            continue;
+
+        for (const auto& input: tx.inputs())
+        {
+            const auto& point = input.previous_output();
+            const auto prevout = find_transaction(point.hash(), confirmed,
+                previous);
+
+            if (prevout == nullptr || point.index() >= prevout->outputs().size())
+                return false;
+
+            auto script = prevout->outputs()[point.index()].script()
+                .to_data(false);
+            if (!script.empty())
+                out.push_back(std::move(script));
+        }
+    }
+
+    return true;
+}
+
+} // namespace explorer
+} // namespace libbitcoin
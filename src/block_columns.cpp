@@ -0,0 +1,312 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/block_columns.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include <bitcoin/system.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+using namespace bc::system;
+using namespace bc::system::machine;
+
+// The outpoint record is the transaction hash and the output index.
+static const size_t outpoint_record_size = hash_size + sizeof(uint32_t);
+
+const std::vector<std::string> block_columns::script_type_names
+{
+    "non_standard",
+    "pay_key_hash",
+    "pay_script_hash",
+    "pay_public_key",
+    "pay_multisig",
+    "null_data",
+    "pay_witness_key_hash",
+    "pay_witness_script_hash"
+};
+
+static block_columns::script_type to_script_type(const chain::script& script)
+{
+    typedef block_columns::script_type type;
+
+    switch (script.output_pattern())
+    {
+        case script_pattern::pay_key_hash:
+            return type::pay_key_hash;
+        case script_pattern::pay_script_hash:
+            return type::pay_script_hash;
+        case script_pattern::pay_public_key:
+            return type::pay_public_key;
+        case script_pattern::pay_multisig:
+            return type::pay_multisig;
+        case script_pattern::null_data:
+            return type::null_data;
+        case script_pattern::pay_witness_key_hash:
+            return type::pay_witness_key_hash;
+        case script_pattern::pay_witness_script_hash:
+            return type::pay_witness_script_hash;
+        default:
+            return type::non_standard;
+    }
+}
+
+// Blocks vary greatly in size, so each worker takes the next block rather
+// than a fixed share of the blocks.
+block_columns::list block_columns::extract(const chain::block::list& blocks,
+    uint32_t height, uint8_t p2kh_version, uint8_t p2sh_version)
+{
+    list columns(blocks.size());
+    std::atomic<size_t> next(0);
+
+    const auto work = [&]()
+    {
+        for (auto index = next++; index < blocks.size(); index = next++)
+            columns[index] = block_columns(blocks[index],
+                height + static_cast<uint32_t>(index), p2kh_version,
+                p2sh_version);
+    };
+
+    const auto threads = std::min<size_t>(blocks.size(),
+        std::max(std::thread::hardware_concurrency(), 1u));
+
+    std::vector<std::thread> workers;
+    for (size_t thread = 0; thread < threads; ++thread)
+        workers.emplace_back(work);
+
+    for (auto& worker: workers)
+        worker.join();
+
+    return columns;
+}
+
+block_columns::block_columns()
+  : height(0), hash(null_hash), transactions(0), inputs(0), outputs(0)
+{
+}
+
+block_columns::block_columns(const chain::block& block, uint32_t block_height,
+    uint8_t p2kh_version, uint8_t p2sh_version)
+  : height(block_height),
+    hash(block.hash()),
+    transactions(block.transactions().size()),
+    inputs(0),
+    outputs(0)
+{
+    const auto& txs = block.transactions();
+
+    for (const auto& tx: txs)
+    {
+        inputs += tx.inputs().size();
+        outputs += tx.outputs().size();
+    }
+
+    tx_hashes.reserve(transactions * hash_size);
+    input_outpoints.reserve(inputs * outpoint_record_size);
+    output_values.reserve(outputs * sizeof(uint64_t));
+    script_types.reserve(outputs);
+    addresses.reserve(outputs);
+
+    for (const auto& tx: txs)
+    {
+        extend_data(tx_hashes, tx.hash());
+
+        for (const auto& input: tx.inputs())
+        {
+            const auto& point = input.previous_output();
+            extend_data(input_outpoints, point.hash());
+            extend_data(input_outpoints, to_little_endian(point.index()));
+        }
+
+        for (const auto& output: tx.outputs())
+        {
+            const auto& script = output.script();
+            extend_data(output_values, to_little_endian(output.value()));
+            script_types.push_back(static_cast<uint8_t>(
+                to_script_type(script)));
+
+            const auto found = wallet::payment_address::extract_output(
+                script, p2kh_version, p2sh_version);
+            addresses.push_back(found.empty() ? wallet::payment_address() :
+                found.front());
+        }
+    }
+}
+
+// column_writer
+//-----------------------------------------------------------------------------
+
+const size_t column_writer::block_record_size;
+const size_t column_writer::address_record_size;
+const uint32_t column_writer::no_address;
+
+static bool put(std::ostream& file, const data_chunk& data)
+{
+    file.write(reinterpret_cast<const char*>(data.data()), data.size());
+    return file.good();
+}
+
+column_writer::column_writer(const boost::filesystem::path& directory)
+  : directory_(directory),
+    blocks_(0),
+    transactions_(0),
+    inputs_(0),
+    outputs_(0)
+{
+}
+
+column_writer::file_ptr column_writer::create(const std::string& name) const
+{
+    return file_ptr(new system::ofstream((directory_ / name).string(),
+        std::ofstream::binary | std::ofstream::trunc));
+}
+
+bool column_writer::open()
+{
+    boost::system::error_code ec;
+    boost::filesystem::create_directories(directory_, ec);
+    if (ec)
+        return false;
+
+    block_file_ = create("blocks.col");
+    tx_hash_file_ = create("tx_hashes.col");
+    input_outpoint_file_ = create("input_outpoints.col");
+    output_value_file_ = create("output_values.col");
+    script_type_file_ = create("script_types.col");
+    address_file_ = create("addresses.col");
+    address_dictionary_file_ = create("addresses.dict");
+
+    // The script type dictionary is a line per value, in order of value.
+    auto script_types = create("script_types.dict");
+    for (const auto& name: block_columns::script_type_names)
+        *script_types << name << std::endl;
+
+    return script_types->good() && block_file_->good() &&
+        tx_hash_file_->good() && input_outpoint_file_->good() &&
+        output_value_file_->good() && script_type_file_->good() &&
+        address_file_->good() && address_dictionary_file_->good();
+}
+
+bool column_writer::write(const block_columns& columns)
+{
+    data_chunk record;
+    record.reserve(block_record_size);
+    extend_data(record, to_little_endian(columns.height));
+    extend_data(record, columns.hash);
+    extend_data(record, to_little_endian<uint64_t>(transactions_));
+    extend_data(record, to_little_endian<uint64_t>(inputs_));
+    extend_data(record, to_little_endian<uint64_t>(outputs_));
+
+    data_chunk addresses;
+    data_chunk dictionary;
+    addresses.reserve(columns.addresses.size() * sizeof(uint32_t));
+
+    for (const auto& address: columns.addresses)
+    {
+        if (!address)
+        {
+            extend_data(addresses, to_little_endian(no_address));
+            continue;
+        }
+
+        address_key key;
+        const auto& hash = address.hash();
+        key.front() = address.version();
+        std::copy(hash.begin(), hash.end(), key.begin() + 1);
+
+        const auto entry = dictionary_.emplace(key,
+            static_cast<uint32_t>(dictionary_.size()));
+
+        if (entry.second)
+            extend_data(dictionary, key);
+
+        extend_data(addresses, to_little_endian(entry.first->second));
+    }
+
+    ++blocks_;
+    transactions_ += columns.transactions;
+    inputs_ += columns.inputs;
+    outputs_ += columns.outputs;
+
+    return put(*block_file_, record) &&
+        put(*tx_hash_file_, columns.tx_hashes) &&
+        put(*input_outpoint_file_, columns.input_outpoints) &&
+        put(*output_value_file_, columns.output_values) &&
+        put(*script_type_file_, columns.script_types) &&
+        put(*address_file_, addresses) &&
+        put(*address_dictionary_file_, dictionary);
+}
+
+bool column_writer::close()
+{
+    auto result = true;
+    const auto close_file = [&result](file_ptr& file)
+    {
+        if (!file)
+            return;
+
+        file->flush();
+        result &= file->good();
+        file.reset();
+    };
+
+    close_file(block_file_);
+    close_file(tx_hash_file_);
+    close_file(input_outpoint_file_);
+    close_file(output_value_file_);
+    close_file(script_type_file_);
+    close_file(address_file_);
+    close_file(address_dictionary_file_);
+    return result;
+}
+
+size_t column_writer::blocks() const
+{
+    return blocks_;
+}
+
+size_t column_writer::transactions() const
+{
+    return transactions_;
+}
+
+size_t column_writer::inputs() const
+{
+    return inputs_;
+}
+
+size_t column_writer::outputs() const
+{
+    return outputs_;
+}
+
+size_t column_writer::addresses() const
+{
+    return dictionary_.size();
+}
+
+} // namespace explorer
+} // namespace libbitcoin
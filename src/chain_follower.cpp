@@ -0,0 +1,207 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/chain_follower.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/system.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+using namespace bc::system;
+
+chain_follower::chain_follower(size_t depth,
+    const wallet::payment_address::list& addresses, uint8_t p2kh_version,
+    uint8_t p2sh_version, handler notify)
+  : depth_(std::max(depth, size_t(1))),
+    p2kh_version_(p2kh_version),
+    p2sh_version_(p2sh_version),
+    notify_(notify)
+{
+    for (const auto& address: addresses)
+        addresses_.insert(to_key(address));
+}
+
+void chain_follower::start(size_t height, const hash_digest& hash)
+{
+    blocks_.clear();
+    unspent_.clear();
+    blocks_.push_back({ height, hash, {} });
+}
+
+void chain_follower::seed(const chain_follower::output& output)
+{
+    unspent_[to_key(output.point)] = output;
+}
+
+bool chain_follower::connect(const chain::block& block)
+{
+    const auto hash = block.hash();
+    if (contains(hash))
+        return true;
+
+    const auto& parent = block.header().previous_block_hash();
+    if (!contains(parent))
+        return false;
+
+    // A parent below the top is a reorganization.
+    while (top_hash() != parent)
+        disconnect();
+
+    block_entry entry{ top_height() + 1, hash, {} };
+
+    // Inputs are applied before outputs, transaction by transaction, so that
+    // an output spent within its block is added and then removed.
+    for (const auto& tx: block.transactions())
+    {
+        if (!tx.is_coinbase())
+        {
+            for (const auto& input: tx.inputs())
+            {
+                const auto it = unspent_.find(to_key(input.previous_output()));
+                if (it == unspent_.end())
+                    continue;
+
+                // Applying the change erases the output from the view.
+                const auto spent = it->second;
+                apply(entry, false, spent);
+            }
+        }
+
+        const auto tx_hash = tx.hash();
+        const auto& outputs = tx.outputs();
+
+        for (uint32_t index = 0; index < outputs.size(); ++index)
+        {
+            wallet::payment_address address;
+            if (followed(outputs[index].script(), address))
+                apply(entry, true, { { tx_hash, index },
+                    outputs[index].value(), address });
+        }
+    }
+
+    blocks_.push_back(entry);
+
+    // The start block is replaced by the oldest retained block.
+    if (blocks_.size() > depth_ + 1)
+        blocks_.pop_front();
+
+    return true;
+}
+
+bool chain_follower::disconnect()
+{
+    if (blocks_.size() < 2)
+        return false;
+
+    auto& entry = blocks_.back();
+    const auto& changes = entry.changes;
+
+    // Changes are reversed in reverse order, so the view is restored exactly.
+    for (auto it = changes.rbegin(); it != changes.rend(); ++it)
+    {
+        if (it->add)
+            unspent_.erase(to_key(it->output.point));
+        else
+            unspent_[to_key(it->output.point)] = it->output;
+
+        notify_({ !it->add, entry.height, it->output });
+    }
+
+    blocks_.pop_back();
+    return true;
+}
+
+bool chain_follower::contains(const hash_digest& hash) const
+{
+    return std::any_of(blocks_.begin(), blocks_.end(),
+        [&hash](const block_entry& entry)
+        {
+            return entry.hash == hash;
+        });
+}
+
+size_t chain_follower::top_height() const
+{
+    return blocks_.empty() ? 0 : blocks_.back().height;
+}
+
+hash_digest chain_follower::top_hash() const
+{
+    return blocks_.empty() ? null_hash : blocks_.back().hash;
+}
+
+size_t chain_follower::unspent() const
+{
+    return unspent_.size();
+}
+
+// private
+//-----------------------------------------------------------------------------
+
+chain_follower::address_key chain_follower::to_key(
+    const wallet::payment_address& address)
+{
+    address_key key;
+    const auto& hash = address.hash();
+    key.front() = address.version();
+    std::copy(hash.begin(), hash.end(), key.begin() + 1);
+    return key;
+}
+
+chain_follower::point_key chain_follower::to_key(
+    const chain::output_point& point)
+{
+    return { point.hash(), point.index() };
+}
+
+bool chain_follower::followed(const chain::script& script,
+    wallet::payment_address& out) const
+{
+    const auto addresses = wallet::payment_address::extract_output(script,
+        p2kh_version_, p2sh_version_);
+
+    for (const auto& address: addresses)
+    {
+        if (address && addresses_.count(to_key(address)) != 0)
+        {
+            out = address;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void chain_follower::apply(block_entry& entry, bool add,
+    const chain_follower::output& output)
+{
+    if (add)
+        unspent_[to_key(output.point)] = output;
+    else
+        unspent_.erase(to_key(output.point));
+
+    entry.changes.push_back({ add, output });
+    notify_({ add, entry.height, output });
+}
+
+} // namespace explorer
+} // namespace libbitcoin
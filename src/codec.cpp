@@ -0,0 +1,385 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/codec.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <bitcoin/system.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+using namespace bc::system;
+
+typedef std::array<uint16_t, 256> value_table;
+
+// Set in the value of a character that is not a digit.
+static const uint16_t invalid = 0x100;
+
+// A Base58 limb of five digits, 58^5, is less than 2^30, so a limb shifted
+// by four bytes, or a 32 bit limb times 58^5, fits in 64 bits.
+static const uint32_t base58_limb = 656356768;
+static const size_t base58_limb_digits = 5;
+static const size_t base58_limb_bytes = 4;
+
+// The largest value decoded by the fixed size Base58 decoder.
+static const size_t base58_fixed_bytes = 64;
+
+static const char base16_digits[] = "0123456789abcdef";
+static const char base58_digits[] =
+    "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+static const char base64_digits[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static value_table make_values(const char* digits, size_t base)
+{
+    value_table values;
+    values.fill(invalid);
+
+    for (size_t digit = 0; digit < base; ++digit)
+        values[static_cast<uint8_t>(digits[digit])] =
+            static_cast<uint16_t>(digit);
+
+    return values;
+}
+
+static value_table make_base16_values()
+{
+    auto values = make_values(base16_digits, 16);
+    for (size_t digit = 10; digit < 16; ++digit)
+        values['A' + digit - 10] = static_cast<uint16_t>(digit);
+
+    return values;
+}
+
+static std::array<std::array<char, 2>, 256> make_base16_pairs()
+{
+    std::array<std::array<char, 2>, 256> pairs;
+    for (size_t byte = 0; byte < pairs.size(); ++byte)
+        pairs[byte] = { { base16_digits[byte >> 4],
+            base16_digits[byte & 0x0f] } };
+
+    return pairs;
+}
+
+static const auto base16_pairs = make_base16_pairs();
+static const auto base16_values = make_base16_values();
+static const auto base58_values = make_values(base58_digits, 58);
+static const auto base64_values = make_values(base64_digits, 64);
+
+std::string to_base16(data_slice data)
+{
+    std::string encoded(data.size() * 2, '\0');
+    auto target = encoded.begin();
+
+    for (const auto byte: data)
+    {
+        const auto& pair = base16_pairs[byte];
+        *target++ = pair[0];
+        *target++ = pair[1];
+    }
+
+    return encoded;
+}
+
+bool from_base16(data_chunk& out, const std::string& in)
+{
+    if (in.size() % 2 != 0)
+        return false;
+
+    data_chunk decoded(in.size() / 2);
+    uint16_t flags = 0;
+
+    for (size_t index = 0; index < decoded.size(); ++index)
+    {
+        const auto high = base16_values[static_cast<uint8_t>(in[index * 2])];
+        const auto low = base16_values[static_cast<uint8_t>(
+            in[index * 2 + 1])];
+        flags |= high | low;
+        decoded[index] = static_cast<uint8_t>((high << 4) | low);
+    }
+
+    if ((flags & invalid) != 0)
+        return false;
+
+    out.swap(decoded);
+    return true;
+}
+
+std::string to_base58(data_slice data)
+{
+    const auto end = data.end();
+    const auto first = std::find_if(data.begin(), end,
+        [](uint8_t byte) { return byte != 0; });
+    const auto zeros = static_cast<size_t>(first - data.begin());
+    const auto size = static_cast<size_t>(end - first);
+
+    // Little endian limbs, each of five digits. A Base58 value has at most
+    // 138 digits for each 100 bytes.
+    std::vector<uint32_t> limbs;
+    limbs.reserve(size * 138 / 100 / base58_limb_digits + 1);
+
+    // The first word takes the odd bytes, so that the rest are whole.
+    const auto remainder = size % base58_limb_bytes;
+    auto bytes = remainder == 0 ? base58_limb_bytes : remainder;
+
+    for (auto byte = first; byte != end; bytes = base58_limb_bytes)
+    {
+        uint64_t carry = 0;
+        for (size_t index = 0; index < bytes; ++index)
+            carry = (carry << 8) | *byte++;
+
+        for (auto& limb: limbs)
+        {
+            const auto value = (uint64_t(limb) << (8 * bytes)) + carry;
+            limb = static_cast<uint32_t>(value % base58_limb);
+            carry = value / base58_limb;
+        }
+
+        for (; carry != 0; carry /= base58_limb)
+            limbs.push_back(static_cast<uint32_t>(carry % base58_limb));
+    }
+
+    std::string encoded;
+    encoded.reserve(zeros + limbs.size() * base58_limb_digits);
+
+    for (auto limb: limbs)
+    {
+        for (size_t digit = 0; digit < base58_limb_digits; ++digit)
+        {
+            encoded.push_back(base58_digits[limb % 58]);
+            limb /= 58;
+        }
+    }
+
+    // Drop the zero digits that pad the top limb.
+    while (!encoded.empty() && encoded.back() == base58_digits[0])
+        encoded.pop_back();
+
+    encoded.append(zeros, base58_digits[0]);
+    std::reverse(encoded.begin(), encoded.end());
+    return encoded;
+}
+
+typedef std::string::const_iterator digit_iterator;
+
+// Accumulate the digits into little endian limbs of 32 bits, five digits at
+// a time. False if a digit is invalid or the value exceeds the capacity.
+static bool base58_limbs(uint32_t* limbs, size_t capacity, size_t& count,
+    digit_iterator first, digit_iterator end)
+{
+    uint16_t flags = 0;
+    count = 0;
+
+    // The first word takes the odd digits, so that the rest are whole.
+    const auto remainder = static_cast<size_t>(end - first) %
+        base58_limb_digits;
+    auto digits = remainder == 0 ? base58_limb_digits : remainder;
+
+    for (auto digit = first; digit != end; digits = base58_limb_digits)
+    {
+        uint64_t carry = 0;
+        uint64_t multiplier = 1;
+        for (size_t index = 0; index < digits; ++index)
+        {
+            const auto value = base58_values[static_cast<uint8_t>(*digit++)];
+            flags |= value;
+            carry = carry * 58 + (value & 0xff);
+            multiplier *= 58;
+        }
+
+        for (size_t index = 0; index < count; ++index)
+        {
+            const auto value = uint64_t(limbs[index]) * multiplier + carry;
+            limbs[index] = static_cast<uint32_t>(value);
+            carry = value >> 32;
+        }
+
+        for (; carry != 0; carry >>= 32)
+        {
+            if (count == capacity)
+                return false;
+
+            limbs[count++] = static_cast<uint32_t>(carry);
+        }
+    }
+
+    return (flags & invalid) == 0;
+}
+
+static digit_iterator base58_zeros(const std::string& in)
+{
+    return std::find_if(in.begin(), in.end(),
+        [](char digit) { return digit != base58_digits[0]; });
+}
+
+bool from_base58(data_chunk& out, const std::string& in)
+{
+    const auto first = base58_zeros(in);
+    const auto zeros = static_cast<size_t>(first - in.begin());
+
+    // A value of n digits has at most n * log(58) / log(256) bytes.
+    std::vector<uint32_t> limbs(static_cast<size_t>(in.end() - first) *
+        733 / 1000 / base58_limb_bytes + 2);
+
+    size_t count;
+    if (!base58_limbs(limbs.data(), limbs.size(), count, first, in.end()))
+        return false;
+
+    data_chunk decoded(zeros, 0x00);
+    decoded.reserve(zeros + count * base58_limb_bytes);
+
+    // Emit big endian bytes, without the zero bytes that pad the top limb.
+    for (auto limb = count; limb > 0; --limb)
+    {
+        for (auto shift = 24; shift >= 0; shift -= 8)
+        {
+            const auto byte = static_cast<uint8_t>(limbs[limb - 1] >> shift);
+            if (byte != 0 || decoded.size() > zeros)
+                decoded.push_back(byte);
+        }
+    }
+
+    out.swap(decoded);
+    return true;
+}
+
+bool from_base58(uint8_t* out, size_t size, const std::string& in)
+{
+    std::array<uint32_t, base58_fixed_bytes / base58_limb_bytes> limbs;
+    const auto first = base58_zeros(in);
+    const auto zeros = static_cast<size_t>(first - in.begin());
+    const auto capacity = std::min(limbs.size(),
+        (size + base58_limb_bytes - 1) / base58_limb_bytes);
+
+    size_t count;
+    if (zeros > size ||
+        !base58_limbs(limbs.data(), capacity, count, first, in.end()))
+        return false;
+
+    // Write big endian bytes from the end, failing on bytes that overflow.
+    std::fill(out, out + size, 0x00);
+    for (size_t limb = 0; limb < count; ++limb)
+    {
+        for (size_t byte = 0; byte < base58_limb_bytes; ++byte)
+        {
+            const auto value = static_cast<uint8_t>(limbs[limb] >> (8 * byte));
+            const auto position = limb * base58_limb_bytes + byte;
+
+            if (position < size)
+                out[size - position - 1] = value;
+            else if (value != 0)
+                return false;
+        }
+    }
+
+    // The value must begin exactly after the leading zeros.
+    return std::all_of(out, out + zeros, [](uint8_t byte) { return byte == 0; })
+        && (zeros == size || out[zeros] != 0);
+}
+
+std::string to_base58check(uint8_t version, data_slice payload)
+{
+    auto data = build_chunk({ to_array(version), payload });
+    append_checksum(data);
+    return to_base58(data);
+}
+
+std::string to_base64(data_slice data)
+{
+    const auto size = data.size();
+    const auto whole = size / 3 * 3;
+    const auto source = data.begin();
+    std::string encoded((size + 2) / 3 * 4, '=');
+    auto target = encoded.begin();
+
+    for (size_t index = 0; index < whole; index += 3)
+    {
+        const auto word = (uint32_t(source[index]) << 16) |
+            (uint32_t(source[index + 1]) << 8) | source[index + 2];
+
+        *target++ = base64_digits[(word >> 18) & 0x3f];
+        *target++ = base64_digits[(word >> 12) & 0x3f];
+        *target++ = base64_digits[(word >> 6) & 0x3f];
+        *target++ = base64_digits[word & 0x3f];
+    }
+
+    // The last word is padded.
+    const auto remainder = size - whole;
+    if (remainder != 0)
+    {
+        auto word = uint32_t(source[whole]) << 16;
+        if (remainder == 2)
+            word |= uint32_t(source[whole + 1]) << 8;
+
+        *target++ = base64_digits[(word >> 18) & 0x3f];
+        *target++ = base64_digits[(word >> 12) & 0x3f];
+        if (remainder == 2)
+            *target++ = base64_digits[(word >> 6) & 0x3f];
+    }
+
+    return encoded;
+}
+
+bool from_base64(data_chunk& out, const std::string& in)
+{
+    const auto size = in.size();
+    if (size % 4 != 0)
+        return false;
+
+    size_t padding = 0;
+    if (size != 0 && in[size - 1] == '=')
+        padding = in[size - 2] == '=' ? 2 : 1;
+
+    // Padding is excluded from the digits, so '=' elsewhere is invalid.
+    const auto digits = size - padding;
+    data_chunk decoded(size / 4 * 3);
+    uint16_t flags = 0;
+
+    for (size_t index = 0, target = 0; index < size; index += 4, target += 3)
+    {
+        uint32_t word = 0;
+        for (auto digit = index; digit < index + 4; ++digit)
+        {
+            const auto value = digit < digits ?
+                base64_values[static_cast<uint8_t>(in[digit])] : 0;
+
+            flags |= value;
+            word = (word << 6) | (value & 0x3f);
+        }
+
+        decoded[target] = static_cast<uint8_t>(word >> 16);
+        decoded[target + 1] = static_cast<uint8_t>(word >> 8);
+        decoded[target + 2] = static_cast<uint8_t>(word);
+    }
+
+    if ((flags & invalid) != 0)
+        return false;
+
+    decoded.resize(decoded.size() - padding);
+    out.swap(decoded);
+    return true;
+}
+
+} // namespace explorer
+} // namespace libbitcoin
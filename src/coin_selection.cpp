@@ -0,0 +1,158 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/coin_selection.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+using namespace std::chrono;
+using namespace bc::system;
+
+// The clock is sampled at this interval of search steps.
+static const size_t clock_interval = 1024;
+
+// Depth-first search over inclusion of each value (in descending order).
+// A branch is pruned once it cannot reach the target or has overshot the
+// window, and a value is not included when its equal predecessor was
+// excluded, as that branch has already been explored.
+bool branch_and_bound(std::vector<size_t>& out,
+    const std::vector<uint64_t>& values, uint64_t target,
+    uint64_t cost_of_change, size_t steps,
+    const steady_clock::time_point& deadline)
+{
+    const auto upper = target + cost_of_change;
+
+    uint64_t available = 0;
+    for (const auto value: values)
+        available += value;
+
+    if (available < target)
+        return false;
+
+    std::vector<size_t> selection;
+    uint64_t selected = 0;
+    auto best_excess = max_uint64;
+
+    for (size_t step = 0, index = 0; step < steps; ++step, ++index)
+    {
+        if (step % clock_interval == 0 && steady_clock::now() > deadline)
+            break;
+
+        auto backtrack = false;
+
+        if (selected + available < target || selected > upper)
+        {
+            backtrack = true;
+        }
+        else if (selected >= target)
+        {
+            const auto excess = selected - target;
+            if (excess < best_excess || (excess == best_excess &&
+                selection.size() < out.size()))
+            {
+                best_excess = excess;
+                out = selection;
+            }
+
+            // An exact match cannot be improved upon.
+            if (excess == 0)
+                break;
+
+            backtrack = true;
+        }
+
+        if (backtrack)
+        {
+            if (selection.empty())
+                break;
+
+            // Restore the values passed over since the last inclusion.
+            for (--index; index > selection.back(); --index)
+                available += values[index];
+
+            // Exclude the last inclusion and continue with its successor.
+            selected -= values[index];
+            selection.pop_back();
+            continue;
+        }
+
+        const auto value = values[index];
+        available -= value;
+
+        const auto skip = index > 0 &&
+            (selection.empty() || selection.back() != index - 1) &&
+            value == values[index - 1];
+
+        if (!skip)
+        {
+            selection.push_back(index);
+            selected += value;
+        }
+    }
+
+    return best_excess != max_uint64;
+}
+
+bool largest_first(std::vector<size_t>& out,
+    const std::vector<uint64_t>& values, uint64_t target)
+{
+    uint64_t selected = 0;
+    for (size_t index = 0; index < values.size(); ++index)
+    {
+        out.push_back(index);
+        selected += values[index];
+
+        if (selected >= target)
+            return true;
+    }
+
+    return false;
+}
+
+bool select_coins(std::vector<size_t>& out, bool& changeless,
+    const std::vector<uint64_t>& values, uint64_t target,
+    uint64_t change_fee, uint64_t dust, uint64_t cost_of_change,
+    size_t steps, const steady_clock::time_point& deadline)
+{
+    out.clear();
+    changeless = branch_and_bound(out, values, target, cost_of_change,
+        steps, deadline);
+
+    if (changeless)
+        return true;
+
+    out.clear();
+    if (largest_first(out, values, target + change_fee + dust))
+        return true;
+
+    // Values that cannot fund change of at least dust leave it to the fee.
+    out.clear();
+    changeless = largest_first(out, values, target);
+    return changeless;
+}
+
+} // namespace explorer
+} // namespace libbitcoin
@@ -0,0 +1,89 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/address-batch.hpp>
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <boost/algorithm/string.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/codec.hpp>
+#include <bitcoin/explorer/decoded_address.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+using namespace bc::system;
+
+console_result address_batch::invoke(std::ostream& output,
+    std::ostream& error)
+{
+    // Bound parameters.
+    const auto& file = get_file_option();
+    const auto key = get_key_option();
+    const auto valid = get_valid_option();
+    const uint8_t p2kh_version =
+        get_wallet_pay_to_public_key_hash_version_setting();
+    const uint8_t p2sh_version =
+        get_wallet_pay_to_script_hash_version_setting();
+    const auto prefix = witness_prefix(get_network_identifier_setting());
+
+    std::unique_ptr<ifstream> stream;
+    if (!file.empty() && file.string() != BX_STDIO_PATH_SENTINEL)
+    {
+        stream.reset(new ifstream(file.string()));
+        if (!stream->good())
+        {
+            error << format(BX_ADDRESS_BATCH_FILE_FAILURE) % file.string()
+                << std::endl;
+            return console_result::failure;
+        }
+    }
+
+    const auto decode = [&](std::string& out, const std::string& line)
+    {
+        decoded_address address;
+        const auto okay = decode_address(address, boost::trim_copy(line),
+            p2kh_version, p2sh_version, prefix);
+
+        if (valid)
+            out += okay ? "true" : "false";
+        else if (!okay)
+            out += BX_ADDRESS_BATCH_INVALID;
+        else if (key)
+            out += to_base16(payments_key(address));
+        else
+            out += to_base16(data_slice(address.hash.data(),
+                address.hash.data() + address.size));
+
+        out += '\n';
+    };
+
+    std::istream& input = stream ? *stream : get_input();
+    write_lines(output, input, decode);
+    return console_result::okay;
+}
+
+} //namespace commands
+} //namespace explorer
+} //namespace libbitcoin
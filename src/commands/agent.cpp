@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <bitcoin/explorer/commands/agent.hpp>
+
+#include <chrono>
+#include <csignal>
+#include <iostream>
+#include <thread>
+#include <bitcoin/client.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/relay.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+using namespace std::chrono;
+using namespace bc::client;
+using namespace bc::system;
+
+// The agent checks its duration and stop signal at this interval.
+static const milliseconds poll_interval(100);
+
+// Set by an interrupt or termination, so that the relay removes its sockets.
+static volatile std::sig_atomic_t stop_signaled = 0;
+
+static void handle_stop(int)
+{
+    stop_signaled = 1;
+}
+
+console_result agent::invoke(std::ostream& output, std::ostream& error)
+{
+    // Bound parameters.
+    const auto duration = get_duration_option();
+    const auto path = get_agent_path(*this);
+
+    if (path.empty())
+    {
+        error << BX_AGENT_PATH_REQUIRED << std::endl;
+        return console_result::failure;
+    }
+
+    // The agent connects to the server directly, never to itself.
+    const auto connection = get_connection(*this, false);
+
+    explorer::relay relay(connection, get_server_hedge_url_setting(),
+        get_server_hedge_server_public_key_setting(),
+        get_server_request_timeout_milliseconds_setting(),
+        get_server_hedge_percentile_setting());
+
+    if (!relay.start(path))
+    {
+        error << format(BX_AGENT_BIND_FAILURE) % path.string() << std::endl;
+        return console_result::failure;
+    }
+
+    output << format(BX_AGENT_STARTED) % connection.server << std::endl;
+
+    const auto deadline = steady_clock::now() + seconds(duration);
+
+    stop_signaled = 0;
+    const auto interrupt = std::signal(SIGINT, handle_stop);
+    const auto terminate = std::signal(SIGTERM, handle_stop);
+
+    while (stop_signaled == 0 &&
+        (duration == 0 || steady_clock::now() < deadline))
+        std::this_thread::sleep_for(poll_interval);
+
+    if (interrupt != SIG_ERR)
+        std::signal(SIGINT, interrupt);
+
+    if (terminate != SIG_ERR)
+        std::signal(SIGTERM, terminate);
+
+    relay.stop();
+    relay.write_report(output);
+    return console_result::okay;
+}
+
+} //namespace commands
+} //namespace explorer
+} //namespace libbitcoin
@@ -20,6 +20,7 @@
 
 #include <iostream>
 #include <bitcoin/system.hpp>
+#include <bitcoin/explorer/codec.hpp>
 #include <bitcoin/explorer/define.hpp>
 
 namespace libbitcoin {
@@ -33,9 +34,9 @@ console_result base58_decode::invoke(std::ostream& output,
     std::ostream& error)
 {
     // Bound parameters.
-    const auto& base58 = get_base58_argument();
+    const data_chunk& data = get_base58_argument();
 
-    output << base16(base58) << std::endl;
+    output << to_base16(data) << std::endl;
     return console_result::okay;
 }
 
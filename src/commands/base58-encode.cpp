@@ -20,6 +20,7 @@
 
 #include <iostream>
 #include <bitcoin/system.hpp>
+#include <bitcoin/explorer/codec.hpp>
 #include <bitcoin/explorer/define.hpp>
 
 namespace libbitcoin {
@@ -32,9 +33,9 @@ using namespace bc::system::config;
 console_result base58_encode::invoke(std::ostream& output, std::ostream& error)
 {
     // Bound parameters.
-    const auto& base16 = get_base16_argument();
+    const data_chunk& data = get_base16_argument();
 
-    output << base58(base16) << std::endl;
+    output << to_base58(data) << std::endl;
     return console_result::okay;
 }
 
@@ -20,6 +20,7 @@
 
 #include <iostream>
 #include <bitcoin/system.hpp>
+#include <bitcoin/explorer/codec.hpp>
 #include <bitcoin/explorer/define.hpp>
 
 namespace libbitcoin {
@@ -32,9 +33,9 @@ using namespace bc::system::config;
 console_result base64_encode::invoke(std::ostream& output, std::ostream& error)
 {
     // Bound parameters.
-    const auto& data = get_data_argument();
+    const data_chunk& data = get_data_argument();
 
-    output << base64(data) << std::endl;
+    output << to_base64(data) << std::endl;
     return console_result::okay;
 }
 
@@ -19,17 +19,24 @@
 
 #include <bitcoin/explorer/commands/broadcast-tx.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <csignal>
 #include <future>
 #include <iostream>
+#include <map>
 #include <mutex>
+#include <set>
+#include <string>
+#include <vector>
 #include <boost/filesystem.hpp>
 #include <boost/format.hpp>
 #include <boost/core/null_deleter.hpp>
 #include <bitcoin/network.hpp>
 #include <bitcoin/explorer/callback_state.hpp>
+#include <bitcoin/explorer/completion.hpp>
 #include <bitcoin/explorer/define.hpp>
 #include <bitcoin/explorer/utility.hpp>
 
@@ -43,26 +50,245 @@ using namespace bc::network;
 using namespace bc::system;
 
 static const uint32_t hosts_pool_capacity = 1000;
-static std::promise<code> complete;
+// Raced by the console stop signal and the network.
+static completion complete;
 
-// Manage the race between console stop and network stop.
-static void stop(const code& ec)
+// Handle the console stop signal.
+static void handle_stop(int)
 {
-    static std::once_flag stop_mutex;
-    std::call_once(stop_mutex, [&](){ complete.set_value(ec); });
+    complete.stop(error::service_stopped);
 }
 
-// Handle the console stop signal.
-static void handle_stop(int)
+// Send the one transaction directly to each node.
+static void send_one(p2p& network, callback_state& state,
+    const tx_type& transaction)
 {
-    stop(error::service_stopped);
+    message::transaction tx(transaction);
+
+    const auto send_handler = [&state](const code& ec)
+    {
+        // If error keep trying.
+        if (ec)
+            return;
+
+        // Handle each successful send.
+        state.output(BX_SEND_TX_P2P_OUTPUT);
+        --state;
+
+        // If done visiting nodes set complete.
+        if (state.stopped())
+            complete.stop(ec);
+    };
+
+    const auto connect_handler = [&tx, send_handler](const code& ec,
+        channel::ptr node)
+    {
+        // If error keep trying.
+        if (ec)
+            return true;
+
+        // Send and resubscribe to connections.
+        node->send(tx, send_handler);
+        return true;
+    };
+
+    const auto run_handler = [&state](const code& ec)
+    {
+        if (!state.succeeded(ec))
+            complete.stop(ec);
+    };
+
+    const auto start_handler = [&state, &network, connect_handler,
+        run_handler](const code& ec)
+    {
+        if (!state.succeeded(ec))
+        {
+            complete.stop(ec);
+            return;
+        }
+
+        network.subscribe_connection(connect_handler);
+        network.run(run_handler);
+    };
+
+    // Connect to the specified number of hosts from the host pool.
+    // This attempts to maintain the set of connections, so it will always
+    // eventually achieve the target, and sometimes go over due to the race.
+    network.start(start_handler);
+
+    // Wait until stopped and capture if console stop code.
+    state.succeeded(complete.get_future().get());
+
+    // Ensure successful shutdown before handler state is destroyed.
+    network.close();
+}
+
+// Announce the batch to each node over the one channel, serving each request.
+// Requested transactions are sent without awaiting prior sends, so each
+// channel pipelines its sends. Channels remain open until all transactions
+// have been requested by the number of nodes or the duration is exhausted.
+static void send_batch(p2p& network, callback_state& state,
+    const std::vector<tx_type>& transactions, size_t nodes,
+    uint32_t duration_seconds)
+{
+    std::mutex mutex;
+    size_t announced = 0;
+    size_t connected = 0;
+    std::vector<std::set<std::string>> requested(transactions.size());
+    std::map<hash_digest, size_t> index;
+    std::vector<message::transaction> txs;
+    std::vector<message::inventory> announcements;
+
+    txs.reserve(transactions.size());
+    for (const auto& transaction: transactions)
+    {
+        index.emplace(transaction.hash(), txs.size());
+        txs.emplace_back(transaction);
+    }
+
+    // Inventory messages are limited in size, so split as necessary.
+    for (size_t start = 0; start < txs.size(); start += max_inventory)
+    {
+        const auto end = std::min(txs.size(), start + max_inventory);
+        message::inventory_vector::list inventories;
+        inventories.reserve(end - start);
+
+        for (auto position = start; position < end; ++position)
+            inventories.emplace_back(
+                message::inventory_vector::type_id::transaction,
+                txs[position].hash());
+
+        announcements.emplace_back(std::move(inventories));
+    }
+
+    // Complete once each transaction has been requested by all nodes. A node
+    // that requests a transaction more than once is counted once.
+    const auto accepted = [&]()
+    {
+        return std::all_of(requested.begin(), requested.end(),
+            [nodes](const std::set<std::string>& peers)
+            {
+                return peers.size() >= nodes;
+            });
+    };
+
+    const auto connect_handler = [&](const code& ec, channel::ptr node)
+    {
+        // If error keep trying.
+        if (ec)
+            return true;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            // Retain connections in excess of the target without using them.
+            if (connected >= nodes)
+                return true;
+
+            ++connected;
+            ++announced;
+        }
+
+        // Replace a dropped node so that the target may still be achieved.
+        node->subscribe_stop([&](const code&)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            --connected;
+        });
+
+        node->subscribe<message::get_data>([&, node](const code& ec,
+            message::get_data::const_ptr request)
+        {
+            if (ec)
+                return false;
+
+            for (const auto& inventory: request->inventories())
+            {
+                if (!inventory.is_transaction_type())
+                    continue;
+
+                const auto it = index.find(inventory.hash());
+                if (it == index.end())
+                    continue;
+
+                const auto position = it->second;
+                const auto peer = node->authority().to_string();
+
+                node->send(txs[position], [&, position, peer](const code& ec)
+                {
+                    if (ec)
+                        return;
+
+                    std::lock_guard<std::mutex> lock(mutex);
+                    requested[position].insert(peer);
+
+                    if (accepted())
+                        complete.stop(error::success);
+                });
+            }
+
+            return true;
+        });
+
+        for (const auto& announcement: announcements)
+            node->send(announcement, [](const code&) {});
+
+        return true;
+    };
+
+    const auto run_handler = [&state](const code& ec)
+    {
+        if (!state.succeeded(ec))
+            complete.stop(ec);
+    };
+
+    const auto start_handler = [&state, &network, connect_handler,
+        run_handler](const code& ec)
+    {
+        if (!state.succeeded(ec))
+        {
+            complete.stop(ec);
+            return;
+        }
+
+        network.subscribe_connection(connect_handler);
+        network.run(run_handler);
+    };
+
+    network.start(start_handler);
+
+    // Wait until all are requested, the duration expires or stopped.
+    auto result = complete.get_future();
+    if (result.wait_for(std::chrono::seconds(duration_seconds)) ==
+        std::future_status::timeout)
+        complete.stop(error::channel_timeout);
+
+    // Ensure successful shutdown before handler state is destroyed.
+    network.close();
+
+    // Expiration of the duration is not a failure.
+    const auto ec = result.get();
+    if (ec != error::channel_timeout && !state.succeeded(ec))
+        return;
+
+    // A transaction requested by no node has not been accepted.
+    for (size_t position = 0; position < txs.size(); ++position)
+    {
+        state.output(format(BX_BROADCAST_TX_ACCEPTANCE) %
+            encode_hash(txs[position].hash()) % requested[position].size() %
+            announced);
+
+        if (requested[position].empty())
+            state.set_result(console_result::failure);
+    }
 }
 
 console_result broadcast_tx::invoke(std::ostream& output, std::ostream& error)
 {
     // Bound parameters.
     const auto nodes = get_nodes_option();
-    const tx_type& transaction = get_transaction_argument();
+    const auto duration_seconds = get_duration_option();
+    const auto& transactions = get_transactions_argument();
 
     // Configuration settings.
     //-------------------------------------------------------------------------
@@ -128,78 +354,27 @@ console_result broadcast_tx::invoke(std::ostream& output, std::ostream& error)
     // Network operations.
     //-------------------------------------------------------------------------
 
+    complete.restart();
     p2p network(settings);
     callback_state state(error, output);
-    message::transaction tx(transaction);
 
     // Increment state to the required number of node connections.
     while (state < nodes)
         ++state;
 
-    // Zero nodes specified.
-    if (state.stopped())
+    // Zero nodes or no transactions specified.
+    if (state.stopped() || transactions.empty())
         return console_result::okay;
 
     // Catch C signals for aborting the program.
     signal(SIGTERM, handle_stop);
     signal(SIGINT, handle_stop);
 
-    const auto send_handler = [&state](const code& ec)
-    {
-        // If error keep trying.
-        if (ec)
-            return;
-
-        // Handle each successful send.
-        state.output(BX_SEND_TX_P2P_OUTPUT);
-        --state;
-
-        // If done visiting nodes set complete.
-        if (state.stopped())
-            stop(ec);
-    };
-
-    const auto connect_handler = [&tx, send_handler](const code& ec,
-        channel::ptr node)
-    {
-        // If error keep trying.
-        if (ec)
-            return true;
-
-        // Send and resubscribe to connections.
-        node->send(tx, send_handler);
-        return true;
-    };
-
-    const auto run_handler = [&state](const code& ec)
-    {
-        if (!state.succeeded(ec))
-            stop(ec);
-    };
-
-    const auto start_handler = [&state, &network, connect_handler,
-        run_handler](const code& ec)
-    {
-        if (!state.succeeded(ec))
-        {
-            stop(ec);
-            return;
-        }
-
-        network.subscribe_connection(connect_handler);
-        network.run(run_handler);
-    };
-
-    // Connect to the specified number of hosts from the host pool.
-    // This attempts to maintain the set of connections, so it will always
-    // eventually achieve the target, and sometimes go over due to the race.
-    network.start(start_handler);
-
-    // Wait until stopped and capture if console stop code.
-    state.succeeded(complete.get_future().get());
-
-    // Ensure successful shutdown before return.
-    network.close();
+    if (transactions.size() == 1)
+        send_one(network, state, transactions.front());
+    else
+        send_batch(network, state, { transactions.begin(),
+            transactions.end() }, nodes, duration_seconds);
 
     return state.get_result();
 }
@@ -0,0 +1,263 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <bitcoin/explorer/commands/compute-filters.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <bitcoin/client.hpp>
+#include <bitcoin/explorer/basic_filter.hpp>
+#include <bitcoin/explorer/callback_state.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/display.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+using namespace bc::client;
+using namespace bc::system;
+using namespace bc::system::chain;
+
+// Blocks are retrieved and computed in windows of this many heights, which
+// must be strictly less than the server's filter header request limit.
+static const uint32_t window_size = 100;
+
+console_result compute_filters::invoke(std::ostream& output,
+    std::ostream& error)
+{
+    // Bound parameters.
+    const auto start_height = get_height_argument();
+    const auto count = get_count_option();
+    const auto connection = get_connection(*this);
+
+    if (count == 0)
+    {
+        error << BX_COMPUTE_FILTERS_COUNT_REQUIRED << std::endl;
+        return console_result::failure;
+    }
+
+    obelisk_client client(connection.retries);
+    if (!client.connect(connection))
+    {
+        display_connection_failure(error, connection.server);
+        return console_result::failure;
+    }
+
+    callback_state state(error, output);
+
+    const auto threads = std::max(1u, std::thread::hardware_concurrency());
+    const auto stop_height = static_cast<uint64_t>(start_height) + count;
+
+    size_t verified = 0;
+    hash_digest header = null_hash;
+
+    for (uint64_t first = start_height; first < stop_height;
+        first += window_size)
+    {
+        const auto size = static_cast<size_t>(
+            std::min<uint64_t>(window_size, stop_height - first));
+        const auto base = static_cast<uint32_t>(first);
+        const auto last = static_cast<uint32_t>(first + size - 1);
+
+        // Blocks, served filters and served filter headers in one batch.
+        std::vector<block> blocks(size);
+        std::vector<data_chunk> served(size);
+        message::compact_filter_headers headers;
+
+        for (size_t index = 0; index < size; ++index)
+        {
+            const auto height = static_cast<uint32_t>(base + index);
+
+            auto on_block = [&state, &blocks, index](const code& ec,
+                const block& block)
+            {
+                if (state.succeeded(ec))
+                    blocks[index] = block;
+            };
+
+            auto on_filter = [&state, &served, index](const code& ec,
+                const message::compact_filter& filter)
+            {
+                if (state.succeeded(ec))
+                    served[index] = filter.filter();
+            };
+
+            client.blockchain_fetch_block(on_block, height);
+            client.blockchain_fetch_compact_filter(on_filter,
+                neutrino_filter_type, height);
+        }
+
+        auto on_headers = [&state, &headers](const code& ec,
+            const message::compact_filter_headers& response)
+        {
+            if (state.succeeded(ec))
+                headers = response;
+        };
+
+        client.blockchain_fetch_compact_filter_headers(on_headers,
+            neutrino_filter_type, base, last);
+
+        client.wait();
+
+        if (state.get_result() != console_result::okay)
+            return state.get_result();
+
+        const auto& served_hashes = headers.filter_hashes();
+        if (served_hashes.size() != size)
+        {
+            state.error(format(BX_COMPUTE_FILTERS_HEADERS_INVALID) % base);
+            return console_result::failure;
+        }
+
+        // The chain is anchored to the served header preceding the range.
+        if (first == start_height)
+            header = headers.previous_filter_header();
+
+        // Index the window's transactions, caching their hashes before the
+        // parallel phase, and retrieve the remaining previous transactions.
+        transaction_index confirmed;
+        transaction_map previous;
+
+        for (const auto& block: blocks)
+            for (const auto& tx: block.transactions())
+                confirmed.emplace(tx.hash(), &tx);
+
+        for (const auto& block: blocks)
+        {
+            for (const auto& tx: block.transactions())
+            {
+                if (tx.is_coinbase())
+                    continue;
+
+                for (const auto& input: tx.inputs())
+                {
+                    const auto& hash = input.previous_output().hash();
+                    if (confirmed.find(hash) != confirmed.end() ||
+                        previous.find(hash) != previous.end())
+                        continue;
+
+                    // Reserve the entry so that each is requested once.
+                    auto& entry = previous[hash];
+
+                    auto on_done = [&state, &entry](const code& ec,
+                        const transaction& tx)
+                    {
+                        if (state.succeeded(ec))
+                            entry = tx;
+                    };
+
+                    client.transaction_pool_fetch_transaction(on_done, hash);
+                }
+            }
+        }
+
+        client.wait();
+
+        if (state.get_result() != console_result::okay)
+            return state.get_result();
+
+        // Hash, sort and encode each block's elements in parallel.
+        std::vector<data_chunk> filters(size);
+        std::vector<uint8_t> resolved(size, 0);
+        std::atomic<size_t> next(0);
+
+        auto compute = [&]()
+        {
+            for (auto index = next++; index < size; index = next++)
+            {
+                data_stack elements;
+                const auto& block = blocks[index];
+
+                if (filter_elements(elements, block, confirmed, previous))
+                {
+                    filters[index] = compute_filter(block.hash(), elements);
+                    resolved[index] = 1;
+                }
+            }
+        };
+
+        std::vector<std::thread> workers;
+        const auto pool = std::min<size_t>(threads, size);
+        for (size_t thread = 0; thread < pool; ++thread)
+            workers.emplace_back(compute);
+
+        for (auto& worker: workers)
+            worker.join();
+
+        for (size_t index = 0; index < size; ++index)
+        {
+            const auto height = base + index;
+            const auto hash = encode_hash(blocks[index].hash());
+
+            // The chain continues from the served filter hash so that
+            // subsequent blocks remain verifiable.
+            if (resolved[index] == 0)
+            {
+                state.error(format(BX_COMPUTE_FILTERS_PREVOUT_MISSING) %
+                    hash % height);
+                state.set_result(console_result::failure);
+                header = bitcoin_hash(build_chunk(
+                    { served_hashes[index], header }));
+                continue;
+            }
+
+            const auto& filter = filters[index];
+            header = filter_header(filter, header);
+            output << height << " " << hash << " " << encode_hash(header)
+                << std::endl;
+
+            auto valid = true;
+
+            if (filter != served[index])
+            {
+                state.error(format(BX_COMPUTE_FILTERS_FILTER_MISMATCH) %
+                    hash % height);
+                valid = false;
+            }
+
+            if (bitcoin_hash(filter) != served_hashes[index])
+            {
+                state.error(format(BX_COMPUTE_FILTERS_HEADER_MISMATCH) %
+                    hash % height);
+                valid = false;
+            }
+
+            if (valid)
+                ++verified;
+            else
+                state.set_result(console_result::failure);
+        }
+    }
+
+    if (verified != count)
+        state.error(format(BX_COMPUTE_FILTERS_SUMMARY) % verified % count);
+
+    return state.get_result();
+}
+
+} //namespace commands
+} //namespace explorer
+} //namespace libbitcoin
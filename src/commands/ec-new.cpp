@@ -33,26 +33,72 @@ namespace commands {
 
 using namespace bc::system;
 
+evaluation ec_new::evaluate(config::ec_private& result,
+    const system::config::base16& seed)
+{
+    const data_chunk& entropy = seed;
+    if (entropy.size() < minimum_seed_size)
+        return evaluation::short_seed;
+
+    const ec_secret secret(new_key(entropy));
+    if (secret == null_hash)
+        return evaluation::invalid_key;
+
+    result = config::ec_private(secret);
+    return evaluation::okay;
+}
+
 console_result ec_new::invoke(std::ostream& output, std::ostream& error)
 {
     // Bound parameters.
-    const data_chunk& seed = get_seed_argument();
+    const auto& seed = get_seed_argument();
+    const auto count = get_count_option();
 
-    if (seed.size() < minimum_seed_size)
+    if (count > 0)
     {
-        error << BX_EC_NEW_SHORT_SEED << std::endl;
-        return console_result::failure;
+        const auto bit_length = get_bit_length_option();
+        if (bit_length < minimum_seed_bits || bit_length % byte_bits != 0)
+        {
+            error << BX_EC_NEW_BIT_LENGTH_UNSUPPORTED << std::endl;
+            return console_result::failure;
+        }
+
+        const auto writer = [](std::ostream& stream,
+            const data_chunk& value) -> bool
+        {
+            config::ec_private secret;
+            if (evaluate(secret, system::config::base16(value)) !=
+                evaluation::okay)
+                return false;
+
+            stream << secret << "\n";
+            return true;
+        };
+
+        switch (write_seeded(output, count, bit_length / byte_bits, writer))
+        {
+            case evaluation::okay:
+                return console_result::okay;
+            case evaluation::no_entropy:
+                error << BX_ENTROPY_UNAVAILABLE << std::endl;
+                return console_result::failure;
+            default:
+                error << BX_EC_NEW_INVALID_KEY << std::endl;
+                return console_result::failure;
+        }
     }
 
-    ec_secret secret(new_key(seed));
-    if (secret == null_hash)
+    config::ec_private secret;
+    const auto outcome = evaluate(secret, seed);
+    if (outcome != evaluation::okay)
     {
-        error << BX_EC_NEW_INVALID_KEY << std::endl;
+        error << (outcome == evaluation::short_seed ? BX_EC_NEW_SHORT_SEED :
+            BX_EC_NEW_INVALID_KEY) << std::endl;
         return console_result::failure;
     }
 
     // We don't use bc::ec_private serialization (WIF) here.
-    output << config::ec_private(secret) << std::endl;
+    output << secret << std::endl;
     return console_result::okay;
 }
 
@@ -20,6 +20,7 @@
 
 #include <iostream>
 #include <bitcoin/system.hpp>
+#include <bitcoin/explorer/codec.hpp>
 #include <bitcoin/explorer/define.hpp>
 
 namespace libbitcoin {
@@ -29,13 +30,22 @@ namespace commands {
 using namespace bc::system;
 using namespace bc::system::wallet;
 
+evaluation ec_to_address::evaluate(payment_address& result,
+    const ec_public& ec_public_key, const config::byte& version)
+{
+    result = payment_address(ec_public_key, version);
+    return evaluation::okay;
+}
+
 console_result ec_to_address::invoke(std::ostream& output, std::ostream& error)
 {
     // Bound parameters.
     const auto& point = get_ec_public_key_argument();
     const auto version = get_version_option();
 
-    output << payment_address(point, version) << std::endl;
+    payment_address address;
+    evaluate(address, point, version);
+    output << to_base58(address.to_payment()) << std::endl;
     return console_result::okay;
 }
 
@@ -29,18 +29,27 @@ namespace commands {
 using namespace bc::system;
 using namespace bc::system::wallet;
 
-console_result ec_to_public::invoke(std::ostream& output, std::ostream& error)
+evaluation ec_to_public::evaluate(ec_public& result,
+    const config::ec_private& ec_private_key, const bool& uncompressed)
 {
-    const auto& secret = get_ec_private_key_argument();
-    const auto& uncompressed = get_uncompressed_option();
-
     ec_compressed point;
 
     // It is not possible for the validated secret to fail conversion.
-    /* bool */ secret_to_public(point, secret);
+    /* bool */ secret_to_public(point, ec_private_key);
 
     // Serialize to the original compression state.
-    output << ec_public(point, !uncompressed) << std::endl;
+    result = ec_public(point, !uncompressed);
+    return evaluation::okay;
+}
+
+console_result ec_to_public::invoke(std::ostream& output, std::ostream& error)
+{
+    const auto& secret = get_ec_private_key_argument();
+    const auto& uncompressed = get_uncompressed_option();
+
+    ec_public point;
+    evaluate(point, secret, uncompressed);
+    output << point << std::endl;
     return console_result::okay;
 }
 
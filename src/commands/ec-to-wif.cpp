@@ -29,6 +29,20 @@ namespace commands {
 using namespace bc::system;
 using namespace bc::system::wallet;
 
+evaluation ec_to_wif::evaluate(ec_private& result,
+    const config::ec_private& ec_private_key, const bool& uncompressed,
+    const config::byte& version)
+{
+    // Payment address version is unused in this scenario.
+    const uint8_t payment_version = 0;
+
+    // ec_private requires a composite version.
+    const auto composite = ec_private::to_version(payment_version, version);
+
+    result = ec_private(ec_private_key, composite, !uncompressed);
+    return evaluation::okay;
+}
+
 console_result ec_to_wif::invoke(std::ostream& output, std::ostream& error)
 {
     // Bound parameters.
@@ -36,13 +50,9 @@ console_result ec_to_wif::invoke(std::ostream& output, std::ostream& error)
     const auto& uncompressed = get_uncompressed_option();
     const auto& wif_version = get_version_option();
 
-    // Payment address version is unused in this scenario.
-    const uint8_t payment_version = 0;
-
-    // ec_private requires a composite version.
-    const auto version = ec_private::to_version(payment_version, wif_version);
-
-    output << ec_private(secret, version, !uncompressed) << std::endl;
+    ec_private wif;
+    evaluate(wif, secret, uncompressed, wif_version);
+    output << wif << std::endl;
     return console_result::okay;
 }
 
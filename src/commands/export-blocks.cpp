@@ -0,0 +1,173 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/export-blocks.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <boost/filesystem.hpp>
+#include <bitcoin/client.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/block_columns.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/display.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+using namespace bc::client;
+using namespace bc::system;
+
+// The number of block requests outstanding at once.
+static const size_t range_size = 16;
+
+console_result export_blocks::invoke(std::ostream& output, std::ostream& error)
+{
+    // Bound parameters.
+    const auto& directory_option = get_directory_option();
+    const size_t start = get_start_option();
+    const auto stop_option = get_stop_option();
+    const uint8_t p2kh_version =
+        get_wallet_pay_to_public_key_hash_version_setting();
+    const uint8_t p2sh_version =
+        get_wallet_pay_to_script_hash_version_setting();
+    const auto directory = directory_option.empty() ?
+        boost::filesystem::current_path() : directory_option;
+
+    const auto connection = get_connection(*this);
+
+    obelisk_client client(connection.retries);
+    if (!client.connect(connection))
+    {
+        display_connection_failure(error, connection.server);
+        return console_result::failure;
+    }
+
+    size_t stop = stop_option;
+    if (stop == 0)
+    {
+        code result;
+        const auto on_done = [&](const code& ec, size_t value)
+        {
+            result = ec;
+            stop = value;
+        };
+
+        client.blockchain_fetch_last_height(on_done);
+        client.wait();
+
+        if (result)
+        {
+            error << format(BX_EXPORT_BLOCKS_HEIGHT_FAILURE) %
+                result.message() << std::endl;
+            return console_result::failure;
+        }
+    }
+
+    if (start > stop)
+    {
+        error << format(BX_EXPORT_BLOCKS_INVALID_RANGE) % start % stop
+            << std::endl;
+        return console_result::failure;
+    }
+
+    column_writer writer(directory);
+    if (!writer.open())
+    {
+        error << format(BX_EXPORT_BLOCKS_WRITE_FAILURE) % directory.string()
+            << std::endl;
+        return console_result::failure;
+    }
+
+    // Each range is decomposed in parallel while the next is fetched, and
+    // the decomposed blocks are then written in order.
+    size_t failed = 0;
+    chain::block::list blocks;
+    chain::block::list extracting;
+    std::future<block_columns::list> extracted;
+
+    const auto complete = [&]() -> bool
+    {
+        for (const auto& columns: extracted.get())
+        {
+            if (!writer.write(columns))
+            {
+                error << format(BX_EXPORT_BLOCKS_WRITE_FAILURE) %
+                    directory.string() << std::endl;
+                return false;
+            }
+        }
+
+        return true;
+    };
+
+    const auto fetch_block = [&client](
+        const range_handler<chain::block>& handler, uint32_t height)
+    {
+        client.blockchain_fetch_block(handler, height);
+    };
+
+    for (auto next = start; next <= stop;)
+    {
+        const auto count = std::min(range_size, stop - next + 1);
+        const auto ec = fetch_range(client, blocks, next, count, failed,
+            fetch_block);
+
+        if (extracted.valid() && !complete())
+            return console_result::failure;
+
+        if (ec)
+        {
+            error << format(BX_EXPORT_BLOCKS_FETCH_FAILURE) % failed %
+                ec.message() << std::endl;
+            return console_result::failure;
+        }
+
+        extracting.swap(blocks);
+        extracted = std::async(std::launch::async, block_columns::extract,
+            std::cref(extracting), static_cast<uint32_t>(next), p2kh_version,
+            p2sh_version);
+
+        next += count;
+    }
+
+    if (extracted.valid() && !complete())
+        return console_result::failure;
+
+    if (!writer.close())
+    {
+        error << format(BX_EXPORT_BLOCKS_WRITE_FAILURE) % directory.string()
+            << std::endl;
+        return console_result::failure;
+    }
+
+    output << format(BX_EXPORT_BLOCKS_EXPORTED) % writer.blocks() %
+        writer.transactions() % writer.inputs() % writer.outputs() %
+        writer.addresses() << std::endl;
+    return console_result::okay;
+}
+
+} //namespace commands
+} //namespace explorer
+} //namespace libbitcoin
@@ -0,0 +1,246 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/fetch-block-txs.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <bitcoin/client.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/callback_state.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/display.hpp>
+#include <bitcoin/explorer/config/encoding.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+using namespace bc::client;
+using namespace bc::explorer::config;
+using namespace bc::system;
+
+// Write transactions in block order, each as soon as it and all preceding
+// transactions are obtained. Transactions obtained out of order are held,
+// so no transaction is requested beyond the limit past the next to write.
+class ordered_writer
+{
+public:
+    ordered_writer(callback_state& state, bool json, size_t count,
+        size_t limit)
+      : state_(state), json_(json), count_(count), limit_(limit),
+        failed_(false), claimed_(0), next_(0)
+    {
+    }
+
+    // Take the index of the next transaction to request, if within limit.
+    bool claim(size_t& index)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!claimable())
+            return false;
+
+        index = claimed_++;
+        return true;
+    }
+
+    // Wait until a transaction may be claimed, false if none remains.
+    bool wait_claimable()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        drained_.wait(lock, [this]()
+        {
+            return failed_ || claimed_ >= count_ || claimable();
+        });
+
+        return claimable();
+    }
+
+    void write(size_t index, const tx_type& tx)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (failed_)
+            return;
+
+        pending_.emplace(index, tx);
+        const auto head = next_;
+
+        for (auto it = pending_.begin(); it != pending_.end() &&
+            it->first == next_; it = pending_.erase(it), ++next_)
+            state_.output(property_tree(it->second, json_));
+
+        if (next_ == head)
+            return;
+
+        lock.unlock();
+        drained_.notify_all();
+    }
+
+    void fail(const code& ec)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (failed_)
+            return;
+
+        failed_ = true;
+        state_.succeeded(ec);
+        lock.unlock();
+        drained_.notify_all();
+    }
+
+private:
+    bool claimable() const
+    {
+        return !failed_ && claimed_ < count_ && claimed_ - next_ < limit_;
+    }
+
+    callback_state& state_;
+    const bool json_;
+    const size_t count_;
+    const size_t limit_;
+
+    // These are protected by the mutex.
+    bool failed_;
+    size_t claimed_;
+    size_t next_;
+    std::map<size_t, tx_type> pending_;
+    std::mutex mutex_;
+    std::condition_variable drained_;
+};
+
+console_result fetch_block_txs::invoke(std::ostream& output,
+    std::ostream& error)
+{
+    // Bound parameters.
+    const auto connections = std::max(get_connections_option(), 1u);
+    const auto window = std::max(get_window_option(), 1u);
+    const auto& encoding = get_format_option();
+    const auto height = get_height_option();
+    const hash_digest& hash = get_hash_option();
+    const auto witness = get_witness_option();
+    const auto connection = get_connection(*this);
+
+    std::vector<std::unique_ptr<obelisk_client>> clients;
+    for (size_t index = 0; index < connections; ++index)
+    {
+        clients.emplace_back(new obelisk_client(connection.retries));
+        if (!clients.back()->connect(connection))
+        {
+            display_connection_failure(error, connection.server);
+            return console_result::failure;
+        }
+    }
+
+    callback_state state(error, output, encoding);
+
+    // This enables json-style array formatting.
+    const auto json = encoding == encoding_engine::json;
+
+    hash_list hashes;
+    auto on_hashes = [&state, &hashes](const code& ec,
+        const hash_list& result)
+    {
+        if (state.succeeded(ec))
+            hashes = result;
+    };
+
+    // Height is ignored if both are specified.
+    // Use the null_hash as sentinel to determine whether to use height or hash.
+    auto& first = *clients.front();
+    if (hash == null_hash)
+        first.blockchain_fetch_block_transaction_hashes(on_hashes, height);
+    else
+        first.blockchain_fetch_block_transaction_hashes(on_hashes, hash);
+
+    first.wait();
+
+    if (state.get_result() != console_result::okay)
+        return state.get_result();
+
+    // At most the combined window of the connections is held or outstanding.
+    ordered_writer writer(state, json, hashes.size(), window * connections);
+
+    // Each connection takes the next transaction as each of its requests
+    // completes, so faster connections obtain more of the block. Handlers
+    // are invoked on the thread of their connection, by client.wait.
+    const auto retrieve = [&](obelisk_client& client)
+    {
+        size_t outstanding = 0;
+        std::function<void()> request;
+        request = [&]()
+        {
+            size_t index;
+            while (outstanding < window && writer.claim(index))
+            {
+                const auto on_done = [&, index](const code& ec,
+                    const tx_type& tx)
+                {
+                    --outstanding;
+                    if (ec)
+                    {
+                        writer.fail(ec);
+                        return;
+                    }
+
+                    writer.write(index, tx);
+                    request();
+                };
+
+                ++outstanding;
+                if (witness)
+                    client.transaction_pool_fetch_transaction2(on_done,
+                        hashes[index]);
+                else
+                    client.transaction_pool_fetch_transaction(on_done,
+                        hashes[index]);
+            }
+        };
+
+        // A connection left idle by the limit resumes as the head drains.
+        while (writer.wait_claimable())
+        {
+            request();
+            client.wait();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t index = 1; index < clients.size(); ++index)
+        threads.emplace_back(retrieve, std::ref(*clients[index]));
+
+    retrieve(first);
+
+    for (auto& thread: threads)
+        thread.join();
+
+    return state.get_result();
+}
+
+} //namespace commands
+} //namespace explorer
+} //namespace libbitcoin
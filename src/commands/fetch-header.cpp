@@ -25,6 +25,7 @@
 #include <bitcoin/explorer/callback_state.hpp>
 #include <bitcoin/explorer/define.hpp>
 #include <bitcoin/explorer/display.hpp>
+#include <bitcoin/explorer/header_chain.hpp>
 #include <bitcoin/explorer/config/encoding.hpp>
 #include <bitcoin/explorer/utility.hpp>
 
@@ -42,6 +43,19 @@ console_result fetch_header::invoke(std::ostream& output, std::ostream& error)
     const auto height = get_height_option();
     const hash_digest& hash = get_hash_option();
     const encoding& encoding = get_format_option();
+
+    // A header by height is served from the local chain if it is confirmed,
+    // as the server may have reorganized the top of the local chain.
+    header_chain local(get_server_headers_file_setting());
+    chain::header header;
+
+    if (hash == null_hash && local.open() &&
+        local.get_confirmed(header, height))
+    {
+        write_stream(output, property_tree(header), encoding);
+        return console_result::okay;
+    }
+
     const auto connection = get_connection(*this);
 
     obelisk_client client(connection.retries);
@@ -40,7 +40,7 @@ console_result fetch_height::invoke(std::ostream& output, std::ostream& error)
     // Bound parameters.
     const auto& server_url = get_server_url_argument();
     const auto& public_key = get_public_key_argument();
-    auto connection = get_connection(*this);
+    auto connection = get_connection(*this, server_url.empty());
 
     // For this command only, allow command line to override server config.
     if (!server_url.empty())
@@ -19,11 +19,16 @@
 
 #include <bitcoin/explorer/commands/fetch-public-key.hpp>
 
+#include <algorithm>
+#include <deque>
 #include <iostream>
+#include <map>
 #include <bitcoin/client.hpp>
 #include <bitcoin/explorer/callback_state.hpp>
+#include <bitcoin/explorer/decoded_address.hpp>
 #include <bitcoin/explorer/define.hpp>
 #include <bitcoin/explorer/display.hpp>
+#include <bitcoin/explorer/utility.hpp>
 
 namespace libbitcoin {
 namespace explorer {
@@ -31,45 +36,161 @@ namespace commands {
 
 using namespace bc::client;
 using namespace bc::system;
+using namespace bc::system::chain;
+using namespace bc::system::wallet;
 
-console_result fetch_public_key::invoke(std::ostream& output, std::ostream& error)
+// True if the point is paid by the key as p2pkh, p2wpkh or p2sh-p2wpkh.
+static bool pays(const hash_digest& key, const data_chunk& point)
 {
-    //// Bound parameters.
-    //const auto& address = get_payment_address_argument();
-    //const auto retries = get_general_retries_setting();
-    //const auto timeout = get_general_wait_setting();
-    //const auto& server = get_general_network_setting() == BX_TESTNET ?
-    //    get_testnet_url_setting() : get_mainnet_url_setting());
-
-    //czmqpp::context context;
-    //obelisk_client client(context, period_ms(timeout), retries);
-
-    //if (client.connect(server))
-    //{
-    //    display_connection_failure(error, server);
-    //    return console_result::failure;
-    //}
-
-    //callback_state state(error, output);
-
-    //auto on_done = [&state, &address](const client::history_list& rows)
-    //{
-    //    // TODO: get first rows tx where it (spend.hash) is not null.
-    //    // TODO: convert tx to pubkey and then stop.
-    //};
-
-    //auto on_error = [&state](const std::error_code& error)
-    //{
-    //    state.succeeded(error);
-    //};
-
-    //client.get_codec()->address_fetch_history(on_error, on_done, address);
-    //client.resolve_callbacks();
-
-    //return state.get_result();
-
-    error << BX_FETCH_PUBLIC_KEY_NOT_IMPLEMENTED << std::endl;
-    return console_result::failure;
+    decoded_address address{ false, false, short_hash_size, {} };
+    const auto hash = bitcoin_short_hash(point);
+    std::copy(hash.begin(), hash.end(), address.hash.begin());
+
+    if (payments_key(address) == key)
+        return true;
+
+    address.witness = true;
+    if (payments_key(address) == key)
+        return true;
+
+    // The p2sh redeem script of a p2wpkh key is its witness program.
+    data_chunk program{ static_cast<uint8_t>(opcode::push_size_0),
+        static_cast<uint8_t>(short_hash_size) };
+    extend_data(program, hash);
+    const auto script_hash = bitcoin_short_hash(program);
+    std::copy(script_hash.begin(), script_hash.end(), address.hash.begin());
+    address.witness = false;
+    address.script = true;
+    return payments_key(address) == key;
+}
+
+// A spend reveals the public key as the last witness element (p2wpkh) or as
+// the last push of the input script (p2pkh, p2sh-p2wpkh). A candidate is
+// accepted only if it is paid by the key, as other spends may end in a point.
+static bool reveal(ec_public& out, const tx_input_type& input,
+    const hash_digest& key)
+{
+    const auto accept = [&](const data_chunk& candidate)
+    {
+        const ec_public point(candidate);
+        if (!point || !pays(key, candidate))
+            return false;
+
+        out = point;
+        return true;
+    };
+
+    const auto& stack = input.witness().stack();
+    if (!stack.empty() && accept(stack.back()))
+        return true;
+
+    const auto& operations = input.script().operations();
+    return !operations.empty() && accept(operations.back().data());
+}
+
+console_result fetch_public_key::invoke(std::ostream& output,
+    std::ostream& error)
+{
+    // Bound parameters.
+    const auto& keys = get_keys_argument();
+    const auto connection = get_connection(*this);
+
+    obelisk_client client(connection.retries);
+    if (!client.connect(connection))
+    {
+        display_connection_failure(error, connection.server);
+        return console_result::failure;
+    }
+
+    callback_state state(error, output);
+
+    // The spends of each key, in history order, not yet searched.
+    std::map<hash_digest, std::deque<input_point>> spends;
+    std::map<hash_digest, ec_public> revealed;
+
+    for (const auto& value: keys)
+    {
+        const hash_digest key = value;
+
+        auto on_done = [&state, &spends, key](const code& ec,
+            const history::list& rows)
+        {
+            if (!state.succeeded(ec))
+                return;
+
+            auto& points = spends[key];
+            for (const auto& row: rows)
+                if (row.spend.hash() != null_hash)
+                    points.push_back(row.spend);
+        };
+
+        client.blockchain_fetch_history4(on_done, key);
+    }
+
+    client.wait();
+
+    if (state.get_result() != console_result::okay)
+        return state.get_result();
+
+    // Each round fetches the next spend of every unresolved key in one
+    // pipelined batch, until each key is revealed or its spends exhausted.
+    auto searching = true;
+    while (searching)
+    {
+        searching = false;
+
+        for (auto& entry: spends)
+        {
+            const auto& key = entry.first;
+            auto& points = entry.second;
+
+            if (points.empty() || revealed.find(key) != revealed.end())
+                continue;
+
+            const auto point = points.front();
+            points.pop_front();
+            searching = true;
+
+            auto on_done = [&state, &revealed, &key, point](const code& ec,
+                const tx_type& tx)
+            {
+                if (!state.succeeded(ec))
+                    return;
+
+                const auto& inputs = tx.inputs();
+                ec_public public_key;
+
+                if (point.index() < inputs.size() &&
+                    reveal(public_key, inputs[point.index()], key))
+                    revealed.emplace(key, public_key);
+            };
+
+            client.transaction_pool_fetch_transaction2(on_done, point.hash());
+        }
+
+        client.wait();
+
+        if (state.get_result() != console_result::okay)
+            return state.get_result();
+    }
+
+    for (const auto& value: keys)
+    {
+        const hash_digest key = value;
+        const auto it = revealed.find(key);
+
+        if (it == revealed.end())
+        {
+            state.error(format(BX_FETCH_PUBLIC_KEY_NOT_FOUND) %
+                encode_hash(key));
+            state.set_result(console_result::failure);
+            continue;
+        }
+
+        output << encode_hash(key) << " " << it->second << std::endl;
+    }
+
+    return state.get_result();
 }
 
 } //namespace commands
@@ -0,0 +1,131 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/fetch-wallet.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <vector>
+#include <bitcoin/client.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/callback_state.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/display.hpp>
+#include <bitcoin/explorer/prop_tree.hpp>
+#include <bitcoin/explorer/utility.hpp>
+#include <bitcoin/explorer/wallet_scanner.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+using namespace bc::client;
+using namespace bc::explorer::config;
+using namespace bc::system;
+
+console_result fetch_wallet::invoke(std::ostream& output,
+    std::ostream& error)
+{
+    // Bound parameters.
+    const auto& encoding = get_format_option();
+    const auto gap = get_gap_option();
+    const auto public_version = get_public_version_option();
+    const uint8_t version = get_version_option();
+    const auto window = std::max(get_window_option(), 1u);
+    const auto& hd_keys = get_hd_public_keys_argument();
+    const auto connection = get_connection(*this);
+
+    std::vector<wallet::hd_public> keys;
+    for (const auto& hd_key: hd_keys)
+    {
+        keys.emplace_back(hd_key, public_version);
+        if (!keys.back())
+        {
+            error << format(BX_FETCH_WALLET_INVALID_KEY) % keys.size()
+                << std::endl;
+            return console_result::failure;
+        }
+    }
+
+    obelisk_client client(connection.retries);
+    if (!client.connect(connection))
+    {
+        display_connection_failure(error, connection.server);
+        return console_result::failure;
+    }
+
+    callback_state state(error, output, encoding);
+
+    // This enables json-style array formatting.
+    const auto json = encoding == encoding_engine::json;
+
+    wallet_scanner scanner(keys, gap, version);
+    size_t outstanding = 0;
+    auto failed = false;
+
+    // Handlers are invoked on this thread, by client.wait. Each completed
+    // request is replaced by requests for the addresses it makes necessary,
+    // so the window of the scan advances as its results arrive.
+    std::function<void()> request;
+    request = [&]()
+    {
+        size_t chain;
+        uint32_t index;
+        hash_digest key;
+
+        while (!failed && outstanding < window &&
+            scanner.next(chain, index, key))
+        {
+            const auto on_done = [&, chain, index](const code& ec,
+                const history::list& rows)
+            {
+                --outstanding;
+                if (failed)
+                    return;
+
+                if (!state.succeeded(ec))
+                {
+                    failed = true;
+                    return;
+                }
+
+                scanner.complete(chain, index, rows);
+                request();
+            };
+
+            ++outstanding;
+            client.blockchain_fetch_history4(on_done, key);
+        }
+    };
+
+    request();
+    client.wait();
+
+    if (state.get_result() != console_result::okay)
+        return state.get_result();
+
+    state.output(prop_tree(scanner.used(), json));
+    return state.get_result();
+}
+
+} //namespace commands
+} //namespace explorer
+} //namespace libbitcoin
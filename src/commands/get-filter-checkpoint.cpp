@@ -26,12 +26,12 @@
 #include <csignal>
 #include <future>
 #include <iostream>
-#include <mutex>
 #include <boost/filesystem.hpp>
 #include <boost/format.hpp>
 #include <boost/core/null_deleter.hpp>
 #include <bitcoin/network.hpp>
 #include <bitcoin/explorer/callback_state.hpp>
+#include <bitcoin/explorer/completion.hpp>
 #include <bitcoin/explorer/define.hpp>
 #include <bitcoin/explorer/utility.hpp>
 
@@ -45,19 +45,13 @@ using namespace bc::network;
 using namespace bc::system;
 using namespace std::placeholders;
 
-static std::promise<code> complete;
-
-// Manage the race between console stop and network stop.
-static void stop(const code& ec)
-{
-    static std::once_flag stop_mutex;
-    std::call_once(stop_mutex, [&](){ complete.set_value(ec); });
-}
+// Raced by the console stop signal and the network.
+static completion complete;
 
 // Handle the console stop signal.
 static void handle_stop(int)
 {
-    stop(error::service_stopped);
+    complete.stop(error::service_stopped);
 }
 
 console_result get_filter_checkpoint::invoke(
@@ -102,6 +96,7 @@ console_result get_filter_checkpoint::invoke(
     // Network operations.
     //-------------------------------------------------------------------------
 
+    complete.restart();
     p2p network(settings);
     callback_state state(error, output);
     message::get_compact_filter_checkpoint request(
@@ -120,14 +115,14 @@ console_result get_filter_checkpoint::invoke(
         if (state.succeeded(ec))
             state.output(property_tree(*response, json));
 
-        stop(ec);
+        complete.stop(ec);
         return false;
     };
 
     const auto send_handler = [&state](const code& ec)
     {
         if (!state.succeeded(ec))
-            stop(ec);
+            complete.stop(ec);
     };
 
     const auto connect_handler = [&state, &receive_handler, &request,
@@ -135,7 +130,7 @@ console_result get_filter_checkpoint::invoke(
     {
         if (!state.succeeded(ec))
         {
-            stop(ec);
+            complete.stop(ec);
             return;
         }
 
@@ -145,7 +140,7 @@ console_result get_filter_checkpoint::invoke(
         if (!peer_bip157)
         {
             state.error(BX_BIP157_UNSUPPORTED);
-            stop(error::posix_to_error_code(console_result::failure));
+            complete.stop(error::posix_to_error_code(console_result::failure));
             return;
         }
 
@@ -157,7 +152,7 @@ console_result get_filter_checkpoint::invoke(
     const auto start_handler = [&state](const code& ec)
     {
         if (!state.succeeded(ec))
-            stop(ec);
+            complete.stop(ec);
     };
 
     // We must start the service so that stop can be honored.
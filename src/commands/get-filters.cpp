@@ -21,17 +21,25 @@
 
 #include <bitcoin/explorer/commands/get-filters.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <csignal>
+#include <deque>
 #include <future>
 #include <iostream>
+#include <map>
 #include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
 #include <boost/filesystem.hpp>
 #include <boost/format.hpp>
 #include <boost/core/null_deleter.hpp>
 #include <bitcoin/network.hpp>
 #include <bitcoin/explorer/callback_state.hpp>
+#include <bitcoin/explorer/completion.hpp>
 #include <bitcoin/explorer/define.hpp>
 #include <bitcoin/explorer/utility.hpp>
 
@@ -40,23 +48,943 @@ namespace explorer {
 namespace commands {
 
 using namespace boost;
+using namespace std::chrono;
 using namespace bc::explorer::config;
 using namespace bc::network;
 using namespace bc::system;
 
-static std::promise<code> complete;
+static const uint32_t hosts_pool_capacity = 1000;
+// Raced by the console stop signal and the network.
+static completion complete;
 
-// Manage the race between console stop and network stop.
-static void stop(const code& ec)
+// Handle the console stop signal.
+static void handle_stop(int)
 {
-    static std::once_flag stop_mutex;
-    std::call_once(stop_mutex, [&](){ complete.set_value(ec); });
+    complete.stop(error::service_stopped);
 }
 
-// Handle the console stop signal.
-static void handle_stop(int)
+// Parallel retrieval.
+//-----------------------------------------------------------------------------
+
+// Each request must span a distance strictly less than this.
+static const uint32_t batch_size = 100;
+
+// BIP157 filter header checkpoints are spaced at this block interval.
+static const uint32_t checkpoint_interval = 1000;
+
+// A batch outstanding longer than this factor of the node's average batch
+// latency, or the minimum, is reassigned and the node is penalized.
+static const size_t stall_factor = 4;
+static const auto stall_minimum = seconds(5);
+
+// A node penalized this many times is dropped from the set.
+static const size_t node_failure_limit = 3;
+
+// A batch assigned this many times without success fails the retrieval.
+static const size_t batch_attempt_limit = 5;
+
+// Stall detection interval of the waiting thread.
+static const auto stall_interval = seconds(1);
+
+// Headers not obtained within this duration fail the retrieval.
+static const auto headers_timeout = seconds(30);
+
+// The latency average weights the latest sample at 1/latency_weight.
+static const size_t latency_weight = 4;
+
+// Filters not committed to by a checkpoint are confirmed by the filter
+// headers of this many nodes other than the node that served them.
+static const size_t confirmations = 2;
+
+// Manage a set of nodes retrieving filter batches in parallel. Batches are
+// assigned to idle nodes in order of measured latency, so that faster nodes
+// are used first and receive more requests. Nodes that stall or respond with
+// unexpected filters are penalized and their batch is reassigned. Once all
+// filters are obtained they are verified against the filter header
+// checkpoints, and batches in any failing interval are retrieved again. The
+// ends of the range that only partially cover a checkpoint interval are
+// verified against filter headers. An end that closes at a checkpoint is
+// anchored by it, otherwise each of its batches must be confirmed by the
+// filter headers of other nodes than the one that served it.
+class filter_retrieval
 {
-    stop(error::service_stopped);
+public:
+    filter_retrieval(callback_state& state, uint32_t start_height,
+        const hash_digest& start_hash, const hash_digest& stop_hash)
+      : state_(state),
+        start_height_(start_height),
+        stop_hash_(stop_hash),
+        hashes_({ start_hash }),
+        headers_node_(nullptr),
+        completed_(0),
+        failed_(false)
+    {
+    }
+
+    // Add a connected BIP157 node to the set.
+    void add(network::channel::ptr node)
+    {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        nodes_.emplace(node.get(), node_state(node));
+
+        node->subscribe_stop([this, node](const code&)
+        {
+            handle_stop(node.get());
+        });
+
+        node->subscribe<message::compact_filter>(
+            [this, node](const code& ec,
+                std::shared_ptr<const message::compact_filter> response)
+            {
+                return handle_filter(ec, response, node);
+            });
+
+        node->subscribe<message::compact_filter_headers>(
+            [this, node](const code& ec, filter_headers_ptr response)
+            {
+                return handle_filter_headers(ec, response, node);
+            });
+
+        // One node at a time obtains the block hashes and the checkpoints.
+        if (headers_node_ == nullptr && batches_.empty())
+        {
+            request_headers(node);
+            return;
+        }
+
+        for (auto& entry: segments_)
+            request_segment(entry.first, entry.second);
+
+        dispatch();
+    }
+
+    // Reassign batches of stalled nodes, called periodically.
+    void check()
+    {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        const auto now = steady_clock::now();
+
+        if (headers_node_ != nullptr && now - headers_sent_ > headers_timeout)
+        {
+            fail(BX_GET_FILTERS_HEADERS_FAILURE);
+            return;
+        }
+
+        for (auto& entry: nodes_)
+        {
+            auto& node = entry.second;
+            if (!node.busy)
+                continue;
+
+            const auto average = duration_cast<steady_clock::duration>(
+                node.latency * stall_factor);
+            const auto limit = std::max<steady_clock::duration>(
+                stall_minimum, average);
+
+            if (now - batches_[node.batch].sent > limit)
+                penalize(entry.first, 1);
+        }
+
+        dispatch();
+    }
+
+    // Fail the retrieval once its duration is exhausted, reporting the
+    // filters that were obtained but not confirmed as unverified.
+    void expire(uint32_t duration_seconds)
+    {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        if (failed_)
+            return;
+
+        for (const auto& entry: segments_)
+            state_.error(format(BX_GET_FILTERS_UNVERIFIED) %
+                entry.second.first % entry.second.last);
+
+        fail((format(BX_GET_FILTERS_TIMEOUT) % duration_seconds).str());
+    }
+
+    // Write the retrieved filters in height order.
+    void write(bool json)
+    {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+        for (const auto& filter: filters_)
+            state_.output(property_tree(filter, json));
+    }
+
+private:
+    typedef std::shared_ptr<const message::headers> headers_ptr;
+    typedef std::shared_ptr<const message::compact_filter_checkpoint>
+        checkpoint_ptr;
+    typedef std::shared_ptr<const message::compact_filter> filter_ptr;
+    typedef std::shared_ptr<const message::compact_filter_headers>
+        filter_headers_ptr;
+
+    struct batch_state
+    {
+        uint32_t start;
+        uint32_t count;
+        size_t attempts;
+        size_t received;
+        bool complete;
+        network::channel* node;
+        steady_clock::time_point sent;
+    };
+
+    typedef std::set<network::channel*> node_set;
+
+    // An end of the range that only partially covers a checkpoint interval.
+    // The confirming and disputing nodes are recorded by batch.
+    struct segment_state
+    {
+        uint32_t first;
+        uint32_t last;
+        bool anchored;
+        node_set asked;
+        node_set answered;
+        std::map<size_t, node_set> confirmed;
+        std::map<size_t, node_set> disputed;
+    };
+
+    struct node_state
+    {
+        node_state(network::channel::ptr node)
+          : channel(node), busy(false), dropped(false), batch(0),
+            failures(0), latency(duration<double>::zero())
+        {
+        }
+
+        network::channel::ptr channel;
+        bool busy;
+        bool dropped;
+        size_t batch;
+        size_t failures;
+        duration<double> latency;
+    };
+
+    // Headers.
+    // ------------------------------------------------------------------------
+
+    void request_headers(network::channel::ptr node)
+    {
+        headers_node_ = node.get();
+
+        if (hashes_.back() == stop_hash_)
+        {
+            request_checkpoint(node);
+            return;
+        }
+
+        node->subscribe<message::headers>(
+            [this, node](const code& ec, headers_ptr response)
+            {
+                return handle_headers(ec, response, node);
+            });
+
+        send_headers_request(node);
+    }
+
+    void send_headers_request(network::channel::ptr node)
+    {
+        headers_sent_ = steady_clock::now();
+        const message::get_headers request({ hashes_.back() }, stop_hash_);
+        node->send(request, [this](const code& ec)
+        {
+            if (ec)
+                fail(BX_GET_FILTERS_HEADERS_FAILURE);
+        });
+    }
+
+    bool handle_headers(const code& ec, headers_ptr response,
+        network::channel::ptr node)
+    {
+        if (ec)
+        {
+            fail(BX_GET_FILTERS_HEADERS_FAILURE);
+            return false;
+        }
+
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        const auto& headers = response->elements();
+
+        if (headers.empty())
+        {
+            fail(BX_GET_FILTERS_HEADERS_FAILURE);
+            return false;
+        }
+
+        // Ignore block announcements, which do not connect to the sequence.
+        if (headers.front().previous_block_hash() != hashes_.back())
+            return true;
+
+        for (const auto& header: headers)
+        {
+            if (header.previous_block_hash() != hashes_.back())
+            {
+                fail(BX_GET_FILTERS_HEADERS_FAILURE);
+                return false;
+            }
+
+            hashes_.push_back(header.hash());
+
+            if (hashes_.back() == stop_hash_)
+            {
+                request_checkpoint(node);
+                return false;
+            }
+        }
+
+        send_headers_request(node);
+        return true;
+    }
+
+    // Checkpoints.
+    // ------------------------------------------------------------------------
+
+    void request_checkpoint(network::channel::ptr node)
+    {
+        node->subscribe<message::compact_filter_checkpoint>(
+            [this](const code& ec, checkpoint_ptr response)
+            {
+                if (ec)
+                    return false;
+
+                std::lock_guard<std::recursive_mutex> lock(mutex_);
+                checkpoints_ = response->filter_headers();
+                headers_node_ = nullptr;
+                start_batches();
+                return false;
+            });
+
+        const message::get_compact_filter_checkpoint request(
+            neutrino_filter_type, stop_hash_);
+
+        node->send(request, [this](const code& ec)
+        {
+            if (ec)
+                fail(BX_GET_FILTERS_HEADERS_FAILURE);
+        });
+    }
+
+    // Batches.
+    // ------------------------------------------------------------------------
+
+    void start_batches()
+    {
+        const auto count = static_cast<uint32_t>(hashes_.size());
+        filters_.resize(count);
+
+        for (uint32_t offset = 0; offset < count; offset += batch_size)
+        {
+            const auto size = std::min(batch_size, count - offset);
+            pending_.push_back(batches_.size());
+            batches_.push_back(batch_state{ start_height_ + offset, size, 0, 0,
+                false, nullptr, steady_clock::now() });
+        }
+
+        dispatch();
+    }
+
+    // Assign pending batches to idle nodes, lowest average latency first.
+    // Nodes without a measurement have zero latency and so are tried first.
+    void dispatch()
+    {
+        std::vector<node_state*> idle;
+        for (auto& entry: nodes_)
+            if (!entry.second.busy && !entry.second.dropped)
+                idle.push_back(&entry.second);
+
+        std::sort(idle.begin(), idle.end(),
+            [](const node_state* left, const node_state* right)
+            {
+                return left->latency < right->latency;
+            });
+
+        for (auto node: idle)
+        {
+            if (pending_.empty())
+                return;
+
+            const auto index = pending_.front();
+            pending_.pop_front();
+            auto& batch = batches_[index];
+
+            if (++batch.attempts > batch_attempt_limit)
+            {
+                fail((format(BX_GET_FILTERS_BATCH_FAILURE) % batch.start %
+                    (batch.start + batch.count - 1)).str());
+                return;
+            }
+
+            batch.node = node->channel.get();
+            batch.received = 0;
+            batch.sent = steady_clock::now();
+            node->busy = true;
+            node->batch = index;
+
+            const auto stop = hash_at(batch.start + batch.count - 1);
+            const message::get_compact_filters request(neutrino_filter_type,
+                batch.start, stop);
+
+            node->channel->send(request, [](const code&)
+            {
+                // A failed send stops the channel, which is handled on stop.
+            });
+        }
+    }
+
+    bool handle_filter(const code& ec, filter_ptr response,
+        network::channel::ptr channel)
+    {
+        if (ec)
+            return false;
+
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        const auto it = nodes_.find(channel.get());
+        if (it == nodes_.end() || it->second.dropped)
+            return false;
+
+        auto& node = it->second;
+
+        // Unsolicited filters are misbehavior.
+        if (!node.busy)
+        {
+            penalize(channel.get(), 1);
+            dispatch();
+            return true;
+        }
+
+        auto& batch = batches_[node.batch];
+        const auto height = batch.start + batch.received;
+
+        // Filters are returned in height order, anything else is misbehavior.
+        if (response->filter_type() != neutrino_filter_type ||
+            response->block_hash() != hash_at(height))
+        {
+            penalize(channel.get(), 1);
+            dispatch();
+            return true;
+        }
+
+        filters_[height - start_height_] = *response;
+
+        if (++batch.received < batch.count)
+            return true;
+
+        // The latency average is weighted toward the latest batch.
+        const duration<double> sample = steady_clock::now() - batch.sent;
+        node.latency = (node.latency == duration<double>::zero()) ? sample :
+            (node.latency * (latency_weight - 1) + sample) / latency_weight;
+
+        node.busy = false;
+        batch.complete = true;
+
+        if (++completed_ == batches_.size())
+            verify();
+        else
+            dispatch();
+
+        return true;
+    }
+
+    // Verification.
+    // ------------------------------------------------------------------------
+
+    hash_digest hash_at(uint32_t height) const
+    {
+        return hashes_[height - start_height_];
+    }
+
+    // The filter header commits to the filter and the previous header.
+    static hash_digest filter_header(const data_chunk& filter,
+        const hash_digest& previous)
+    {
+        return bitcoin_hash(build_chunk({ bitcoin_hash(filter), previous }));
+    }
+
+    // The height of the last block of the range.
+    uint32_t top_height() const
+    {
+        return static_cast<uint32_t>(start_height_ + hashes_.size() - 1);
+    }
+
+    // The first and last heights of the checkpoint interval of the height.
+    // The first interval includes genesis and so is one block longer.
+    static uint32_t interval_first(uint32_t height)
+    {
+        return height <= checkpoint_interval ? 0 :
+            (height - 1) / checkpoint_interval * checkpoint_interval + 1;
+    }
+
+    static uint32_t interval_last(uint32_t height)
+    {
+        return height <= checkpoint_interval ? checkpoint_interval :
+            ((height - 1) / checkpoint_interval + 1) * checkpoint_interval;
+    }
+
+    // Obtain the checkpoint at the height, if the height is checkpointed.
+    bool checkpoint_at(uint32_t height, hash_digest& out) const
+    {
+        const size_t index = height / checkpoint_interval;
+        if (height == 0 || height % checkpoint_interval != 0 ||
+            index > checkpoints_.size())
+            return false;
+
+        out = checkpoints_[index - 1];
+        return true;
+    }
+
+    // Verify each checkpoint interval that lies entirely within the range.
+    // The first interval is verifiable only from genesis (null previous).
+    void verify()
+    {
+        const auto stop_height = top_height();
+
+        for (size_t index = 0; index < checkpoints_.size(); ++index)
+        {
+            const auto last = static_cast<uint32_t>((index + 1) *
+                checkpoint_interval);
+            const auto first = (index == 0) ? 0u : last -
+                checkpoint_interval + 1;
+
+            if (first < start_height_ || last > stop_height)
+                continue;
+
+            auto header = (index == 0) ? null_hash : checkpoints_[index - 1];
+            for (auto height = first; height <= last; ++height)
+                header = filter_header(
+                    filters_[height - start_height_].filter(), header);
+
+            if (header != checkpoints_[index])
+                retry(first, last, BX_GET_FILTERS_CHECKPOINT_MISMATCH);
+        }
+
+        if (completed_ == batches_.size())
+            request_segments();
+        else
+            dispatch();
+    }
+
+    // Request the filter headers of each end of the range that does not
+    // cover its checkpoint interval, completing if there is none.
+    void request_segments()
+    {
+        const auto stop_height = top_height();
+        segments_.clear();
+
+        if (interval_first(start_height_) != start_height_ ||
+            interval_last(start_height_) > stop_height)
+            add_segment(start_height_,
+                std::min(interval_last(start_height_), stop_height));
+
+        if (interval_last(stop_height) != stop_height &&
+            interval_last(start_height_) < stop_height)
+            add_segment(std::max(interval_first(stop_height),
+                start_height_), stop_height);
+
+        if (segments_.empty())
+        {
+            complete.stop(error::success);
+            return;
+        }
+
+        for (auto& entry: segments_)
+            request_segment(entry.first, entry.second);
+    }
+
+    void add_segment(uint32_t first, uint32_t last)
+    {
+        hash_digest anchor;
+        segment_state segment;
+        segment.first = first;
+        segment.last = last;
+        segment.anchored = checkpoint_at(last, anchor);
+        segments_.emplace(hash_at(last), segment);
+    }
+
+    // The batches of the segment, by index.
+    std::vector<size_t> segment_batches(const segment_state& segment) const
+    {
+        std::vector<size_t> out;
+        for (auto index = (segment.first - start_height_) / batch_size;
+            index <= (segment.last - start_height_) / batch_size; ++index)
+            out.push_back(index);
+
+        return out;
+    }
+
+    // An anchored segment is requested of one retained node at a time. An
+    // unanchored segment is requested of every retained node, as each node
+    // may confirm the batches served by the others.
+    void request_segment(const hash_digest& stop_hash,
+        segment_state& segment)
+    {
+        for (auto& entry: nodes_)
+        {
+            if (segment.anchored &&
+                segment.asked.size() > segment.answered.size())
+                return;
+
+            if (entry.second.dropped || segment.asked.count(entry.first) != 0)
+                continue;
+
+            segment.asked.insert(entry.first);
+            const message::get_compact_filter_headers request(
+                neutrino_filter_type, segment.first, stop_hash);
+
+            entry.second.channel->send(request, [](const code&)
+            {
+                // A failed send stops the channel, which is handled on stop.
+            });
+        }
+    }
+
+    // Match the served filter hashes to the retrieved filters, by height.
+    // False if the filter headers are malformed, do not connect to the
+    // previous checkpoint or, if anchored, to the closing checkpoint.
+    bool match_segment(std::vector<bool>& out, const segment_state& segment,
+        const message::compact_filter_headers& response) const
+    {
+        const auto first = segment.first;
+        const auto last = segment.last;
+        const auto& filter_hashes = response.filter_hashes();
+
+        if (response.filter_type() != neutrino_filter_type ||
+            filter_hashes.size() != last - first + 1)
+            return false;
+
+        hash_digest anchor;
+        auto header = response.previous_filter_header();
+
+        if ((first == 0 && header != null_hash) ||
+            (first != 0 && checkpoint_at(first - 1, anchor) &&
+                header != anchor))
+            return false;
+
+        out.clear();
+        for (auto height = first; height <= last; ++height)
+        {
+            const auto& filter = filters_[height - start_height_].filter();
+            const auto& filter_hash = filter_hashes[height - first];
+            out.push_back(filter_hash == bitcoin_hash(filter));
+            header = bitcoin_hash(build_chunk({ filter_hash, header }));
+        }
+
+        return !segment.anchored || (checkpoint_at(last, anchor) &&
+            header == anchor);
+    }
+
+    // The served filter hashes must match the retrieved filters, and the
+    // chain of filter headers must connect to the adjacent checkpoints.
+    bool handle_filter_headers(const code& ec, filter_headers_ptr response,
+        network::channel::ptr channel)
+    {
+        if (ec)
+            return false;
+
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        const auto it = segments_.find(response->stop_hash());
+        if (it == segments_.end())
+            return true;
+
+        auto& segment = it->second;
+        if (segment.asked.count(channel.get()) == 0 ||
+            !segment.answered.insert(channel.get()).second)
+            return true;
+
+        std::vector<bool> matched;
+        const auto valid = match_segment(matched, segment, *response);
+
+        if (segment.anchored)
+        {
+            if (!valid || std::find(matched.begin(), matched.end(), false) !=
+                matched.end())
+            {
+                const auto first = segment.first;
+                const auto last = segment.last;
+                segments_.clear();
+                retry(first, last, BX_GET_FILTERS_HEADERS_MISMATCH);
+                dispatch();
+                return true;
+            }
+
+            complete_segment(it);
+            return true;
+        }
+
+        // A node confirms or disputes each batch that it did not serve.
+        for (const auto index: segment_batches(segment))
+        {
+            const auto& batch = batches_[index];
+            if (batch.node == channel.get())
+                continue;
+
+            const auto begin = std::max(batch.start, segment.first);
+            const auto end = std::min(batch.start + batch.count - 1,
+                segment.last);
+
+            auto agrees = valid;
+            for (auto height = begin; agrees && height <= end; ++height)
+                agrees = matched[height - segment.first];
+
+            if (agrees)
+                segment.confirmed[index].insert(channel.get());
+            else
+                segment.disputed[index].insert(channel.get());
+        }
+
+        evaluate_segment(it);
+        return true;
+    }
+
+    // Complete the segment once each batch is confirmed, penalizing the
+    // nodes that disputed it. Retrieve again the batches that are disputed
+    // by enough nodes. Otherwise await further nodes, until the deadline.
+    void evaluate_segment(std::map<hash_digest, segment_state>::iterator it)
+    {
+        auto& segment = it->second;
+        std::vector<size_t> disputed;
+        auto confirmed = true;
+
+        for (const auto index: segment_batches(segment))
+        {
+            if (segment.confirmed[index].size() >= confirmations)
+                continue;
+
+            confirmed = false;
+            if (segment.disputed[index].size() >= confirmations)
+                disputed.push_back(index);
+        }
+
+        if (confirmed)
+        {
+            node_set liars;
+            for (const auto& entry: segment.disputed)
+                liars.insert(entry.second.begin(), entry.second.end());
+
+            complete_segment(it);
+
+            for (const auto liar: liars)
+                penalize(liar, 1);
+
+            return;
+        }
+
+        if (disputed.empty())
+            return;
+
+        segments_.clear();
+        for (const auto index: disputed)
+            retry(batches_[index].start, batches_[index].start +
+                batches_[index].count - 1, BX_GET_FILTERS_HEADERS_MISMATCH);
+
+        dispatch();
+    }
+
+    void complete_segment(std::map<hash_digest, segment_state>::iterator it)
+    {
+        segments_.erase(it);
+
+        if (segments_.empty())
+            complete.stop(error::success);
+    }
+
+    // Retrieve the interval again, penalizing the nodes that provided it.
+    void retry(uint32_t first, uint32_t last, const std::string& mismatch)
+    {
+        for (size_t index = 0; index < batches_.size(); ++index)
+        {
+            auto& batch = batches_[index];
+            const auto end = batch.start + batch.count - 1;
+
+            if (!batch.complete || end < first || batch.start > last)
+                continue;
+
+            if (batch.attempts >= batch_attempt_limit)
+            {
+                fail((format(mismatch) % first % last).str());
+                return;
+            }
+
+            const auto it = nodes_.find(batch.node);
+            if (it != nodes_.end() && ++it->second.failures >=
+                node_failure_limit)
+                drop(it->second);
+
+            batch.complete = false;
+            pending_.push_back(index);
+            --completed_;
+        }
+    }
+
+    // Failure.
+    // ------------------------------------------------------------------------
+
+    // A stopped node is dropped. If it was obtaining headers another node
+    // resumes from the last header obtained, and the filter headers that it
+    // was to provide are requested of another node.
+    void handle_stop(network::channel* channel)
+    {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        penalize(channel, node_failure_limit);
+
+        // The filter headers that it was to provide are requested again.
+        for (auto& entry: segments_)
+        {
+            auto& segment = entry.second;
+            if (segment.answered.count(channel) == 0 &&
+                segment.asked.erase(channel) != 0)
+                request_segment(entry.first, segment);
+        }
+
+        if (channel != headers_node_)
+            return;
+
+        headers_node_ = nullptr;
+
+        for (auto& entry: nodes_)
+        {
+            if (!entry.second.dropped)
+            {
+                request_headers(entry.second.channel);
+                return;
+            }
+        }
+    }
+
+    void penalize(network::channel* channel, size_t failures)
+    {
+        const auto it = nodes_.find(channel);
+        if (it == nodes_.end() || it->second.dropped)
+            return;
+
+        auto& node = it->second;
+
+        if (node.busy)
+        {
+            node.busy = false;
+            pending_.push_front(node.batch);
+        }
+
+        node.failures += failures;
+
+        if (node.failures >= node_failure_limit)
+            drop(node);
+    }
+
+    void drop(node_state& node)
+    {
+        node.dropped = true;
+        node.channel->stop(error::channel_stopped);
+    }
+
+    // The result is set here, so the completion is stopped with success and
+    // the failure is not reported again.
+    void fail(const std::string& message)
+    {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        if (failed_)
+            return;
+
+        failed_ = true;
+        state_.error(message);
+        state_.set_result(console_result::failure);
+        complete.stop(error::success);
+    }
+
+    callback_state& state_;
+    const uint32_t start_height_;
+    const hash_digest stop_hash_;
+
+    // These are protected by mutex, which is recursive because stopping a
+    // channel may invoke its stop handler on the calling thread.
+    hash_list hashes_;
+    hash_list checkpoints_;
+    network::channel* headers_node_;
+    steady_clock::time_point headers_sent_;
+    size_t completed_;
+    bool failed_;
+    std::deque<size_t> pending_;
+    std::vector<batch_state> batches_;
+    std::map<hash_digest, segment_state> segments_;
+    std::vector<message::compact_filter> filters_;
+    std::map<network::channel*, node_state> nodes_;
+    std::recursive_mutex mutex_;
+};
+
+static console_result retrieve_parallel(network::settings& settings,
+    callback_state& state, size_t peers, uint32_t duration_seconds,
+    uint32_t start_height, const hash_digest& start_hash,
+    const hash_digest& stop_hash, bool json)
+{
+    // Connections are made from the host pool.
+    settings.outbound_connections = static_cast<uint32_t>(peers);
+    settings.host_pool_capacity = std::max(settings.host_pool_capacity,
+        hosts_pool_capacity);
+
+    p2p network(settings);
+    filter_retrieval retrieval(state, start_height, start_hash, stop_hash);
+
+    // Nodes that do not signal BIP157 are stopped, so that their outbound
+    // connections are replaced from the host pool.
+    const auto connect_handler = [&retrieval](const code& ec,
+        network::channel::ptr node)
+    {
+        if (ec)
+            return true;
+
+        if ((node->peer_version()->services() &
+            message::version::service::node_compact_filters) != 0)
+            retrieval.add(node);
+        else
+            node->stop(error::channel_stopped);
+
+        return true;
+    };
+
+    const auto run_handler = [&state](const code& ec)
+    {
+        if (!state.succeeded(ec))
+            complete.stop(ec);
+    };
+
+    const auto start_handler = [&state, &network, connect_handler,
+        run_handler](const code& ec)
+    {
+        if (!state.succeeded(ec))
+        {
+            complete.stop(ec);
+            return;
+        }
+
+        network.subscribe_connection(connect_handler);
+        network.run(run_handler);
+    };
+
+    network.start(start_handler);
+
+    // Wait until stopped, periodically reassigning stalled batches. The
+    // retrieval fails if not complete within the duration, as may result
+    // from a lack of BIP157 nodes.
+    auto result = complete.get_future();
+    const auto deadline = steady_clock::now() + seconds(duration_seconds);
+    while (result.wait_for(stall_interval) == std::future_status::timeout)
+    {
+        if (steady_clock::now() >= deadline)
+            retrieval.expire(duration_seconds);
+        else
+            retrieval.check();
+    }
+
+    state.succeeded(result.get());
+
+    // Ensure successful shutdown before retrieval state is destroyed.
+    network.close();
+
+    if (state.get_result() == console_result::okay)
+        retrieval.write(json);
+
+    return state.get_result();
 }
 
 console_result get_filters::invoke(std::ostream& output,
@@ -66,9 +994,18 @@ console_result get_filters::invoke(std::ostream& output,
     const auto& host = get_host_option();
     const auto& port = get_port_option();
     const auto& encoding = get_format_option();
+    const auto peers = get_peers_option();
+    const auto duration_seconds = get_duration_option();
+    const hash_digest& start_hash = get_start_option();
     const hash_digest& stop_hash = get_hash_argument();
     const uint32_t start_height = get_height_argument();
 
+    if (peers > 0 && start_hash == null_hash)
+    {
+        error << BX_GET_FILTERS_START_REQUIRED << std::endl;
+        return console_result::failure;
+    }
+
     // Configuration settings.
     //-------------------------------------------------------------------------
 
@@ -102,10 +1039,8 @@ console_result get_filters::invoke(std::ostream& output,
     // Network operations.
     //-------------------------------------------------------------------------
 
-    p2p network(settings);
+    complete.restart();
     callback_state state(error, output);
-    message::get_compact_filters request(neutrino_filter_type,
-        start_height, stop_hash);
 
     // Catch C signals for aborting the program.
     signal(SIGTERM, handle_stop);
@@ -114,12 +1049,30 @@ console_result get_filters::invoke(std::ostream& output,
     // This enables json-style array formatting.
     const auto json = encoding == encoding_engine::json;
 
+    if (peers > 0)
+    {
+        const auto& seeds = get_network_seeds_setting();
+
+        if (!seeds.empty())
+            settings.seeds = seeds;
+
+        // Parallel connections are serviced by a thread per core.
+        settings.threads = std::max(1u, std::thread::hardware_concurrency());
+
+        return retrieve_parallel(settings, state, peers, duration_seconds,
+            start_height, start_hash, stop_hash, json);
+    }
+
+    p2p network(settings);
+    message::get_compact_filters request(neutrino_filter_type,
+        start_height, stop_hash);
+
     auto receive_handler = [&state, json, stop_hash](const code& ec,
         std::shared_ptr<const message::compact_filter> response)
     {
         if (!state.succeeded(ec))
         {
-            stop(ec);
+            complete.stop(ec);
             return false;
         }
 
@@ -128,7 +1081,7 @@ console_result get_filters::invoke(std::ostream& output,
         // Relying on response order for termination.
         auto received_final_response = (response->block_hash() == stop_hash);
         if (received_final_response)
-            stop(ec);
+            complete.stop(ec);
    
         return !received_final_response;
     };
@@ -136,7 +1089,7 @@ console_result get_filters::invoke(std::ostream& output,
     const auto send_handler = [&state](const code& ec)
     {
         if (!state.succeeded(ec))
-            stop(ec);
+            complete.stop(ec);
     };
 
     const auto connect_handler = [&state, &request, &receive_handler,
@@ -144,7 +1097,7 @@ console_result get_filters::invoke(std::ostream& output,
     {
         if (!state.succeeded(ec))
         {
-            stop(ec);
+            complete.stop(ec);
             return;
         }
 
@@ -154,7 +1107,7 @@ console_result get_filters::invoke(std::ostream& output,
         if (!peer_bip157)
         {
             state.error(BX_BIP157_UNSUPPORTED);
-            stop(error::service_stopped);
+            complete.stop(error::service_stopped);
             return;
         }
 
@@ -165,7 +1118,7 @@ console_result get_filters::invoke(std::ostream& output,
     const auto start_handler = [&state](const code& ec)
     {
         if (!state.succeeded(ec))
-            stop(ec);
+            complete.stop(ec);
     };
 
     // We must start the service so that stop can be honored.
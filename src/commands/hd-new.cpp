@@ -21,6 +21,7 @@
 #include <iostream>
 #include <bitcoin/system.hpp>
 #include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/utility.hpp>
 
 
 // The BX_HD_NEW_INVALID_KEY condition is uncovered by test.
@@ -31,25 +32,66 @@ namespace commands {
 
 using namespace bc::system;
 
+evaluation hd_new::evaluate(wallet::hd_private& result,
+    const system::config::base16& seed, const uint32_t& version)
+{
+    const data_chunk& entropy = seed;
+    if (entropy.size() < minimum_seed_size)
+        return evaluation::short_seed;
+
+    // We require the private version, but public is unused here.
+    const auto prefixes = wallet::hd_private::to_prefixes(version, 0);
+    result = wallet::hd_private(entropy, prefixes);
+    return result ? evaluation::okay : evaluation::invalid_key;
+}
+
 console_result hd_new::invoke(std::ostream& output, std::ostream& error)
 {
     // Bound parameters.
     const auto version = get_version_option();
-    const data_chunk& seed = get_seed_argument();
+    const auto& seed = get_seed_argument();
+    const auto count = get_count_option();
 
-    if (seed.size() < minimum_seed_size)
+    if (count > 0)
     {
-        error << BX_HD_NEW_SHORT_SEED << std::endl;
-        return console_result::failure;
-    }
+        const auto bit_length = get_bit_length_option();
+        if (bit_length < minimum_seed_bits || bit_length % byte_bits != 0)
+        {
+            error << BX_HD_NEW_BIT_LENGTH_UNSUPPORTED << std::endl;
+            return console_result::failure;
+        }
 
-    // We require the private version, but public is unused here.
-    const auto prefixes = wallet::hd_private::to_prefixes(version, 0);
-    const wallet::hd_private private_key(seed, prefixes);
+        const auto writer = [version](std::ostream& stream,
+            const data_chunk& value) -> bool
+        {
+            wallet::hd_private private_key;
+            if (evaluate(private_key, system::config::base16(value), version) !=
+                evaluation::okay)
+                return false;
+
+            stream << private_key << "\n";
+            return true;
+        };
+
+        switch (write_seeded(output, count, bit_length / byte_bits, writer))
+        {
+            case evaluation::okay:
+                return console_result::okay;
+            case evaluation::no_entropy:
+                error << BX_ENTROPY_UNAVAILABLE << std::endl;
+                return console_result::failure;
+            default:
+                error << BX_HD_NEW_INVALID_KEY << std::endl;
+                return console_result::failure;
+        }
+    }
 
-    if (!private_key)
+    wallet::hd_private private_key;
+    const auto outcome = evaluate(private_key, seed, version);
+    if (outcome != evaluation::okay)
     {
-        error << BX_HD_NEW_INVALID_KEY << std::endl;
+        error << (outcome == evaluation::short_seed ? BX_HD_NEW_SHORT_SEED :
+            BX_HD_NEW_INVALID_KEY) << std::endl;
         return console_result::failure;
     }
 
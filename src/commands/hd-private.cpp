@@ -29,6 +29,16 @@ namespace commands {
 
 using namespace bc::system;
 
+evaluation hd_private::evaluate(wallet::hd_private& result,
+    const wallet::hd_private& hd_private_key, const bool& hard,
+    const uint32_t& index)
+{
+    static constexpr auto first = wallet::hd_first_hardened_key;
+    const auto position = hard ? first + index : index;
+    result = hd_private_key.derive_private(position);
+    return result ? evaluation::okay : evaluation::invalid_key;
+}
+
 console_result hd_private::invoke(std::ostream& output, std::ostream& error)
 {
     // Bound parameters.
@@ -36,11 +46,9 @@ console_result hd_private::invoke(std::ostream& output, std::ostream& error)
     const auto index = get_index_option();
     const auto& private_key = get_hd_private_key_argument();
 
-    static constexpr auto first = wallet::hd_first_hardened_key;
-    const auto position = hard ? first + index : index;
-    const auto child_private_key = private_key.derive_private(position);
-
-    if (!child_private_key)
+    wallet::hd_private child_private_key;
+    if (evaluate(child_private_key, private_key, hard, index) !=
+        evaluation::okay)
     {
         output << "ERROR" << std::endl;
         return console_result::failure;
@@ -29,66 +29,70 @@ namespace commands {
 
 using namespace bc::system;
 
-console_result hd_public::invoke(std::ostream& output, std::ostream& error)
+evaluation hd_public::evaluate(wallet::hd_public& result,
+    const config::hd_key& hd_key, const bool& hard, const uint32_t& index,
+    const uint32_t& secret_version, const uint32_t& public_version)
 {
-    // Bound parameters.
-    const auto hard = get_hard_option();
-    const auto index = get_index_option();
-    const auto private_version = get_secret_version_option();
-    const auto public_version = get_public_version_option();
-    const auto& key = get_hd_key_argument();
+    const auto key_version = hd_key.version();
+    if (key_version != secret_version && key_version != public_version)
+        return evaluation::invalid_version;
 
-    const auto key_version = key.version();
-    if (key_version != private_version && key_version != public_version)
-    {
-        output << "ERROR_VERSION" << std::endl;
-        return console_result::failure;
-    }
-
-    if (hard && key_version != private_version)
-    {
-        error << BX_HD_PUBLIC_HARD_OPTION_CONFLICT << std::endl;
-        return console_result::failure;
-    }
+    if (hard && key_version != secret_version)
+        return evaluation::hard_option_conflict;
 
-    if (key_version == private_version)
+    if (key_version == secret_version)
     {
-        const auto prefixes = wallet::hd_private::to_prefixes(
-            key.version(), public_version);
+        const auto prefixes = wallet::hd_private::to_prefixes(key_version,
+            public_version);
 
         // Derive the public key from new private key and the public version.
-        const wallet::hd_private private_key(key, prefixes);
-        if (private_key)
-        {
-            static constexpr auto first = wallet::hd_first_hardened_key;
-            const auto position = hard ? first + index : index;
+        const wallet::hd_private private_key(hd_key, prefixes);
+        if (!private_key)
+            return evaluation::invalid_key;
 
-            const auto child_public_key = private_key.derive_public(position);
-            if (child_public_key)
-            {
-                output << child_public_key << std::endl;
-                return console_result::okay;
-            }
-        }
+        static constexpr auto first = wallet::hd_first_hardened_key;
+        const auto position = hard ? first + index : index;
+        result = private_key.derive_public(position);
     }
     else
     {
         // Derive the public key from new private key and the public version.
-        const wallet::hd_public public_key(key, public_version);
-        if (public_key)
-        {
-            const auto child_public_key = public_key.derive_public(index);
-            if (child_public_key)
-            {
-                output << child_public_key << std::endl;
-                return console_result::okay;
-            }
-        }
+        const wallet::hd_public public_key(hd_key, public_version);
+        if (!public_key)
+            return evaluation::invalid_key;
+
+        result = public_key.derive_public(index);
     }
 
+    return result ? evaluation::okay : evaluation::invalid_key;
+}
+
+console_result hd_public::invoke(std::ostream& output, std::ostream& error)
+{
+    // Bound parameters.
+    const auto hard = get_hard_option();
+    const auto index = get_index_option();
+    const auto private_version = get_secret_version_option();
+    const auto public_version = get_public_version_option();
+    const auto& key = get_hd_key_argument();
 
-    output << "ERROR_KEY" << std::endl;
-    return console_result::okay;
+    wallet::hd_public child_public_key;
+    switch (evaluate(child_public_key, key, hard, index, private_version,
+        public_version))
+    {
+        case evaluation::okay:
+            output << child_public_key << std::endl;
+            return console_result::okay;
+        case evaluation::invalid_version:
+            output << "ERROR_VERSION" << std::endl;
+            return console_result::failure;
+        case evaluation::hard_option_conflict:
+            error << BX_HD_PUBLIC_HARD_OPTION_CONFLICT << std::endl;
+            return console_result::failure;
+        default:
+            output << "ERROR_KEY" << std::endl;
+            return console_result::okay;
+    }
 }
 
 } //namespace commands
@@ -29,28 +29,38 @@ namespace commands {
 using namespace bc::system;
 using namespace bc::system::wallet;
 
-console_result hd_to_public::invoke(std::ostream& output, std::ostream& error)
+evaluation hd_to_public::evaluate(wallet::hd_public& result,
+    const wallet::hd_private& hd_private_key, const uint32_t& version)
 {
-    // Bound parameters.
-    const auto version = get_version_option();
-    const auto& private_key = get_hd_private_key_argument();
-
     // Obtain private version and combine with specified public version.
     using secret = wallet::hd_private;
-    const auto private_hd_key = private_key.to_hd_key();
-    const auto prefix = secret::to_prefix(private_key.lineage().prefixes);
+    const auto private_hd_key = hd_private_key.to_hd_key();
+    const auto prefix = secret::to_prefix(hd_private_key.lineage().prefixes);
     const auto prefixes = secret::to_prefixes(prefix, version);
 
     // Derive the public key from new private key with the public version.
     const secret versioned(private_hd_key, prefixes);
-
     if (!versioned)
+        return evaluation::invalid_key;
+
+    result = versioned.to_public();
+    return evaluation::okay;
+}
+
+console_result hd_to_public::invoke(std::ostream& output, std::ostream& error)
+{
+    // Bound parameters.
+    const auto version = get_version_option();
+    const auto& private_key = get_hd_private_key_argument();
+
+    wallet::hd_public public_key;
+    if (evaluate(public_key, private_key, version) != evaluation::okay)
     {
         output << "ERROR" << std::endl;
         return console_result::failure;
     }
 
-    output << versioned.to_public() << std::endl;
+    output << public_key << std::endl;
     return console_result::okay;
 }
 
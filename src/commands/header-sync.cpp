@@ -0,0 +1,229 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/header-sync.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <boost/filesystem.hpp>
+#include <bitcoin/client.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/display.hpp>
+#include <bitcoin/explorer/header_chain.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+using namespace bc::client;
+using namespace bc::system;
+
+// The number of header requests outstanding at once.
+static const size_t range_size = 2000;
+
+// A local chain that does not match the server is rewound by this depth.
+static const size_t rewind_depth = 144;
+
+static bool write_headers(std::ostream& stream,
+    const chain::header::list& headers, size_t count)
+{
+    for (size_t index = 0; index < count; ++index)
+    {
+        const auto data = headers[index].to_data();
+        stream.write(reinterpret_cast<const char*>(data.data()), data.size());
+    }
+
+    stream.flush();
+    return stream.good();
+}
+
+console_result header_sync::invoke(std::ostream& output, std::ostream& error)
+{
+    // Bound parameters.
+    const auto& file_option = get_file_option();
+    const auto height = get_height_option();
+    const auto file = file_option.empty() ? get_server_headers_file_setting() :
+        file_option;
+
+    if (file.empty())
+    {
+        error << BX_HEADER_SYNC_FILE_REQUIRED << std::endl;
+        return console_result::failure;
+    }
+
+    const auto connection = get_connection(*this);
+
+    obelisk_client client(connection.retries);
+    if (!client.connect(connection))
+    {
+        display_connection_failure(error, connection.server);
+        return console_result::failure;
+    }
+
+    size_t top = height;
+    if (top == 0)
+    {
+        code result;
+        const auto on_done = [&](const code& ec, size_t value)
+        {
+            result = ec;
+            top = value;
+        };
+
+        client.blockchain_fetch_last_height(on_done);
+        client.wait();
+
+        if (result)
+        {
+            error << format(BX_HEADER_SYNC_HEIGHT_FAILURE) % result.message()
+                << std::endl;
+            return console_result::failure;
+        }
+    }
+
+    const auto fetch_header = [&client](
+        const range_handler<chain::header>& handler, uint32_t height)
+    {
+        client.blockchain_fetch_block_header(handler, height);
+    };
+
+    size_t failed = 0;
+    chain::header::list headers;
+
+    // Rewind the local chain until its top matches the server.
+    header_chain local(file);
+    auto start = local.open() ? local.size() : 0;
+    auto previous = null_hash;
+
+    while (start > 0)
+    {
+        chain::header header;
+        local.get(header, start - 1);
+
+        const auto ec = fetch_range(client, headers, start - 1, 1, failed,
+            fetch_header);
+        if (ec)
+        {
+            error << format(BX_HEADER_SYNC_FETCH_FAILURE) % failed %
+                ec.message() << std::endl;
+            return console_result::failure;
+        }
+
+        if (headers.front().hash() == header.hash())
+        {
+            previous = header.hash();
+            break;
+        }
+
+        start = start > rewind_depth ? start - rewind_depth : 0;
+    }
+
+    // The work required of the headers follows from the retained chain.
+    const auto rules = header_chain::rules(get_network_identifier_setting());
+    header_chain::work_state state;
+    if (!local.get_state(state, rules, start))
+    {
+        error << format(BX_HEADER_SYNC_INVALID_HEADER) % start << std::endl;
+        return console_result::failure;
+    }
+
+    local.close();
+
+    // This also truncates a partial record from an interrupted write.
+    boost::system::error_code truncated;
+    if (boost::filesystem::exists(file))
+        boost::filesystem::resize_file(file, start * header_chain::record_size,
+            truncated);
+
+    ofstream stream(file.string(), std::ofstream::binary |
+        std::ofstream::app);
+
+    if (truncated || !stream.good())
+    {
+        error << format(BX_HEADER_SYNC_WRITE_FAILURE) % file.string()
+            << std::endl;
+        return console_result::failure;
+    }
+
+    // Each range is verified while the next is fetched.
+    chain::header::list verifying;
+    std::future<size_t> verified;
+    size_t synchronized = 0;
+
+    const auto complete = [&]() -> bool
+    {
+        const auto valid = verified.get();
+        if (!write_headers(stream, verifying, valid))
+        {
+            error << format(BX_HEADER_SYNC_WRITE_FAILURE) % file.string()
+                << std::endl;
+            return false;
+        }
+
+        synchronized += valid;
+        if (valid == verifying.size())
+            return true;
+
+        error << format(BX_HEADER_SYNC_INVALID_HEADER) %
+            (start + synchronized) << std::endl;
+        return false;
+    };
+
+    for (auto next = start; next <= top;)
+    {
+        const auto count = std::min(range_size, top - next + 1);
+        const auto ec = fetch_range(client, headers, next, count, failed,
+            fetch_header);
+
+        if (verified.valid() && !complete())
+            return console_result::failure;
+
+        if (ec)
+        {
+            error << format(BX_HEADER_SYNC_FETCH_FAILURE) % failed %
+                ec.message() << std::endl;
+            return console_result::failure;
+        }
+
+        verifying.swap(headers);
+        verified = std::async(std::launch::async, header_chain::verify,
+            std::cref(verifying), previous, std::cref(rules),
+            std::ref(state));
+
+        previous = verifying.back().hash();
+        next += count;
+    }
+
+    if (verified.valid() && !complete())
+        return console_result::failure;
+
+    const auto size = start + synchronized;
+    output << format(BX_HEADER_SYNC_SYNCHRONIZED) % synchronized %
+        (size == 0 ? 0 : size - 1) << std::endl;
+    return console_result::okay;
+}
+
+} //namespace commands
+} //namespace explorer
+} //namespace libbitcoin
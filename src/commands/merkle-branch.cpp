@@ -0,0 +1,119 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/merkle-branch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <bitcoin/client.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/callback_state.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/display.hpp>
+#include <bitcoin/explorer/merkle.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+using namespace bc::client;
+using namespace bc::system;
+
+console_result merkle_branch::invoke(std::ostream& output,
+    std::ostream& error)
+{
+    // Bound parameters.
+    const hash_digest& hash = get_hash_option();
+    const auto& txids = get_txids_argument();
+    auto height = get_height_option();
+    const auto connection = get_connection(*this);
+
+    obelisk_client client(connection.retries);
+    if (!client.connect(connection))
+    {
+        display_connection_failure(error, connection.server);
+        return console_result::failure;
+    }
+
+    callback_state state(error, output);
+    hash_list hashes;
+
+    const auto on_hashes = [&](const code& ec, const hash_list& value)
+    {
+        if (state.succeeded(ec))
+            hashes = value;
+    };
+
+    const auto on_height = [&](const code& ec, size_t value)
+    {
+        if (state.succeeded(ec))
+            height = static_cast<uint32_t>(value);
+    };
+
+    // Height is ignored if both are specified, but is required by the proof.
+    // Use the null_hash as sentinel to determine whether to use height or hash.
+    if (hash == null_hash)
+    {
+        client.blockchain_fetch_block_transaction_hashes(on_hashes, height);
+    }
+    else
+    {
+        client.blockchain_fetch_block_transaction_hashes(on_hashes, hash);
+        client.blockchain_fetch_block_height(on_height, hash);
+    }
+
+    client.wait();
+
+    if (state.get_result() != console_result::okay)
+        return state.get_result();
+
+    const merkle_tree tree(hashes);
+
+    std::map<hash_digest, uint32_t> positions;
+    for (size_t index = 0; index < hashes.size(); ++index)
+        positions.emplace(hashes[index], static_cast<uint32_t>(index));
+
+    auto result = console_result::okay;
+
+    for (const hash_digest& txid: txids)
+    {
+        hash_list branch;
+        const auto position = positions.find(txid);
+
+        if (position == positions.end() ||
+            !tree.branch(branch, position->second))
+        {
+            error << format(BX_MERKLE_BRANCH_NOT_FOUND) % encode_hash(txid)
+                << std::endl;
+            result = console_result::failure;
+            continue;
+        }
+
+        output << config::merkle_proof(height, position->second, txid,
+            branch) << std::endl;
+    }
+
+    return result;
+}
+
+} //namespace commands
+} //namespace explorer
+} //namespace libbitcoin
@@ -0,0 +1,136 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/merkle-verify.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <set>
+#include <bitcoin/client.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/display.hpp>
+#include <bitcoin/explorer/header_chain.hpp>
+#include <bitcoin/explorer/merkle.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+using namespace bc::client;
+using namespace bc::system;
+
+console_result merkle_verify::invoke(std::ostream& output,
+    std::ostream& error)
+{
+    // Bound parameters.
+    const auto& proofs = get_proofs_argument();
+
+    const auto roots = merkle_roots(proofs);
+
+    std::set<uint32_t> heights;
+    for (const auto& proof: proofs)
+        heights.insert(proof.height());
+
+    // The merkle root of each block, from the local chain where confirmed.
+    std::map<uint32_t, hash_digest> blocks;
+    header_chain local(get_server_headers_file_setting());
+    chain::header header;
+
+    if (local.open())
+        for (const auto height: heights)
+            if (local.get_confirmed(header, height))
+                blocks.emplace(height, header.merkle_root());
+
+    if (blocks.size() < heights.size())
+    {
+        const auto connection = get_connection(*this);
+
+        obelisk_client client(connection.retries);
+        if (!client.connect(connection))
+        {
+            display_connection_failure(error, connection.server);
+            return console_result::failure;
+        }
+
+        code result;
+        uint32_t failed = 0;
+
+        // All requests are sent before waiting, as a pipeline.
+        for (const auto height: heights)
+        {
+            if (blocks.find(height) != blocks.end())
+                continue;
+
+            const auto on_done = [&, height](const code& ec,
+                const chain::header& value)
+            {
+                if (!ec)
+                {
+                    blocks.emplace(height, value.merkle_root());
+                    return;
+                }
+
+                if (!result)
+                {
+                    result = ec;
+                    failed = height;
+                }
+            };
+
+            client.blockchain_fetch_block_header(on_done, height);
+        }
+
+        client.wait();
+
+        if (result)
+        {
+            error << format(BX_MERKLE_VERIFY_FETCH_FAILURE) % failed %
+                result.message() << std::endl;
+            return console_result::failure;
+        }
+    }
+
+    auto result = console_result::okay;
+
+    for (size_t index = 0; index < proofs.size(); ++index)
+    {
+        const auto& proof = proofs[index];
+        const auto txid = encode_hash(proof.hash());
+
+        if (blocks[proof.height()] == roots[index])
+        {
+            output << format(BX_MERKLE_VERIFY_VALID) % txid % proof.height()
+                << std::endl;
+            continue;
+        }
+
+        error << format(BX_MERKLE_VERIFY_INVALID) % txid % proof.height()
+            << std::endl;
+        result = console_result::failure;
+    }
+
+    return result;
+}
+
+} //namespace commands
+} //namespace explorer
+} //namespace libbitcoin
@@ -0,0 +1,227 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/message-batch.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <boost/algorithm/string.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/codec.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+using namespace bc::system;
+using namespace bc::system::wallet;
+
+// Split the record into fields, the last of which is the rest of the record.
+static bool split_record(string_list& out, const std::string& record,
+    size_t fields)
+{
+    out.clear();
+    size_t begin = 0;
+
+    while (out.size() + 1 < fields)
+    {
+        const auto end = record.find(',', begin);
+        if (end == std::string::npos)
+            return false;
+
+        out.push_back(boost::trim_copy(record.substr(begin, end - begin)));
+        begin = end + 1;
+    }
+
+    out.push_back(record.substr(begin));
+    return true;
+}
+
+static bool decode_signature(message_signature& out, const std::string& text)
+{
+    data_chunk decoded;
+    if (!from_base64(decoded, text) || decoded.size() != out.size())
+        return false;
+
+    std::copy(decoded.begin(), decoded.end(), out.begin());
+    return true;
+}
+
+// This is the recovery of verify_message, keeping the key.
+static bool recover_key(ec_public& out, const message_signature& signature,
+    const hash_digest& hash)
+{
+    bool compressed;
+    uint8_t recovery_id;
+    if (!magic_to_recovery_id(recovery_id, compressed, signature.front()))
+        return false;
+
+    const recoverable_signature recoverable
+    {
+        slice<1, message_signature_size>(signature),
+        recovery_id
+    };
+
+    if (compressed)
+    {
+        ec_compressed point;
+        if (!recover_public(point, recoverable, hash))
+            return false;
+
+        out = ec_public(point, true);
+        return true;
+    }
+
+    ec_uncompressed point;
+    if (!recover_public(point, recoverable, hash))
+        return false;
+
+    out = ec_public(point, false);
+    return true;
+}
+
+console_result message_batch::invoke(std::ostream& output,
+    std::ostream& error)
+{
+    // Bound parameters.
+    const auto& file = get_file_option();
+
+    std::unique_ptr<ifstream> stream;
+    if (!file.empty() && file.string() != BX_STDIO_PATH_SENTINEL)
+    {
+        stream.reset(new ifstream(file.string()));
+        if (!stream->good())
+        {
+            error << format(BX_MESSAGE_BATCH_FILE_FAILURE) % file.string()
+                << std::endl;
+            return console_result::failure;
+        }
+    }
+
+    std::atomic<size_t> signed_count(0);
+    std::atomic<size_t> valid_count(0);
+    std::atomic<size_t> invalid_count(0);
+    std::atomic<size_t> malformed_count(0);
+
+    // The address hash of each signer, by key. The key is always recovered,
+    // so that a result does not depend on the records that preceded it, and
+    // the cache only saves the hash of a known key and counts the signers.
+    std::mutex cache_mutex;
+    std::unordered_map<std::string, short_hash> cache;
+
+    const auto cache_hash = [&](const ec_public& key, const short_hash& hash)
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        cache.emplace(key.encoded(), hash);
+    };
+
+    const auto validate = [&](const payment_address& address,
+        const message_signature& signature, const hash_digest& hash) -> bool
+    {
+        ec_public key;
+        if (!recover_key(key, signature, hash))
+            return false;
+
+        const auto encoded = key.encoded();
+        {
+            std::lock_guard<std::mutex> lock(cache_mutex);
+            const auto cached = cache.find(encoded);
+            if (cached != cache.end())
+                return cached->second == address.hash();
+        }
+
+        const auto key_hash = payment_address(key, address.version()).hash();
+        if (key_hash != address.hash())
+            return false;
+
+        cache_hash(key, key_hash);
+        return true;
+    };
+
+    // Fields are trimmed but the message is not, as it is signed as read.
+    const auto write = [&](std::string& out, const std::string& text)
+    {
+        const auto line = boost::trim_left_copy(text);
+        if (line.empty() || line.front() == '#')
+            return;
+
+        string_list fields;
+        message_signature signature;
+
+        if (starts_with(line, "sign,") && split_record(fields, line, 3))
+        {
+            const ec_private secret(fields[1]);
+            const data_chunk message(fields[2].begin(), fields[2].end());
+
+            if (secret && sign_message(signature, message, secret))
+            {
+                cache_hash(secret.to_public(), payment_address(secret).hash());
+                ++signed_count;
+                out += to_base64(signature) + "\n";
+                return;
+            }
+        }
+        else if (starts_with(line, "validate,") &&
+            split_record(fields, line, 4))
+        {
+            const payment_address address(fields[1]);
+            const data_chunk message(fields[3].begin(), fields[3].end());
+
+            if (address && decode_signature(signature, fields[2]))
+            {
+                if (validate(address, signature, hash_message(message)))
+                {
+                    ++valid_count;
+                    out += BX_MESSAGE_BATCH_VALID "\n";
+                    return;
+                }
+
+                ++invalid_count;
+                out += BX_MESSAGE_BATCH_INVALID "\n";
+                return;
+            }
+        }
+
+        ++malformed_count;
+        out += BX_MESSAGE_BATCH_MALFORMED "\n";
+    };
+
+    std::istream& input = stream ? *stream : get_input();
+    write_lines(output, input, write);
+
+    output << format(BX_MESSAGE_BATCH_REPORT) % signed_count.load() %
+        valid_count.load() % invalid_count.load() % malformed_count.load() %
+        cache.size() << std::endl;
+
+    // As message-validate, an invalid record is not a failure.
+    return invalid_count == 0 && malformed_count == 0 ? console_result::okay :
+        console_result::invalid;
+}
+
+} //namespace commands
+} //namespace explorer
+} //namespace libbitcoin
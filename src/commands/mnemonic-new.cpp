@@ -21,6 +21,7 @@
 #include <iostream>
 #include <bitcoin/system.hpp>
 #include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/utility.hpp>
 
 namespace libbitcoin {
 namespace explorer {
@@ -34,17 +35,44 @@ console_result mnemonic_new::invoke(std::ostream& output,
     // Bound parameters.
     const dictionary_list& language = get_language_option();
     const data_chunk& entropy = get_seed_argument();
+    const auto count = get_count_option();
 
-    const auto entropy_size = entropy.size();
+    // If 'any' default to first ('en'), otherwise the one specified.
+    const auto dictionary = language.front();
+
+    if (count > 0)
+    {
+        const auto bit_length = get_bit_length_option();
+        const auto multiple = wallet::mnemonic_seed_multiple * byte_bits;
+        if (bit_length == 0 || bit_length % multiple != 0)
+        {
+            error << BX_MNEMONIC_NEW_BIT_LENGTH_UNSUPPORTED << std::endl;
+            return console_result::failure;
+        }
+
+        const auto writer = [dictionary](std::ostream& stream,
+            const data_chunk& seed) -> bool
+        {
+            stream << join(create_mnemonic(seed, *dictionary)) << "\n";
+            return true;
+        };
 
-    if ((entropy_size % wallet::mnemonic_seed_multiple) != 0)
+        if (write_seeded(output, count, bit_length / byte_bits, writer) !=
+            evaluation::okay)
+        {
+            error << BX_ENTROPY_UNAVAILABLE << std::endl;
+            return console_result::failure;
+        }
+
+        return console_result::okay;
+    }
+
+    if ((entropy.size() % wallet::mnemonic_seed_multiple) != 0)
     {
         error << BX_MNEMONIC_NEW_INVALID_SEED << std::endl;
         return console_result::failure;
     }
 
-    // If 'any' default to first ('en'), otherwise the one specified.
-    const auto dictionary = language.front();
     const auto words = create_mnemonic(entropy, *dictionary);
 
     output << join(words) << std::endl;
@@ -0,0 +1,688 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <bitcoin/explorer/commands/pipeline.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <typeinfo>
+#include <vector>
+#include <boost/algorithm/string.hpp>
+#include <boost/any.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/display.hpp>
+#include <bitcoin/explorer/generated.hpp>
+#include <bitcoin/explorer/parser.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+using namespace bc::system;
+
+// The number of values that may be waiting between two stages.
+static const size_t queue_capacity = 64;
+
+// A value passed between stages, typed if the producing stage evaluated it
+// for a next stage that accepts its type, otherwise text.
+struct stage_value
+{
+    std::string text;
+    boost::any typed;
+};
+
+// A bounded queue of stage values, closed by the writer once complete and
+// stopped by any stage upon failure.
+class stage_queue
+{
+public:
+    stage_queue()
+      : closed_(false), stopped_(false)
+    {
+    }
+
+    // Block while full, false if the pipeline has stopped.
+    bool push(stage_value&& value)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_full_.wait(lock, [this]()
+        {
+            return stopped_ || values_.size() < queue_capacity;
+        });
+
+        if (stopped_)
+            return false;
+
+        values_.push_back(std::move(value));
+        not_empty_.notify_one();
+        return true;
+    }
+
+    // Block while empty, false once closed and drained or stopped.
+    bool pop(stage_value& out)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_empty_.wait(lock, [this]()
+        {
+            return stopped_ || closed_ || !values_.empty();
+        });
+
+        if (stopped_ || values_.empty())
+            return false;
+
+        out = std::move(values_.front());
+        values_.pop_front();
+        not_full_.notify_one();
+        return true;
+    }
+
+    void close()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        not_empty_.notify_all();
+    }
+
+    void stop()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+        values_.clear();
+        not_empty_.notify_all();
+        not_full_.notify_all();
+    }
+
+private:
+    bool closed_;
+    bool stopped_;
+    std::deque<stage_value> values_;
+    std::mutex mutex_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+};
+
+// The typed evaluation of a stage command, bound to its parsed instance.
+class typed_stage
+{
+public:
+    typedef std::unique_ptr<typed_stage> ptr;
+
+    virtual ~typed_stage()
+    {
+    }
+
+    // The name of the argument that is loaded from the stage input.
+    virtual const std::string& input_name() const = 0;
+    virtual const std::type_info& input_type() const = 0;
+    virtual const std::type_info& result_type() const = 0;
+    virtual void bind(const boost::any& value) = 0;
+    virtual evaluation evaluate(boost::any& result) = 0;
+    virtual void write(std::ostream& output,
+        const boost::any& result) const = 0;
+};
+
+template <typename Command, typename Input, typename Result>
+class typed_command
+  : public typed_stage
+{
+public:
+    typedef std::function<void(Command&, const Input&)> binder;
+    typedef std::function<evaluation(Command&, Result&)> evaluator;
+    typedef std::function<void(std::ostream&, const Result&)> writer;
+
+    typed_command(command& instance, const std::string& input_name,
+        binder bind, evaluator evaluate, writer write)
+      : instance_(static_cast<Command&>(instance)), input_name_(input_name),
+        bind_(bind), evaluate_(evaluate), write_(write)
+    {
+    }
+
+    const std::string& input_name() const
+    {
+        return input_name_;
+    }
+
+    const std::type_info& input_type() const
+    {
+        return typeid(Input);
+    }
+
+    const std::type_info& result_type() const
+    {
+        return typeid(Result);
+    }
+
+    void bind(const boost::any& value)
+    {
+        bind_(instance_, boost::any_cast<const Input&>(value));
+    }
+
+    evaluation evaluate(boost::any& result)
+    {
+        Result value;
+        const auto outcome = evaluate_(instance_, value);
+        if (outcome == evaluation::okay)
+            result = std::move(value);
+
+        return outcome;
+    }
+
+    void write(std::ostream& output, const boost::any& result) const
+    {
+        write_(output, boost::any_cast<const Result&>(result));
+    }
+
+private:
+    Command& instance_;
+    const std::string input_name_;
+    const binder bind_;
+    const evaluator evaluate_;
+    const writer write_;
+};
+
+template <typename Command, typename Input, typename Result>
+static typed_stage::ptr make_typed(command& instance,
+    const std::string& input_name,
+    typename typed_command<Command, Input, Result>::binder bind,
+    typename typed_command<Command, Input, Result>::evaluator evaluate)
+{
+    const auto write = [](std::ostream& output, const Result& result)
+    {
+        output << result;
+    };
+
+    return typed_stage::ptr(new typed_command<Command, Input, Result>(
+        instance, input_name, bind, evaluate, write));
+}
+
+// A command without an input never binds one.
+struct no_input
+{
+};
+
+// The commands with a typed evaluate API, otherwise null. A command that
+// writes other than a single result (count mode) is evaluated as text.
+static typed_stage::ptr find_typed(command& instance)
+{
+    const std::string symbol(instance.name());
+
+    if (symbol == seed::symbol())
+    {
+        if (static_cast<seed&>(instance).get_count_option() > 0)
+            return nullptr;
+
+        return make_typed<seed, no_input, system::config::base16>(instance, "",
+            [](seed&, const no_input&) {},
+            [](seed& command, system::config::base16& result)
+            {
+                return seed::evaluate(result, command.get_bit_length_option());
+            });
+    }
+
+    if (symbol == ec_new::symbol())
+    {
+        if (static_cast<ec_new&>(instance).get_count_option() > 0)
+            return nullptr;
+
+        return make_typed<ec_new, system::config::base16,
+            explorer::config::ec_private>(instance, "SEED",
+            [](ec_new& command, const system::config::base16& value)
+            {
+                command.set_seed_argument(value);
+            },
+            [](ec_new& command, explorer::config::ec_private& result)
+            {
+                return ec_new::evaluate(result, command.get_seed_argument());
+            });
+    }
+
+    if (symbol == hd_new::symbol())
+    {
+        if (static_cast<hd_new&>(instance).get_count_option() > 0)
+            return nullptr;
+
+        return make_typed<hd_new, system::config::base16,
+            wallet::hd_private>(instance, "SEED",
+            [](hd_new& command, const system::config::base16& value)
+            {
+                command.set_seed_argument(value);
+            },
+            [](hd_new& command, wallet::hd_private& result)
+            {
+                return hd_new::evaluate(result, command.get_seed_argument(),
+                    command.get_version_option());
+            });
+    }
+
+    if (symbol == ec_to_public::symbol())
+        return make_typed<ec_to_public, explorer::config::ec_private,
+            wallet::ec_public>(instance, "EC_PRIVATE_KEY",
+            [](ec_to_public& command, const explorer::config::ec_private& value)
+            {
+                command.set_ec_private_key_argument(value);
+            },
+            [](ec_to_public& command, wallet::ec_public& result)
+            {
+                return ec_to_public::evaluate(result,
+                    command.get_ec_private_key_argument(),
+                    command.get_uncompressed_option());
+            });
+
+    if (symbol == ec_to_address::symbol())
+    {
+        // The address is written as its base58 payment, as by the command.
+        const auto write = [](std::ostream& output,
+            const wallet::payment_address& result)
+        {
+            output << to_base58(result.to_payment());
+        };
+
+        return typed_stage::ptr(new typed_command<ec_to_address,
+            wallet::ec_public, wallet::payment_address>(instance,
+            "EC_PUBLIC_KEY",
+            [](ec_to_address& command, const wallet::ec_public& value)
+            {
+                command.set_ec_public_key_argument(value);
+            },
+            [](ec_to_address& command, wallet::payment_address& result)
+            {
+                return ec_to_address::evaluate(result,
+                    command.get_ec_public_key_argument(),
+                    command.get_version_option());
+            }, write));
+    }
+
+    if (symbol == ec_to_wif::symbol())
+        return make_typed<ec_to_wif, explorer::config::ec_private,
+            wallet::ec_private>(instance, "EC_PRIVATE_KEY",
+            [](ec_to_wif& command, const explorer::config::ec_private& value)
+            {
+                command.set_ec_private_key_argument(value);
+            },
+            [](ec_to_wif& command, wallet::ec_private& result)
+            {
+                return ec_to_wif::evaluate(result,
+                    command.get_ec_private_key_argument(),
+                    command.get_uncompressed_option(),
+                    command.get_version_option());
+            });
+
+    if (symbol == wif_to_ec::symbol())
+        return make_typed<wif_to_ec, wallet::ec_private,
+            explorer::config::ec_private>(instance, "WIF",
+            [](wif_to_ec& command, const wallet::ec_private& value)
+            {
+                command.set_wif_argument(value);
+            },
+            [](wif_to_ec& command, explorer::config::ec_private& result)
+            {
+                return wif_to_ec::evaluate(result, command.get_wif_argument());
+            });
+
+    if (symbol == wif_to_public::symbol())
+        return make_typed<wif_to_public, wallet::ec_private,
+            wallet::ec_public>(instance, "WIF",
+            [](wif_to_public& command, const wallet::ec_private& value)
+            {
+                command.set_wif_argument(value);
+            },
+            [](wif_to_public& command, wallet::ec_public& result)
+            {
+                return wif_to_public::evaluate(result,
+                    command.get_wif_argument());
+            });
+
+    if (symbol == hd_private::symbol())
+        return make_typed<commands::hd_private, wallet::hd_private,
+            wallet::hd_private>(instance, "HD_PRIVATE_KEY",
+            [](commands::hd_private& command, const wallet::hd_private& value)
+            {
+                command.set_hd_private_key_argument(value);
+            },
+            [](commands::hd_private& command, wallet::hd_private& result)
+            {
+                return commands::hd_private::evaluate(result,
+                    command.get_hd_private_key_argument(),
+                    command.get_hard_option(), command.get_index_option());
+            });
+
+    if (symbol == hd_public::symbol())
+        return make_typed<commands::hd_public, explorer::config::hd_key,
+            wallet::hd_public>(instance, "HD_KEY",
+            [](commands::hd_public& command,
+                const explorer::config::hd_key& value)
+            {
+                command.set_hd_key_argument(value);
+            },
+            [](commands::hd_public& command, wallet::hd_public& result)
+            {
+                return commands::hd_public::evaluate(result,
+                    command.get_hd_key_argument(), command.get_hard_option(),
+                    command.get_index_option(),
+                    command.get_secret_version_option(),
+                    command.get_public_version_option());
+            });
+
+    if (symbol == hd_to_public::symbol())
+        return make_typed<hd_to_public, wallet::hd_private, wallet::hd_public>(
+            instance, "HD_PRIVATE_KEY",
+            [](hd_to_public& command, const wallet::hd_private& value)
+            {
+                command.set_hd_private_key_argument(value);
+            },
+            [](hd_to_public& command, wallet::hd_public& result)
+            {
+                return hd_to_public::evaluate(result,
+                    command.get_hd_private_key_argument(),
+                    command.get_version_option());
+            });
+
+    return nullptr;
+}
+
+// A stage is a command parsed once from its specification, the first token
+// being the command symbol. The input of each value is then bound to it.
+struct stage
+{
+    std::shared_ptr<command> instance;
+    system::variables_map variables;
+    typed_stage::ptr typed;
+
+    // True if the stage passes typed results to the next stage.
+    bool typed_output;
+};
+
+static std::vector<std::string> split_stage(const std::string& text)
+{
+    std::vector<std::string> tokens;
+    const auto trimmed = boost::trim_copy(text);
+    if (!trimmed.empty())
+        boost::split(tokens, trimmed, boost::is_any_of(" \t"),
+            boost::token_compress_on);
+
+    return tokens;
+}
+
+// Parses the stage parameters without its input fallback, which is loaded
+// for each value.
+class stage_parser
+  : public parser
+{
+public:
+    stage_parser(command& instance)
+      : parser(instance)
+    {
+    }
+
+protected:
+    void load_command_variables(system::variables_map& variables,
+        std::istream&, int argc, const char* argv[])
+    {
+        system::config::parser::load_command_variables(variables, argc, argv);
+    }
+};
+
+// Parse the stage parameters into a new command instance, without input.
+static bool parse_stage(stage& out, const std::vector<std::string>& tokens,
+    std::ostream& output, std::ostream& error, bool& help)
+{
+    out.instance = find(tokens.front());
+
+    std::vector<const char*> argv;
+    for (const auto& token: tokens)
+        argv.push_back(token.c_str());
+
+    std::istringstream input;
+    stage_parser metadata(*out.instance);
+    std::string message;
+
+    if (!metadata.parse(message, input, static_cast<int>(argv.size()),
+        argv.data()))
+    {
+        display_invalid_parameter(error, message);
+        return false;
+    }
+
+    if (metadata.help())
+    {
+        out.instance->write_help(output);
+        help = true;
+        return true;
+    }
+
+    out.variables = metadata.variables();
+    out.typed = find_typed(*out.instance);
+    out.typed_output = false;
+    return true;
+}
+
+// Bind the value to the stage input, unless the input is a parameter of the
+// stage. A typed value of the input type is bound as is, otherwise as text.
+static bool bind_stage(stage& current, const stage_value& value,
+    std::ostream& error)
+{
+    const auto& typed = current.typed;
+    if (typed && !value.typed.empty() &&
+        value.typed.type() == typed->input_type())
+    {
+        if (current.variables.count(typed->input_name()) == 0)
+            typed->bind(value.typed);
+
+        return true;
+    }
+
+    try
+    {
+        auto variables = current.variables;
+        std::istringstream input(value.text);
+        current.instance->load_fallbacks(input, variables);
+        return true;
+    }
+    catch (const std::exception& exception)
+    {
+        display_invalid_parameter(error, exception.what());
+        return false;
+    }
+}
+
+// Evaluate the stage on its bound input. A typed stage writes or passes its
+// result, and a failure is invoked for its message.
+static console_result evaluate_stage(stage& current, stage_value& result,
+    std::ostream& output, std::ostream& error)
+{
+    try
+    {
+        if (current.typed &&
+            current.typed->evaluate(result.typed) == evaluation::okay)
+        {
+            if (current.typed_output)
+                return console_result::okay;
+
+            current.typed->write(output, result.typed);
+            output << std::endl;
+            result.typed = boost::any();
+            return console_result::okay;
+        }
+
+        return current.instance->invoke(output, error);
+    }
+    catch (const std::exception& exception)
+    {
+        error << exception.what() << std::endl;
+        return console_result::failure;
+    }
+}
+
+console_result pipeline::invoke(std::ostream& output, std::ostream& error)
+{
+    // Bound parameters.
+    const auto count = get_count_option();
+    const auto& file = get_file_option();
+    const auto& specifications = get_stages_argument();
+
+    if (specifications.empty())
+    {
+        error << BX_PIPELINE_STAGE_REQUIRED << std::endl;
+        return console_result::failure;
+    }
+
+    std::vector<stage> stages(specifications.size());
+    for (size_t index = 0; index < stages.size(); ++index)
+    {
+        const auto& specification = specifications[index];
+        const auto tokens = split_stage(specification);
+
+        // A nested pipeline would only add threads.
+        if (tokens.empty() || tokens.front() == pipeline::symbol() ||
+            !find(tokens.front()))
+        {
+            error << format(BX_PIPELINE_STAGE_INVALID) % specification
+                << std::endl;
+            return console_result::failure;
+        }
+
+        auto help = false;
+        if (!parse_stage(stages[index], tokens, output, error, help))
+            return console_result::failure;
+
+        if (help)
+            return console_result::okay;
+    }
+
+    // A result passes typed where the next stage accepts its type.
+    for (size_t index = 0; index + 1 < stages.size(); ++index)
+    {
+        const auto& producer = stages[index].typed;
+        const auto& consumer = stages[index + 1].typed;
+        stages[index].typed_output = producer && consumer &&
+            producer->result_type() == consumer->input_type();
+    }
+
+    std::unique_ptr<ifstream> stream;
+    if (!file.empty() && file.string() != BX_STDIO_PATH_SENTINEL)
+    {
+        stream.reset(new ifstream(file.string()));
+        if (!stream->good())
+        {
+            error << format(BX_PIPELINE_FILE_FAILURE) % file.string()
+                << std::endl;
+            return console_result::failure;
+        }
+    }
+
+    // The queue at each index is the input of the stage at that index.
+    std::vector<std::unique_ptr<stage_queue>> queues;
+    for (size_t index = 0; index < stages.size(); ++index)
+        queues.emplace_back(new stage_queue);
+
+    std::atomic<bool> failed(false);
+    std::mutex error_mutex;
+
+    const auto stop = [&]()
+    {
+        failed = true;
+        for (const auto& queue: queues)
+            queue->stop();
+    };
+
+    // Each stage is bound and evaluated only on its own thread.
+    const auto run = [&](size_t index)
+    {
+        const auto last = (index + 1 == stages.size());
+        auto& current = stages[index];
+        stage_value value;
+
+        while (queues[index]->pop(value))
+        {
+            std::ostringstream stage_output;
+            std::ostringstream stage_error;
+            stage_value result;
+
+            auto code = bind_stage(current, value, stage_error) ?
+                evaluate_stage(current, result, last ? output : stage_output,
+                    stage_error) : console_result::failure;
+
+            if (!stage_error.str().empty())
+            {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                error << stage_error.str();
+            }
+
+            if (code != console_result::okay)
+            {
+                stop();
+                break;
+            }
+
+            if (last)
+                continue;
+
+            if (result.typed.empty())
+                result.text = stage_output.str();
+
+            if (!queues[index + 1]->push(std::move(result)))
+                break;
+        }
+
+        if (!last)
+            queues[index + 1]->close();
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t index = 0; index < stages.size(); ++index)
+        threads.emplace_back(run, index);
+
+    // Feed the first stage from the file (or input), otherwise count times.
+    if (file.empty())
+    {
+        for (size_t iteration = 0; iteration < count; ++iteration)
+            if (!queues.front()->push(stage_value()))
+                break;
+    }
+    else
+    {
+        std::istream& input = stream ? *stream : get_input();
+        std::string line;
+
+        while (std::getline(input, line))
+            if (!queues.front()->push({ std::move(line), boost::any() }))
+                break;
+    }
+
+    queues.front()->close();
+
+    for (auto& thread: threads)
+        thread.join();
+
+    return failed ? console_result::failure : console_result::okay;
+}
+
+} //namespace commands
+} //namespace explorer
+} //namespace libbitcoin
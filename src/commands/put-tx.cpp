@@ -24,11 +24,11 @@
 #include <csignal>
 #include <future>
 #include <iostream>
-#include <mutex>
 #include <boost/core/null_deleter.hpp>
 #include <boost/format.hpp>
 #include <bitcoin/network.hpp>
 #include <bitcoin/explorer/callback_state.hpp>
+#include <bitcoin/explorer/completion.hpp>
 #include <bitcoin/explorer/define.hpp>
 #include <bitcoin/explorer/utility.hpp>
 
@@ -41,19 +41,13 @@ using namespace bc::explorer::config;
 using namespace bc::network;
 using namespace bc::system;
 
-static std::promise<code> complete;
-
-// Manage the race between console stop and network stop.
-static void stop(const code& ec)
-{
-    static std::once_flag stop_mutex;
-    std::call_once(stop_mutex, [&](){ complete.set_value(ec); });
-}
+// Raced by the console stop signal and the network.
+static completion complete;
 
 // Handle the console stop signal.
 static void handle_stop(int)
 {
-    stop(error::service_stopped);
+    complete.stop(error::service_stopped);
 }
 
 console_result put_tx::invoke(std::ostream& output, std::ostream& error)
@@ -131,6 +125,7 @@ console_result put_tx::invoke(std::ostream& output, std::ostream& error)
     // Network operations.
     //-------------------------------------------------------------------------
 
+    complete.restart();
     p2p network(settings);
     callback_state state(error, output);
     message::transaction tx(transaction);
@@ -144,7 +139,7 @@ console_result put_tx::invoke(std::ostream& output, std::ostream& error)
         if (state.succeeded(ec))
             state.output(BX_SEND_TX_NODE_OUTPUT);
 
-        stop(ec);
+        complete.stop(ec);
     };
 
     const auto connect_handler = [&state, &tx, send_handler](const code& ec,
@@ -153,13 +148,13 @@ console_result put_tx::invoke(std::ostream& output, std::ostream& error)
         if (state.succeeded(ec))
             node->send(tx, send_handler);
         else
-            stop(ec);
+            complete.stop(ec);
     };
 
     const auto start_handler = [&state](const code& ec)
     {
         if (!state.succeeded(ec))
-            stop(ec);
+            complete.stop(ec);
     };
 
     // We must start the service so that stop can be honored.
@@ -29,22 +29,67 @@ namespace commands {
 using namespace bc::system;
 using namespace bc::system::config;
 
+// These are soft requirements for security and rationality.
+// We use bit vs. byte length input as the more familiar convention.
+static bool is_supported(uint16_t bit_length)
+{
+    return bit_length >= minimum_seed_size * byte_bits &&
+        bit_length % byte_bits == 0;
+}
+
+evaluation seed::evaluate(base16& result, const uint16_t& bit_length)
+{
+    if (!is_supported(bit_length))
+        return evaluation::unsupported_length;
+
+    const auto entropy = new_seed(bit_length);
+    if (entropy.empty())
+        return evaluation::no_entropy;
+
+    result = base16(entropy);
+    return evaluation::okay;
+}
+
 console_result seed::invoke(std::ostream& output, std::ostream& error)
 {
     const auto bit_length = get_bit_length_option();
+    const auto count = get_count_option();
 
-    // These are soft requirements for security and rationality.
-    // We use bit vs. byte length input as the more familiar convention.
-    if (bit_length < minimum_seed_size * byte_bits ||
-        bit_length % byte_bits != 0)
+    if (count > 0)
     {
-        error << BX_SEED_BIT_LENGTH_UNSUPPORTED << std::endl;
-        return console_result::failure;
+        if (!is_supported(bit_length))
+        {
+            error << BX_SEED_BIT_LENGTH_UNSUPPORTED << std::endl;
+            return console_result::failure;
+        }
+
+        const auto writer = [](std::ostream& stream,
+            const data_chunk& seed) -> bool
+        {
+            stream << encode_base16(seed) << "\n";
+            return true;
+        };
+
+        if (write_seeded(output, count, bit_length / byte_bits, writer) !=
+            evaluation::okay)
+        {
+            error << BX_ENTROPY_UNAVAILABLE << std::endl;
+            return console_result::failure;
+        }
+
+        return console_result::okay;
     }
 
-    const auto seed = new_seed(bit_length);
+    base16 seed;
+    const auto outcome = evaluate(seed, bit_length);
+    if (outcome != evaluation::okay)
+    {
+        error << (outcome == evaluation::no_entropy ? BX_ENTROPY_UNAVAILABLE :
+            BX_SEED_BIT_LENGTH_UNSUPPORTED) << std::endl;
+        return console_result::failure;
+    }
 
-    output << base16(seed) << std::endl;
+    output << seed << std::endl;
     return console_result::okay;
 }
 
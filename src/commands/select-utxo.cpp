@@ -0,0 +1,271 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <bitcoin/explorer/commands/select-utxo.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include <bitcoin/client.hpp>
+#include <bitcoin/explorer/callback_state.hpp>
+#include <bitcoin/explorer/coin_selection.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/display.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+using namespace std::chrono;
+using namespace bc::client;
+using namespace bc::system;
+using namespace bc::system::chain;
+
+// Virtual sizes used to price the transaction at the fee rate. The key type
+// is unknown, so inputs are priced as the largest common (p2pkh) spend.
+static const uint64_t transaction_overhead_size = 10;
+static const uint64_t input_size = 148;
+static const uint64_t output_size = 34;
+
+// Change below this value is left to the fee rather than create dust.
+static const uint64_t dust_threshold = 546;
+
+// The branch and bound search is limited to this many steps.
+static const size_t search_steps = 100000;
+
+struct unspent
+{
+    hash_digest key;
+    output_point point;
+    uint64_t value;
+    uint64_t effective;
+};
+
+typedef std::vector<unspent> unspent_list;
+
+// Snapshot.
+//-----------------------------------------------------------------------------
+
+// Each line is: KEY TXHASH INDEX VALUE
+static bool read_snapshot(std::map<hash_digest, unspent_list>& out,
+    const boost::filesystem::path& path)
+{
+    ifstream stream(path.string());
+    if (!stream.good())
+        return false;
+
+    std::string line;
+    while (std::getline(stream, line))
+    {
+        if (line.empty())
+            continue;
+
+        std::istringstream fields(line);
+        std::string key_text, hash_text;
+        uint32_t index;
+        uint64_t value;
+        hash_digest key, hash;
+
+        if (!(fields >> key_text >> hash_text >> index >> value) ||
+            !decode_hash(key, key_text) || !decode_hash(hash, hash_text))
+            return false;
+
+        out[key].push_back({ key, output_point{ hash, index }, value, 0 });
+    }
+
+    return true;
+}
+
+static bool write_snapshot(const boost::filesystem::path& path,
+    const std::map<hash_digest, unspent_list>& unspents)
+{
+    ofstream stream(path.string());
+    if (!stream.good())
+        return false;
+
+    for (const auto& entry: unspents)
+        for (const auto& row: entry.second)
+            stream << encode_hash(row.key) << " "
+                << encode_hash(row.point.hash()) << " "
+                << row.point.index() << " " << row.value << "\n";
+
+    stream.flush();
+    return stream.good();
+}
+
+console_result select_utxo::invoke(std::ostream& output, std::ostream& error)
+{
+    // Bound parameters.
+    const auto satoshi = get_satoshi_argument();
+    const auto& keys = get_keys_argument();
+    const auto fee_rate = get_fee_rate_option();
+    const auto budget = get_budget_option();
+    const auto& snapshot = get_snapshot_option();
+    const auto connection = get_connection(*this);
+
+    if (satoshi == 0)
+    {
+        error << BX_SELECT_UTXO_SATOSHI_REQUIRED << std::endl;
+        return console_result::failure;
+    }
+
+    std::map<hash_digest, unspent_list> unspents;
+    const auto cached = !snapshot.empty() &&
+        boost::filesystem::exists(snapshot);
+
+    if (cached && !read_snapshot(unspents, snapshot))
+    {
+        error << format(BX_SELECT_UTXO_SNAPSHOT_INVALID) % snapshot.string()
+            << std::endl;
+        return console_result::failure;
+    }
+
+    std::set<hash_digest> requested;
+    for (const auto& key: keys)
+        requested.insert(key);
+
+    std::vector<hash_digest> missing;
+    for (const auto& key: requested)
+        if (unspents.find(key) == unspents.end())
+            missing.push_back(key);
+
+    // All uncached keys are fetched in one pipelined batch.
+    if (!missing.empty())
+    {
+        obelisk_client client(connection.retries);
+        if (!client.connect(connection))
+        {
+            display_connection_failure(error, connection.server);
+            return console_result::failure;
+        }
+
+        callback_state state(error, output);
+
+        for (const auto& key: missing)
+        {
+            // An empty list records that the key has no unspent outputs.
+            auto& rows = unspents[key];
+
+            auto on_done = [&state, &rows, key](const code& ec,
+                const history::list& history)
+            {
+                if (!state.succeeded(ec))
+                    return;
+
+                for (const auto& row: history)
+                    if (row.output.hash() != null_hash &&
+                        row.spend.hash() == null_hash)
+                        rows.push_back({ key, row.output, row.value, 0 });
+            };
+
+            client.blockchain_fetch_history4(on_done, key);
+        }
+
+        client.wait();
+
+        if (state.get_result() != console_result::okay)
+            return state.get_result();
+
+        if (!snapshot.empty() && !write_snapshot(snapshot, unspents))
+        {
+            error << format(BX_SELECT_UTXO_SNAPSHOT_WRITE_FAILURE) %
+                snapshot.string() << std::endl;
+            return console_result::failure;
+        }
+    }
+
+    // Index the requested keys' unspents by descending effective value,
+    // dropping those that cost more to spend than they are worth.
+    const auto input_fee = fee_rate * input_size;
+    unspent_list pool;
+
+    for (const auto& key: requested)
+    {
+        for (auto row: unspents[key])
+        {
+            if (row.value <= input_fee)
+                continue;
+
+            row.effective = row.value - input_fee;
+            pool.push_back(row);
+        }
+    }
+
+    std::sort(pool.begin(), pool.end(),
+        [](const unspent& left, const unspent& right)
+        {
+            return left.effective > right.effective;
+        });
+
+    const auto target = satoshi + fee_rate *
+        (transaction_overhead_size + output_size);
+    const auto change_fee = fee_rate * output_size;
+    const auto cost_of_change = change_fee + input_fee;
+    const auto deadline = steady_clock::now() + milliseconds(budget);
+
+    std::vector<uint64_t> values;
+    values.reserve(pool.size());
+    for (const auto& row: pool)
+        values.push_back(row.effective);
+
+    // Without a changeless match the selection must also fund change, unless
+    // the change would be dust.
+    std::vector<size_t> selection;
+    auto changeless = false;
+
+    if (!select_coins(selection, changeless, values, target, change_fee,
+        dust_threshold, cost_of_change, search_steps, deadline))
+    {
+        error << format(BX_SELECT_UTXO_INSUFFICIENT) % satoshi << std::endl;
+        return console_result::failure;
+    }
+
+    uint64_t total = 0;
+    for (const auto index: selection)
+    {
+        const auto& row = pool[index];
+        total += row.value;
+        output << encode_hash(row.point.hash()) << ":" << row.point.index()
+            << std::endl;
+    }
+
+    const auto fee_without_change = fee_rate * (transaction_overhead_size +
+        output_size + selection.size() * input_size);
+    const auto change = changeless ? 0 :
+        total - satoshi - fee_without_change - change_fee;
+    const auto fee = total - satoshi - change;
+
+    error << format(BX_SELECT_UTXO_SUMMARY) % total % selection.size() % fee %
+        change << std::endl;
+
+    return console_result::okay;
+}
+
+} //namespace commands
+} //namespace explorer
+} //namespace libbitcoin
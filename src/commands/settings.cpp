@@ -74,6 +74,8 @@ console_result commands::settings::invoke(std::ostream& output,
         get_network_debug_file_setting().string();
     list["network.error_file"] =
         get_network_error_file_setting().string();
+    list["network.log_severity"] =
+        serialize(get_network_log_severity_setting());
 
     network::settings settings(system::config::settings::mainnet);
     const auto& nodes = get_network_seeds_setting();
@@ -102,6 +104,18 @@ console_result commands::settings::invoke(std::ostream& output,
         serialize(get_server_server_public_key_setting());
     list["server.client_private_key"] =
         serialize(get_server_client_private_key_setting());
+    list["server.agent"] =
+        get_server_agent_setting().string();
+    list["server.hedge_url"] =
+        get_server_hedge_url_setting().to_string();
+    list["server.hedge_server_public_key"] =
+        serialize(get_server_hedge_server_public_key_setting());
+    list["server.hedge_percentile"] =
+        serialize(get_server_hedge_percentile_setting());
+    list["server.request_timeout_milliseconds"] =
+        serialize(get_server_request_timeout_milliseconds_setting());
+    list["server.headers_file"] =
+        get_server_headers_file_setting().string();
 
     write_stream(output, system::property_tree(list), encoding);
     return console_result::okay;
@@ -19,10 +19,14 @@
 
 #include <bitcoin/explorer/commands/subscribe-block.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <bitcoin/client.hpp>
+#include <bitcoin/system.hpp>
 #include <bitcoin/explorer/callback_state.hpp>
+#include <bitcoin/explorer/chain_follower.hpp>
 #include <bitcoin/explorer/define.hpp>
 #include <bitcoin/explorer/display.hpp>
 #include <bitcoin/explorer/utility.hpp>
@@ -35,19 +39,236 @@ using namespace bc::client;
 using namespace bc::explorer::config;
 using namespace bc::system;
 
+// The number of block requests outstanding at once when catching up.
+static const size_t range_size = 16;
+
+static code fetch_top(obelisk_client& client, size_t& out)
+{
+    code result;
+    const auto on_done = [&](const code& ec, size_t height)
+    {
+        result = ec;
+        out = height;
+    };
+
+    client.blockchain_fetch_last_height(on_done);
+    client.wait();
+    return result;
+}
+
+static code fetch_hash(obelisk_client& client, size_t height,
+    hash_digest& out)
+{
+    code result;
+    const auto on_done = [&](const code& ec, const chain::header& header)
+    {
+        result = ec;
+        out = header.hash();
+    };
+
+    client.blockchain_fetch_block_header(on_done,
+        static_cast<uint32_t>(height));
+    client.wait();
+    return result;
+}
+
+// Add the outputs that pay the addresses and are unspent at the top to the
+// view. Outputs and spends confirmed above the top, or not yet confirmed,
+// are left to the blocks that follow.
+static code seed(obelisk_client& client, chain_follower& follower,
+    const wallet::payment_address::list& addresses, size_t top)
+{
+    code result;
+
+    // All addresses are fetched in one pipelined batch.
+    for (const auto& address: addresses)
+    {
+        const auto on_done = [&, address](const code& ec,
+            const history::list& rows)
+        {
+            if (ec)
+            {
+                result = ec;
+                return;
+            }
+
+            for (const auto& row: rows)
+            {
+                const auto received = row.output.hash() != null_hash &&
+                    row.output_height != 0 && row.output_height <= top;
+                const auto spent = row.spend.hash() != null_hash &&
+                    row.spend_height != 0 && row.spend_height <= top;
+
+                if (received && !spent)
+                    follower.seed({ row.output, row.value, address });
+            }
+        };
+
+        client.blockchain_fetch_history4(on_done,
+            sha256_hash(address.output_script().to_data(false)));
+    }
+
+    client.wait();
+    return result;
+}
+
+// Disconnect retained blocks that are no longer in the server chain, then
+// connect the server blocks above the fork point. A failure to fetch is
+// reported and left to the next block to retry.
+// Returns false if the fork point is below the retained blocks.
+static bool catch_up(obelisk_client& client, chain_follower& follower,
+    callback_state& state, size_t depth)
+{
+    size_t top = 0;
+    hash_digest hash;
+    auto ec = fetch_top(client, top);
+
+    while (!ec)
+    {
+        if (follower.top_height() <= top)
+        {
+            ec = fetch_hash(client, follower.top_height(), hash);
+            if (ec || hash == follower.top_hash())
+                break;
+        }
+
+        if (!follower.disconnect())
+        {
+            state.error(format(BX_SUBSCRIBE_BLOCK_REORGANIZATION_DEPTH) %
+                depth);
+            return false;
+        }
+    }
+
+    const auto fetch_block = [&client](
+        const range_handler<chain::block>& handler, uint32_t height)
+    {
+        client.blockchain_fetch_block(handler, height);
+    };
+
+    size_t failed = 0;
+    chain::block::list blocks;
+    for (auto next = follower.top_height() + 1; !ec && next <= top;)
+    {
+        const auto count = std::min(range_size, top - next + 1);
+        ec = fetch_range(client, blocks, next, count, failed, fetch_block);
+
+        for (size_t index = 0; !ec && index < count; ++index)
+        {
+            // A reorganization during the catch up is left to the next block.
+            if (!follower.connect(blocks[index]))
+                return true;
+        }
+
+        next += count;
+    }
+
+    if (ec)
+        state.error(format(BX_SUBSCRIBE_BLOCK_CATCH_UP_FAILURE) %
+            ec.message());
+
+    return true;
+}
+
+static void write_event(callback_state& state,
+    const chain_follower::event& event)
+{
+    const auto& output = event.output;
+    state.output(format(event.add ? BX_SUBSCRIBE_BLOCK_ADDED :
+        BX_SUBSCRIBE_BLOCK_REMOVED) % event.height %
+        encode_hash(output.point.hash()) % output.point.index() %
+        output.value % output.address);
+}
+
+// Follow the chain from the server top, connecting each notified block to
+// the retained blocks and catching up when its parent is not retained.
+static console_result follow(const connection_settings& connection,
+    callback_state& state, chain_follower& follower,
+    const wallet::payment_address::list& addresses, size_t depth,
+    uint32_t duration_seconds)
+{
+    obelisk_client query(connection.retries);
+    if (!query.connect(connection))
+    {
+        state.error(format(BX_CONNECTION_FAILURE) % connection.server);
+        return console_result::failure;
+    }
+
+    size_t top = 0;
+    hash_digest hash;
+    auto ec = fetch_top(query, top);
+    if (!ec)
+        ec = fetch_hash(query, top, hash);
+
+    if (!state.succeeded(ec))
+        return console_result::failure;
+
+    follower.start(top, hash);
+
+    if (!state.succeeded(seed(query, follower, addresses, top)))
+        return console_result::failure;
+
+    auto on_block = [&](const chain::block& block)
+    {
+        if (state.stopped() || follower.connect(block))
+            return;
+
+        if (!catch_up(query, follower, state, depth))
+        {
+            state.stop(console_result::failure);
+            return;
+        }
+
+        follower.connect(block);
+    };
+
+    obelisk_client client(connection.retries);
+    if (!client.subscribe_block(connection.block_server, on_block))
+    {
+        state.error(format(BX_SUBSCRIBE_BLOCK_FAILED) %
+            connection.block_server);
+        return console_result::failure;
+    }
+
+    client.monitor(duration_seconds * 1000);
+    return state.get_result();
+}
+
 console_result subscribe_block::invoke(std::ostream& output, std::ostream& error)
 {
     // Bound parameters.
     const auto& encoding = get_format_option();
     const auto& server_url = get_server_url_argument();
     const auto duration_seconds = get_duration_option();
-    auto connection = get_connection(*this);
+    auto connection = get_connection(*this, server_url.empty());
 
     if (!server_url.empty())
         connection.block_server = server_url;
 
     callback_state state(error, output, encoding);
 
+    if (get_follow_option())
+    {
+        const uint8_t p2kh_version =
+            get_wallet_pay_to_public_key_hash_version_setting();
+        const uint8_t p2sh_version =
+            get_wallet_pay_to_script_hash_version_setting();
+        const auto depth = get_depth_option();
+
+        auto addresses = get_addresses_option();
+        for (const auto& key: get_keys_option())
+            addresses.emplace_back(key, p2kh_version);
+
+        chain_follower follower(depth, addresses, p2kh_version, p2sh_version,
+            [&state](const chain_follower::event& event)
+            {
+                write_event(state, event);
+            });
+
+        return follow(connection, state, follower, addresses, depth,
+            duration_seconds);
+    }
+
     auto on_block = [&state](const chain::block& block)
     {
         state.output(property_tree(system::config::header(block.header())));
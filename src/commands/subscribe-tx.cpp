@@ -41,7 +41,7 @@ console_result subscribe_tx::invoke(std::ostream& output, std::ostream& error)
     const auto& encoding = get_format_option();
     const auto& server_url = get_server_url_argument();
     const auto duration_seconds = get_duration_option();
-    auto connection = get_connection(*this);
+    auto connection = get_connection(*this, server_url.empty());
 
     if (!server_url.empty())
         connection.transaction_server = server_url;
@@ -18,8 +18,18 @@
  */
 #include <bitcoin/explorer/commands/tx-encode.hpp>
 
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
 #include <iostream>
+#include <iterator>
+#include <string>
+#include <utility>
 #include <vector>
+#include <boost/algorithm/string.hpp>
+#include <boost/lexical_cast.hpp>
 #include <bitcoin/system.hpp>
 #include <bitcoin/explorer/define.hpp>
 
@@ -31,6 +41,25 @@ using namespace bc::system;
 using namespace bc::system::config;
 using namespace bc::system::wallet;
 
+// Unsigned inputs are sized for weight and fee as signed p2pkh spends, and
+// change as a p2pkh output.
+static const size_t input_size_estimate = 148;
+static const size_t change_size = 34;
+
+// Change below this value is left to the fee rather than create dust.
+static const uint64_t dust_threshold = 546;
+
+// An input and the value of its previous output, if known.
+struct valued_input
+{
+    tx_input_type input;
+    uint64_t value;
+    bool valued;
+};
+
+// The outputs of one output record, as stealth yields two.
+typedef std::vector<tx_output_type> output_group;
+
 static bool push_scripts(std::vector<tx_output_type>& outputs,
     const system::config::output& output, uint8_t script_version)
 {
@@ -66,6 +95,207 @@ static bool push_scripts(std::vector<tx_output_type>& outputs,
     return true;
 }
 
+static size_t compact_size_length(uint64_t value)
+{
+    return value < 0xfd ? 1 : value <= 0xffff ? 3 :
+        value <= 0xffffffff ? 5 : 9;
+}
+
+// Non-witness transactions weigh four units per byte.
+static size_t transaction_size(size_t inputs, size_t outputs,
+    size_t outputs_size)
+{
+    return 2 * sizeof(uint32_t) + compact_size_length(inputs) +
+        compact_size_length(outputs) + inputs * input_size_estimate +
+        outputs_size;
+}
+
+static bool is_amount(const std::string& text)
+{
+    return !text.empty() && std::all_of(text.begin(), text.end(),
+        [](unsigned char character) { return std::isdigit(character) != 0; });
+}
+
+// Parse one record, throwing on an invalid input point or output token.
+static bool read_record(std::vector<valued_input>& inputs,
+    std::vector<output_group>& groups, std::vector<std::string>& fields,
+    uint8_t script_version)
+{
+    if (fields.front() == "input")
+    {
+        if (fields.size() < 2 || fields.size() > 3)
+            return false;
+
+        const system::config::input point(fields[1]);
+        const auto valued = fields.size() == 3;
+
+        if (valued && !is_amount(fields[2]))
+            return false;
+
+        inputs.push_back({ point, valued ?
+            boost::lexical_cast<uint64_t>(fields[2]) : 0, valued });
+        return true;
+    }
+
+    if (fields.front() == "output")
+        fields.erase(fields.begin());
+
+    if (fields.size() < 2 || fields.size() > 3 || !is_amount(fields[1]))
+        return false;
+
+    const system::config::output output(boost::join(fields, ":"));
+
+    output_group group;
+    if (!push_scripts(group, output, script_version))
+        return false;
+
+    groups.push_back(std::move(group));
+    return true;
+}
+
+// Returns the number of the first invalid line, or zero if all are valid.
+static size_t read_records(std::vector<valued_input>& inputs,
+    std::vector<output_group>& groups, std::istream& stream,
+    uint8_t script_version)
+{
+    std::string line;
+    std::vector<std::string> fields;
+
+    for (size_t number = 1; std::getline(stream, line); ++number)
+    {
+        boost::trim(line);
+        if (line.empty() || line.front() == '#')
+            continue;
+
+        boost::split(fields, line, boost::is_any_of(","));
+        for (auto& field: fields)
+            boost::trim(field);
+
+        try
+        {
+            if (!read_record(inputs, groups, fields, script_version))
+                return number;
+        }
+        catch (const std::exception&)
+        {
+            return number;
+        }
+    }
+
+    return 0;
+}
+
+// Outputs are taken in order until the next would exceed the weight limit,
+// and each transaction is funded by the next inputs in order, with change
+// reserved in both the weight and the fee. All inputs must be required.
+// Inputs and outputs are moved into the transactions as each is completed.
+static bool split_transactions(std::vector<tx_type>& out,
+    std::vector<valued_input>& inputs, std::vector<output_group>& groups,
+    const payment_address& change, uint64_t fee_rate,
+    uint32_t max_weight, uint8_t script_version, std::ostream& error)
+{
+    size_t next_input = 0;
+    size_t next_group = 0;
+
+    while (next_group < groups.size())
+    {
+        const auto first_input = next_input;
+        const auto first_group = next_group;
+        uint64_t input_value = 0;
+        uint64_t output_value = 0;
+        size_t output_count = 0;
+        size_t output_bytes = 0;
+
+        while (next_group < groups.size())
+        {
+            auto value = output_value;
+            auto count = output_count;
+            auto bytes = output_bytes;
+
+            for (const auto& output: groups[next_group])
+            {
+                value += output.value();
+                bytes += output.serialized_size(true);
+                ++count;
+            }
+
+            auto input_end = next_input;
+            auto funded = input_value;
+
+            const auto size = [&]()
+            {
+                return transaction_size(input_end - first_input, count + 1,
+                    bytes + change_size);
+            };
+
+            while (funded < value + fee_rate * size() &&
+                input_end < inputs.size())
+                funded += inputs[input_end++].value;
+
+            if (4 * size() > max_weight)
+            {
+                if (next_group == first_group)
+                {
+                    error << BX_TX_ENCODE_SPLIT_OVERWEIGHT << std::endl;
+                    return false;
+                }
+
+                break;
+            }
+
+            if (funded < value + fee_rate * size())
+            {
+                error << BX_TX_ENCODE_SPLIT_INSUFFICIENT << std::endl;
+                return false;
+            }
+
+            next_input = input_end;
+            input_value = funded;
+            output_value = value;
+            output_count = count;
+            output_bytes = bytes;
+            ++next_group;
+        }
+
+        out.emplace_back();
+        auto& tx = out.back();
+
+        auto& tx_inputs = tx.inputs();
+        tx_inputs.reserve(next_input - first_input);
+        for (auto index = first_input; index < next_input; ++index)
+            tx_inputs.push_back(std::move(inputs[index].input));
+
+        auto& tx_outputs = tx.outputs();
+        tx_outputs.reserve(output_count + 1);
+        for (auto index = first_group; index < next_group; ++index)
+            tx_outputs.insert(tx_outputs.end(),
+                std::make_move_iterator(groups[index].begin()),
+                std::make_move_iterator(groups[index].end()));
+
+        const auto fee = fee_rate * transaction_size(tx_inputs.size(),
+            output_count + 1, output_bytes + change_size);
+        const auto remainder = input_value - output_value - fee;
+
+        if (remainder >= dust_threshold)
+        {
+            const system::config::output change_output(
+                change.encoded() + ":" + std::to_string(remainder));
+
+            push_scripts(tx_outputs, change_output, script_version);
+        }
+    }
+
+    // Inputs beyond those that fund the outputs are not silently dropped.
+    if (next_input < inputs.size())
+    {
+        error << format(BX_TX_ENCODE_SPLIT_UNUSED) % (next_input + 1)
+            << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
 console_result tx_encode::invoke(std::ostream& output, std::ostream& error)
 {
     // Bound parameters.
@@ -74,30 +304,116 @@ console_result tx_encode::invoke(std::ostream& output, std::ostream& error)
     const auto script_version = get_script_version_option();
     const auto& inputs = get_inputs_option();
     const auto& outputs = get_outputs_option();
+    const auto& file = get_file_option();
+    const auto max_weight = get_max_weight_option();
+    const auto& change = get_change_option();
+    const auto fee_rate = get_fee_rate_option();
 
-    tx_type tx;
-    tx.set_version(tx_version);
-    tx.set_locktime(locktime);
+    std::vector<valued_input> all_inputs;
+    std::vector<output_group> groups;
+    all_inputs.reserve(inputs.size());
+    groups.reserve(outputs.size());
 
     for (const tx_input_type& input: inputs)
-        tx.inputs().push_back(input);
+        all_inputs.push_back({ input, 0, false });
 
     for (const auto& output: outputs)
     {
-        if (!push_scripts(tx.outputs(), output, script_version))
+        output_group group;
+        if (!push_scripts(group, output, script_version))
         {
             error << BX_TX_ENCODE_INVALID_OUTPUT << std::endl;
             return console_result::failure;
         }
+
+        groups.push_back(std::move(group));
+    }
+
+    if (!file.empty())
+    {
+        size_t invalid;
+        if (file.string() == BX_STDIO_PATH_SENTINEL)
+        {
+            invalid = read_records(all_inputs, groups, get_input(),
+                script_version);
+        }
+        else
+        {
+            ifstream stream(file.string());
+            if (!stream.good())
+            {
+                error << format(BX_TX_ENCODE_FILE_FAILURE) % file.string()
+                    << std::endl;
+                return console_result::failure;
+            }
+
+            invalid = read_records(all_inputs, groups, stream,
+                script_version);
+        }
+
+        if (invalid != 0)
+        {
+            error << format(BX_TX_ENCODE_INVALID_RECORD) % invalid
+                << std::endl;
+            return console_result::failure;
+        }
     }
 
-    if (tx.is_locktime_conflict())
+    std::vector<tx_type> transactions;
+
+    if (max_weight == 0)
     {
-        error << BX_TX_ENCODE_LOCKTIME_CONFLICT << std::endl;
-        return console_result::failure;
+        size_t output_count = 0;
+        for (const auto& group: groups)
+            output_count += group.size();
+
+        transactions.emplace_back();
+        auto& tx = transactions.back();
+
+        tx.inputs().reserve(all_inputs.size());
+        for (auto& input: all_inputs)
+            tx.inputs().push_back(std::move(input.input));
+
+        tx.outputs().reserve(output_count);
+        for (auto& group: groups)
+            tx.outputs().insert(tx.outputs().end(),
+                std::make_move_iterator(group.begin()),
+                std::make_move_iterator(group.end()));
     }
+    else
+    {
+        const auto unvalued = std::any_of(all_inputs.begin(),
+            all_inputs.end(), [](const valued_input& input)
+            {
+                return !input.valued;
+            });
+
+        if (!change || unvalued)
+        {
+            error << BX_TX_ENCODE_SPLIT_REQUIREMENTS << std::endl;
+            return console_result::failure;
+        }
+
+        if (!split_transactions(transactions, all_inputs, groups, change,
+            fee_rate, max_weight, script_version, error))
+            return console_result::failure;
+    }
+
+    for (auto& tx: transactions)
+    {
+        tx.set_version(tx_version);
+        tx.set_locktime(locktime);
+
+        if (tx.is_locktime_conflict())
+        {
+            error << BX_TX_ENCODE_LOCKTIME_CONFLICT << std::endl;
+            return console_result::failure;
+        }
+    }
+
+    for (const auto& tx: transactions)
+        output << transaction(tx) << std::endl;
 
-    output << transaction(tx) << std::endl;
     return console_result::okay;
 }
 
@@ -19,9 +19,21 @@
 
 #include <bitcoin/explorer/commands/watch-key.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <csignal>
 #include <cstddef>
+#include <cstdint>
+#include <deque>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <boost/algorithm/string.hpp>
+#include <boost/filesystem.hpp>
 #include <bitcoin/client.hpp>
 #include <bitcoin/explorer/callback_state.hpp>
 #include <bitcoin/explorer/define.hpp>
@@ -33,25 +45,87 @@ namespace libbitcoin {
 namespace explorer {
 namespace commands {
 
+using namespace std::chrono;
 using namespace bc::client;
 using namespace bc::explorer::config;
 using namespace bc::system;
 using namespace bc::system::wallet;
 
-static void handle_signal(int signal)
+// The monitor is run in slices so that pipe commands, renewals and stop
+// signals are serviced while watching.
+static constexpr uint32_t monitor_slice_milliseconds = 1000;
+
+static std::atomic<bool> stopping(false);
+
+// Lines read from the control pipe, drained by the monitor loop.
+struct pipe_queue
+{
+    std::mutex mutex;
+    std::deque<std::string> lines;
+    bool failed = false;
+};
+
+static void handle_signal(int)
+{
+    stopping = true;
+}
+
+// Opening a named pipe blocks until a writer attaches and reading ends when
+// the last writer detaches, so the pipe is reopened to await the next writer.
+// The reader is detached from the command and so shares ownership of queue.
+static void read_pipe(const boost::filesystem::path path,
+    std::shared_ptr<pipe_queue> queue)
+{
+    while (true)
+    {
+        ifstream stream(path.string());
+
+        if (!stream.good())
+        {
+            std::lock_guard<std::mutex> lock(queue->mutex);
+            queue->failed = true;
+            return;
+        }
+
+        std::string line;
+        while (std::getline(stream, line))
+        {
+            std::lock_guard<std::mutex> lock(queue->mutex);
+            queue->lines.push_back(line);
+        }
+    }
+}
+
+// Parse a pipe line of the form [+|-]KEY.
+static bool parse_command(const std::string& line, bool& add,
+    hash_digest& key)
 {
-    // TODO: exit without process termination.
-    exit(console_result::failure);
+    if (line.size() < 2 || (line.front() != '+' && line.front() != '-'))
+        return false;
+
+    add = (line.front() == '+');
+    return decode_hash(key, line.substr(1));
 }
 
-// This command only halts on failure or timeout.
+// This command only halts on failure, timeout or stop signal.
 // BUGBUG: the server may drop the connection, which is not presently detected.
 console_result watch_key::invoke(std::ostream& output, std::ostream& error)
 {
     // Bound parameters.
-    const hash_digest& key = get_hash_argument();
+    const auto& keys = get_keys_argument();
+    const auto& pipe = get_pipe_option();
     const auto connection = get_connection(*this);
     const auto duration_seconds = get_duration_option();
+    const auto renew_seconds = get_renew_option();
+
+    const auto is_pipe = !pipe.empty();
+
+    if (is_pipe && boost::filesystem::status(pipe).type() !=
+        boost::filesystem::fifo_file)
+    {
+        error << format(BX_WATCH_KEY_PIPE_FAILURE) % pipe.string() << std::endl;
+        return console_result::failure;
+    }
 
     obelisk_client client(connection.retries);
     if (!client.connect(connection))
@@ -62,33 +136,157 @@ console_result watch_key::invoke(std::ostream& output, std::ostream& error)
 
     callback_state state(error, output);
 
-    auto on_update = [&output, &state, &key](const code& ec,
-        uint16_t sequence, size_t height, const hash_digest& tx_hash)
+    // The watched key set, each mapped to whether its waiting has been shown.
+    std::map<hash_digest, bool> watched;
+
+    // Each watched key has one update handler, created by its subscription.
+    std::map<hash_digest, obelisk_client::update_handler> handlers;
+
+    // All subscriptions share the connection and so the one monitor loop.
+    const auto subscribe = [&](const hash_digest& key)
     {
-        if (!state.succeeded(ec))
-            return;
+        auto on_update = [&output, &state, &watched, key](const code& ec,
+            uint16_t sequence, size_t height, const hash_digest& tx_hash)
+        {
+            if (!state.succeeded(ec))
+                return;
+
+            // Updates for a removed key may be in flight, ignore them.
+            const auto it = watched.find(key);
+            if (it == watched.end())
+                return;
 
-        if (tx_hash == null_hash)
-            state.output(format(BX_WATCH_KEY_WAITING) % encode_base16(key));
+            // Renewal acknowledgements are not displayed.
+            if (tx_hash == null_hash && !it->second)
+            {
+                it->second = true;
+                state.output(format(BX_WATCH_KEY_WAITING) % encode_hash(key));
+            }
 
-        ++state;
+            if (sequence > 0 && tx_hash != null_hash)
+                output
+                    << encode_hash(key) << " " << sequence << " " << height
+                    << " " << encode_hash(tx_hash) << std::endl;
+        };
 
-        if (sequence > 0 && tx_hash != null_hash)
-            output
-                << sequence << " " << height << " " << encode_hash(tx_hash)
-                << std::endl;
+        handlers[key] = on_update;
+        client.subscribe_key(on_update, key);
     };
 
-    client.subscribe_key(on_update, key);
+    const auto unsubscribe = [&](const hash_digest& key)
+    {
+        auto on_done = [&state, key](const code& ec)
+        {
+            if (state.succeeded(ec))
+                state.output(format(BX_WATCH_KEY_REMOVED) % encode_hash(key));
+        };
+
+        handlers.erase(key);
+        client.unsubscribe_key(on_done, key);
+    };
+
+    // The client renews a subscription only by subscribing again, which
+    // registers the handler it is given. So the previous registration is
+    // first released and the key's existing handler is subscribed in its
+    // place, leaving one registration and so one output for each update.
+    const auto renew = [&](const hash_digest& key)
+    {
+        auto on_done = [&state](const code& ec)
+        {
+            state.succeeded(ec);
+        };
+
+        client.unsubscribe_key(on_done, key);
+        client.subscribe_key(handlers[key], key);
+    };
+
+    const auto execute = [&](const std::string& line)
+    {
+        auto add = true;
+        hash_digest key;
+        const auto command = boost::trim_copy(line);
+
+        if (command.empty())
+            return;
+
+        if (!parse_command(command, add, key))
+        {
+            state.error(format(BX_WATCH_KEY_INVALID_COMMAND) % command);
+            return;
+        }
+
+        if (add && watched.emplace(key, false).second)
+            subscribe(key);
+        else if (!add && watched.erase(key) != 0)
+            unsubscribe(key);
+    };
+
+    // The watch runs, even with an empty key set, until it fails, times out
+    // or is signaled to stop.
+    state.start();
+
+    for (const auto& key: keys)
+        if (watched.emplace(key, false).second)
+            subscribe(key);
 
     if (state.stopped())
         return state.get_result();
 
+    auto queue = std::make_shared<pipe_queue>();
+
+    if (is_pipe)
+        std::thread(read_pipe, pipe, queue).detach();
+
     // Catch C signals for stopping the program before monitoring timeout.
+    stopping = false;
     signal(SIGTERM, handle_signal);
     signal(SIGINT, handle_signal);
 
-    client.monitor(duration_seconds * 1000);
+    const auto renewal_period = seconds(renew_seconds);
+    const auto deadline = steady_clock::now() + seconds(duration_seconds);
+    auto renewal = steady_clock::now() + renewal_period;
+
+    while (!stopping && !state.stopped())
+    {
+        const auto now = steady_clock::now();
+        if (now >= deadline)
+            break;
+
+        const auto remaining = duration_cast<milliseconds>(deadline - now);
+        const auto slice = std::min<int64_t>(remaining.count(),
+            monitor_slice_milliseconds);
+
+        client.monitor(static_cast<uint32_t>(slice));
+
+        std::deque<std::string> lines;
+        auto failed = false;
+
+        if (is_pipe)
+        {
+            std::lock_guard<std::mutex> lock(queue->mutex);
+            lines.swap(queue->lines);
+            failed = queue->failed;
+        }
+
+        for (const auto& line: lines)
+            execute(line);
+
+        if (failed)
+        {
+            state.error(format(BX_WATCH_KEY_PIPE_FAILURE) % pipe.string());
+            state.stop(console_result::failure);
+            break;
+        }
+
+        // The server expires subscriptions, so renew all before expiration.
+        if (renew_seconds > 0 && steady_clock::now() >= renewal)
+        {
+            for (const auto& entry: watched)
+                renew(entry.first);
+
+            renewal = steady_clock::now() + renewal_period;
+        }
+    }
 
     return state.get_result();
 }
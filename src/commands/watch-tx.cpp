@@ -19,25 +19,199 @@
 
 #include <bitcoin/explorer/commands/watch-tx.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
-#include <bitcoin/system.hpp>
+#include <map>
+#include <thread>
+#include <bitcoin/client.hpp>
+#include <bitcoin/explorer/callback_state.hpp>
 #include <bitcoin/explorer/define.hpp>
-
+#include <bitcoin/explorer/display.hpp>
+#include <bitcoin/explorer/prop_tree.hpp>
+#include <bitcoin/explorer/utility.hpp>
 
 namespace libbitcoin {
 namespace explorer {
 namespace commands {
 
+using namespace std::chrono;
+using namespace bc::client;
+using namespace bc::explorer::config;
 using namespace bc::system;
 
+static const auto event_confirmed = "confirmed";
+static const auto event_reorganized = "reorganized";
+
+// Sleep is sliced so that stop signals are serviced while waiting.
+static const auto sleep_slice = seconds(1);
+
+static std::atomic<bool> stopping(false);
+
+static void handle_signal(int)
+{
+    stopping = true;
+}
+
+// The last known position of a watched transaction in the chain.
+struct position
+{
+    bool confirmed;
+    size_t height;
+    size_t index;
+};
+
+// This command only halts on failure, timeout or stop signal.
 console_result watch_tx::invoke(std::ostream& output, std::ostream& error)
 {
     // Bound parameters.
-    //const auto& hash = get_hash_argument();
-    //const auto& encoding = get_format_option();
+    const auto& encoding = get_format_option();
+    const auto& hashes = get_hashes_argument();
+    const auto connection = get_connection(*this);
+    const auto duration_seconds = get_duration_option();
+    const auto interval_seconds = std::max<uint32_t>(get_interval_option(), 1);
+
+    obelisk_client client(connection.retries);
+    if (!client.connect(connection))
+    {
+        display_connection_failure(error, connection.server);
+        return console_result::failure;
+    }
+
+    callback_state state(error, output, encoding);
+    state.start();
+
+    std::map<hash_digest, position> watched;
+    for (const auto& hash: hashes)
+        watched.emplace(hash, position{ false, 0, 0 });
+
+    size_t tip_height = 0;
+    auto tip_hash = null_hash;
+
+    // The tip changes on each new block and on any reorganization of the top.
+    const auto tip_changed = [&]()
+    {
+        size_t height = 0;
+        auto hash = null_hash;
+
+        auto on_height = [&state, &height](const code& ec, size_t value)
+        {
+            if (state.succeeded(ec))
+                height = value;
+        };
+
+        auto on_header = [&state, &hash](const code& ec,
+            const chain::header& header)
+        {
+            if (state.succeeded(ec))
+                hash = header.hash();
+        };
+
+        client.blockchain_fetch_last_height(on_height);
+        client.wait();
+
+        if (state.stopped())
+            return false;
+
+        client.blockchain_fetch_block_header(on_header,
+            static_cast<uint32_t>(height));
+        client.wait();
+
+        if (state.stopped() || (height == tip_height && hash == tip_hash))
+            return false;
+
+        tip_height = height;
+        tip_hash = hash;
+        return true;
+    };
+
+    // All watched positions are queried in one pipelined batch.
+    const auto refresh = [&]()
+    {
+        for (auto& entry: watched)
+        {
+            const auto& hash = entry.first;
+            auto& last = entry.second;
+
+            auto on_done = [&state, &hash, &last](const code& ec,
+                size_t height, size_t index)
+            {
+                if (ec && ec != error::not_found)
+                {
+                    state.succeeded(ec);
+                    return;
+                }
+
+                const position current{ !ec, height, index };
+
+                if (last.confirmed && (!current.confirmed ||
+                    current.height != last.height ||
+                    current.index != last.index))
+                {
+                    state.output(prop_tree(event_reorganized, hash,
+                        last.height, last.index));
+                    last.confirmed = false;
+                }
+
+                if (current.confirmed && !last.confirmed)
+                {
+                    state.output(prop_tree(event_confirmed, hash,
+                        current.height, current.index));
+                    last = current;
+                }
+            };
+
+            client.blockchain_fetch_transaction_index(on_done, hash);
+        }
+
+        client.wait();
+    };
+
+    tip_changed();
+    refresh();
+
+    if (state.stopped())
+        return state.get_result();
+
+    for (const auto& entry: watched)
+        if (!entry.second.confirmed)
+            state.output(format(BX_WATCH_TX_WAITING) %
+                encode_hash(entry.first));
+
+    // Catch C signals for stopping the program before watch timeout.
+    stopping = false;
+    signal(SIGTERM, handle_signal);
+    signal(SIGINT, handle_signal);
+
+    const auto interval = seconds(interval_seconds);
+    const auto deadline = steady_clock::now() + seconds(duration_seconds);
+    auto poll = steady_clock::now() + interval;
+
+    while (!stopping && !state.stopped())
+    {
+        const auto now = steady_clock::now();
+        if (now >= deadline)
+            break;
+
+        if (now < poll)
+        {
+            std::this_thread::sleep_for(std::min<steady_clock::duration>(
+                sleep_slice, std::min(poll, deadline) - now));
+            continue;
+        }
+
+        // Positions cannot change unless the tip changes.
+        if (tip_changed())
+            refresh();
+
+        poll = steady_clock::now() + interval;
+    }
 
-    error << BX_WATCH_TX_NOT_IMPLEMENTED << std::endl;
-    return console_result::failure;
+    return state.get_result();
 }
 
 } //namespace commands
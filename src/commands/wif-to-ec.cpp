@@ -30,12 +30,21 @@ namespace commands {
 
 using namespace bc::system;
 
+evaluation wif_to_ec::evaluate(config::ec_private& result,
+    const wallet::ec_private& wif)
+{
+    result = config::ec_private(wif);
+    return evaluation::okay;
+}
+
 console_result wif_to_ec::invoke(std::ostream& output, std::ostream& error)
 {
     // Bound parameters.
-    const auto& secret = get_wif_argument();
+    const auto& wif = get_wif_argument();
 
-    output << config::ec_private(secret) << std::endl;
+    config::ec_private secret;
+    evaluate(secret, wif);
+    output << secret << std::endl;
     return console_result::okay;
 }
 
@@ -30,12 +30,21 @@ namespace commands {
 using namespace bc::system;
 using namespace bc::system::wallet;
 
+evaluation wif_to_public::evaluate(ec_public& result,
+    const ec_private& wif)
+{
+    result = ec_public(wif);
+    return evaluation::okay;
+}
+
 console_result wif_to_public::invoke(std::ostream& output, std::ostream& error)
 {
     // Bound parameters.
-    const auto& secret = get_wif_argument();
+    const auto& wif = get_wif_argument();
 
-    output << ec_public(secret) << std::endl;
+    ec_public point;
+    evaluate(point, wif);
+    output << point << std::endl;
     return console_result::okay;
 }
 
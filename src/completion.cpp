@@ -0,0 +1,59 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/completion.hpp>
+
+#include <future>
+#include <mutex>
+#include <bitcoin/system.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+using namespace bc::system;
+
+completion::completion()
+  : completed_(false)
+{
+}
+
+void completion::stop(const code& ec)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!completed_)
+    {
+        completed_ = true;
+        complete_.set_value(ec);
+    }
+}
+
+void completion::restart()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    complete_ = std::promise<code>();
+    completed_ = false;
+}
+
+std::future<code> completion::get_future()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return complete_.get_future();
+}
+
+} // namespace explorer
+} // namespace libbitcoin
@@ -18,11 +18,13 @@
  */
 #include <bitcoin/explorer/config/ec_private.hpp>
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <string>
 #include <boost/program_options.hpp>
 #include <bitcoin/system.hpp>
+#include <bitcoin/explorer/codec.hpp>
 #include <bitcoin/explorer/define.hpp>
 
 namespace libbitcoin {
@@ -35,7 +37,12 @@ using namespace po;
 // ec_secret base16 format is private to bx.
 static bool decode_secret(ec_secret& secret, const std::string& encoded)
 {
-    return decode_base16(secret, encoded) && verify(secret);
+    data_chunk decoded;
+    if (!from_base16(decoded, encoded) || decoded.size() != secret.size())
+        return false;
+
+    std::copy(decoded.begin(), decoded.end(), secret.begin());
+    return verify(secret);
 }
 
 ec_private::ec_private(const std::string& hexcode)
@@ -68,7 +75,7 @@ std::istream& operator>>(std::istream& input, ec_private& argument)
 
 std::ostream& operator<<(std::ostream& output, const ec_private& argument)
 {
-    output << encode_base16(argument.value_);
+    output << to_base16(argument.value_);
     return output;
 }
 
@@ -25,6 +25,7 @@
 #include <cstdint>
 #include <boost/program_options.hpp>
 #include <bitcoin/system.hpp>
+#include <bitcoin/explorer/codec.hpp>
 #include <bitcoin/explorer/define.hpp>
 
 namespace libbitcoin {
@@ -38,8 +39,8 @@ using namespace po;
 static bool decode_endorsement(system::endorsement& endorsement,
     const std::string& encoded)
 {
-    system::endorsement decoded;
-    if (!decode_base16(decoded, encoded) ||
+    data_chunk decoded;
+    if (!from_base16(decoded, encoded) ||
         (decoded.size() > max_endorsement_size))
         return false;
 
@@ -49,7 +50,7 @@ static bool decode_endorsement(system::endorsement& endorsement,
 
 static std::string encode_endorsement(data_slice signature)
 {
-    return encode_base16(signature);
+    return to_base16(signature);
 }
 
 endorsement::endorsement()
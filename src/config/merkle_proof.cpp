@@ -0,0 +1,118 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/config/merkle_proof.hpp>
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <boost/program_options.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace config {
+
+using namespace bc::system;
+using namespace po;
+
+static const auto proof_delimiter = ":";
+
+merkle_proof::merkle_proof()
+  : height_(0), index_(0), hash_(null_hash), branch_()
+{
+}
+
+merkle_proof::merkle_proof(const std::string& text)
+{
+    std::stringstream(text) >> *this;
+}
+
+merkle_proof::merkle_proof(uint32_t height, uint32_t index,
+    const hash_digest& hash, const hash_list& branch)
+  : height_(height), index_(index), hash_(hash), branch_(branch)
+{
+}
+
+merkle_proof::merkle_proof(const merkle_proof& other)
+  : merkle_proof(other.height_, other.index_, other.hash_, other.branch_)
+{
+}
+
+uint32_t merkle_proof::height() const
+{
+    return height_;
+}
+
+uint32_t merkle_proof::index() const
+{
+    return index_;
+}
+
+const hash_digest& merkle_proof::hash() const
+{
+    return hash_;
+}
+
+const hash_list& merkle_proof::branch() const
+{
+    return branch_;
+}
+
+std::istream& operator>>(std::istream& input, merkle_proof& argument)
+{
+    std::string text;
+    input >> text;
+
+    const auto tokens = split(text, proof_delimiter);
+    if (tokens.size() < 3 ||
+        !deserialize(argument.height_, tokens[0], true) ||
+        !deserialize(argument.index_, tokens[1], true) ||
+        !decode_hash(argument.hash_, tokens[2]))
+    {
+        BOOST_THROW_EXCEPTION(invalid_option_value(text));
+    }
+
+    argument.branch_.resize(tokens.size() - 3);
+    for (size_t level = 0; level < argument.branch_.size(); ++level)
+    {
+        if (!decode_hash(argument.branch_[level], tokens[level + 3]))
+        {
+            BOOST_THROW_EXCEPTION(invalid_option_value(text));
+        }
+    }
+
+    return input;
+}
+
+std::ostream& operator<<(std::ostream& output, const merkle_proof& argument)
+{
+    output << argument.height_ << proof_delimiter << argument.index_ <<
+        proof_delimiter << encode_hash(argument.hash_);
+
+    for (const auto& hash: argument.branch_)
+        output << proof_delimiter << encode_hash(hash);
+
+    return output;
+}
+
+} // namespace explorer
+} // namespace config
+} // namespace libbitcoin
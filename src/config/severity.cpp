@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/config/severity.hpp>
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <boost/program_options.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace config {
+
+using namespace bc::system;
+using namespace po;
+
+static auto severity_debug = "debug";
+static auto severity_info = "info";
+static auto severity_warning = "warning";
+static auto severity_error = "error";
+static auto severity_fatal = "fatal";
+
+severity::severity()
+  : severity(log::severity::info)
+{
+}
+
+severity::severity(const std::string& token)
+{
+    std::stringstream(token) >> *this;
+}
+
+severity::severity(log::severity level)
+  : value_(level)
+{
+}
+
+severity::severity(const severity& other)
+  : value_(other.value_)
+{
+}
+
+severity::operator log::severity() const
+{
+    return value_;
+}
+
+std::istream& operator>>(std::istream& input, severity& argument)
+{
+    std::string text;
+    input >> text;
+
+    if (text == severity_debug)
+    {
+        argument.value_ = log::severity::debug;
+    }
+    else if (text == severity_info)
+    {
+        argument.value_ = log::severity::info;
+    }
+    else if (text == severity_warning)
+    {
+        argument.value_ = log::severity::warning;
+    }
+    else if (text == severity_error)
+    {
+        argument.value_ = log::severity::error;
+    }
+    else if (text == severity_fatal)
+    {
+        argument.value_ = log::severity::fatal;
+    }
+    else
+    {
+        BOOST_THROW_EXCEPTION(invalid_option_value(text));
+    }
+
+    return input;
+}
+
+std::ostream& operator<<(std::ostream& output, const severity& argument)
+{
+    std::string text;
+
+    switch (argument.value_)
+    {
+        case log::severity::debug:
+            text = severity_debug;
+            break;
+        case log::severity::info:
+            text = severity_info;
+            break;
+        case log::severity::warning:
+            text = severity_warning;
+            break;
+        case log::severity::error:
+            text = severity_error;
+            break;
+        case log::severity::fatal:
+            text = severity_fatal;
+            break;
+        default:
+            BITCOIN_ASSERT_MSG(false, "Unexpected severity value.");
+    }
+
+    output << text;
+    return output;
+}
+
+} // namespace config
+} // namespace explorer
+} // namespace libbitcoin
@@ -25,6 +25,7 @@
 #include <cstdint>
 #include <boost/program_options.hpp>
 #include <bitcoin/system.hpp>
+#include <bitcoin/explorer/codec.hpp>
 #include <bitcoin/explorer/define.hpp>
 
 namespace libbitcoin {
@@ -38,9 +39,8 @@ using namespace po;
 static bool decode_signature(wallet::message_signature& signature,
     const std::string& encoded)
 {
-    // There is no bc::decode_base64 array-based override.
     data_chunk decoded;
-    if (!decode_base64(decoded, encoded) ||
+    if (!from_base64(decoded, encoded) ||
         (decoded.size() != wallet::message_signature_size))
         return false;
 
@@ -50,7 +50,7 @@ static bool decode_signature(wallet::message_signature& signature,
 
 static std::string encode_signature(const wallet::message_signature& signature)
 {
-    return encode_base64(signature);
+    return to_base64(signature);
 }
 
 signature::signature()
@@ -21,6 +21,7 @@
 #include <iostream>
 #include <boost/program_options.hpp>
 #include <bitcoin/system.hpp>
+#include <bitcoin/explorer/codec.hpp>
 #include <bitcoin/explorer/define.hpp>
 #include <bitcoin/explorer/utility.hpp>
 
@@ -43,7 +44,7 @@ wrapper::wrapper(const std::string& wrapped)
 }
 
 wrapper::wrapper(const data_chunk& wrapped)
-  : wrapper(encode_base16(wrapped))
+  : wrapper(to_base16(wrapped))
 {
 }
 
@@ -53,7 +54,7 @@ wrapper::wrapper(const wallet::wrapped_data& wrapped)
 }
 
 wrapper::wrapper(const wallet::payment_address& address)
-  : wrapper(encode_base16(address.to_payment()))
+  : wrapper(to_base16(address.to_payment()))
 {
 }
 
@@ -83,7 +84,8 @@ std::istream& operator>>(std::istream& input, wrapper& argument)
     input >> hexcode;
 
     // The checksum is validated here.
-    if (!unwrap(argument.value_, base16(hexcode)))
+    data_chunk bytes;
+    if (!from_base16(bytes, hexcode) || !unwrap(argument.value_, bytes))
     {
         BOOST_THROW_EXCEPTION(invalid_option_value(hexcode));
     }
@@ -95,7 +97,7 @@ std::ostream& operator<<(std::ostream& output, const wrapper& argument)
 {
     // The checksum is calculated here (value_ checksum is ignored).
     const auto bytes = wrap(argument.value_);
-    output << base16(bytes);
+    output << to_base16(bytes);
     return output;
 }
 
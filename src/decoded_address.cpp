@@ -0,0 +1,167 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/decoded_address.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <boost/algorithm/string.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/codec.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+using namespace bc::system;
+using namespace bc::system::machine;
+
+// The message header identifiers (magic) of testnet and regtest.
+static const uint32_t testnet_identifier = 118034699;
+static const uint32_t regtest_identifier = 3669344250;
+
+// The separator of the bech32 prefix from the data, its last '1'.
+static const char bech32_separator = '1';
+
+// A Base58Check address is a version, a short hash and a checksum.
+static const size_t base58_address_size = 1 + short_hash_size + checksum_size;
+
+// The longest output script, pay to witness script hash.
+static const size_t max_script_size = 2 + hash_size;
+
+static uint8_t code(opcode value)
+{
+    return static_cast<uint8_t>(value);
+}
+
+static bool decode_base58_address(decoded_address& out,
+    const std::string& text, uint8_t p2kh_version, uint8_t p2sh_version)
+{
+    std::array<uint8_t, base58_address_size> buffer;
+    if (!from_base58(buffer.data(), buffer.size(), text))
+        return false;
+
+    const auto checksum = buffer.end() - checksum_size;
+    const auto hash = bitcoin_hash(data_slice(buffer.data(),
+        buffer.data() + short_hash_size + 1));
+    if (!std::equal(checksum, buffer.end(), hash.begin()))
+        return false;
+
+    const auto version = buffer.front();
+    if (version != p2kh_version && version != p2sh_version)
+        return false;
+
+    out.script = (version == p2sh_version);
+    out.witness = false;
+    out.size = short_hash_size;
+    std::copy(buffer.begin() + 1, checksum, out.hash.begin());
+    return true;
+}
+
+// The prefix is case insensitive, though a valid address is not mixed case.
+static bool decode_witness_address(decoded_address& out,
+    const std::string& text, const std::string& prefix)
+{
+    const auto separator = text.rfind(bech32_separator);
+    if (separator == std::string::npos ||
+        !boost::iequals(text.substr(0, separator), prefix))
+        return false;
+
+    const wallet::witness_address address(text);
+    if (!address)
+        return false;
+
+    // Only version zero programs are committed to by the payments key.
+    const auto script = address.output_script();
+    const auto& operations = script.operations();
+    if (operations.size() != 2 ||
+        operations.front().code() != opcode::push_size_0)
+        return false;
+
+    const auto& program = operations.back().data();
+    if (program.size() != short_hash_size && program.size() != hash_size)
+        return false;
+
+    out.script = (program.size() == hash_size);
+    out.witness = true;
+    out.size = program.size();
+    std::copy(program.begin(), program.end(), out.hash.begin());
+    return true;
+}
+
+std::string witness_prefix(uint32_t identifier)
+{
+    switch (identifier)
+    {
+        case testnet_identifier:
+            return "tb";
+        case regtest_identifier:
+            return "bcrt";
+        default:
+            return "bc";
+    }
+}
+
+// Bech32 is left to the witness address, as it is rare in bulk lists.
+bool decode_address(decoded_address& out, const std::string& text,
+    uint8_t p2kh_version, uint8_t p2sh_version, const std::string& prefix)
+{
+    return decode_base58_address(out, text, p2kh_version, p2sh_version) ||
+        decode_witness_address(out, text, prefix);
+}
+
+hash_digest payments_key(const decoded_address& address)
+{
+    std::array<uint8_t, max_script_size> script;
+    auto it = script.begin();
+
+    const auto push_hash = [&]()
+    {
+        *it++ = static_cast<uint8_t>(address.size);
+        it = std::copy(address.hash.begin(),
+            address.hash.begin() + address.size, it);
+    };
+
+    if (address.witness)
+    {
+        *it++ = code(opcode::push_size_0);
+        push_hash();
+    }
+    else if (address.script)
+    {
+        *it++ = code(opcode::hash160);
+        push_hash();
+        *it++ = code(opcode::equal);
+    }
+    else
+    {
+        *it++ = code(opcode::dup);
+        *it++ = code(opcode::hash160);
+        push_hash();
+        *it++ = code(opcode::equalverify);
+        *it++ = code(opcode::checksig);
+    }
+
+    return sha256_hash(data_slice(script.data(),
+        script.data() + (it - script.begin())));
+}
+
+} // namespace explorer
+} // namespace libbitcoin
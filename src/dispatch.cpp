@@ -19,17 +19,17 @@
 #include <bitcoin/explorer/dispatch.hpp>
 
 #include <iostream>
+#include <memory>
 #include <string>
-#include <boost/core/null_deleter.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/program_options.hpp>
+#include <bitcoin/explorer/async_log.hpp>
 #include <bitcoin/explorer/command.hpp>
-#include <bitcoin/explorer/commands/broadcast-tx.hpp>
-#include <bitcoin/explorer/commands/put-tx.hpp>
 #include <bitcoin/explorer/define.hpp>
 #include <bitcoin/explorer/display.hpp>
 #include <bitcoin/explorer/generated.hpp>
 #include <bitcoin/explorer/parser.hpp>
+#include <bitcoin/explorer/relay.hpp>
 #include <bitcoin/system.hpp>
 
 namespace libbitcoin {
@@ -41,8 +41,6 @@ using namespace boost::filesystem;
 using namespace boost::program_options;
 using namespace boost::system;
 
-static const auto mode = std::ofstream::out | std::ofstream::app;
-
 // Swap Unicode input stream for binary stream in Windows builds.
 static std::istream& get_command_input(command& command, std::istream& input)
 {
@@ -126,23 +124,20 @@ console_result dispatch_command(int argc, const char* argv[],
         return console_result::okay;
     }
 
-    // TODO: move log determination into generated command static.
-    if ((target == commands::put_tx::symbol()) ||
-        (target == commands::broadcast_tx::symbol()))
-    {
-        auto debug_file = command->get_network_debug_file_setting().string();
-        auto error_file = command->get_network_error_file_setting().string();
-
-        auto debug_log = boost::make_shared<ofstream>(debug_file, mode);
-        auto error_log = boost::make_shared<ofstream>(error_file, mode);
+    // The network log is written until the command returns.
+    std::unique_ptr<async_log> network_log;
+    if (command->requires_network())
+        network_log.reset(new async_log(
+            command->get_network_debug_file_setting(),
+            command->get_network_error_file_setting(),
+            command->get_network_log_severity_setting()));
 
-        log::stream console_out(&output, null_deleter());
-        log::stream console_err(&error, null_deleter());
-
-        log::initialize(debug_log, error_log, console_out, console_err, false);
-    }
+    command->set_input(in);
+    const auto result = command->invoke(out, err);
 
-    return command->invoke(out, err);
+    // The relay is started by the first server request of the command.
+    stop_process_relay(err);
+    return result;
 }
 
 } // namespace explorer
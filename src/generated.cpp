@@ -36,10 +36,12 @@ using namespace commands;
 
 void broadcast(const function<void(shared_ptr<command>)> func)
 {
+    func(make_shared<address_batch>());
     func(make_shared<address_decode>());
     func(make_shared<address_embed>());
     func(make_shared<address_encode>());
     func(make_shared<address_to_key>());
+    func(make_shared<agent>());
     func(make_shared<base16_decode>());
     func(make_shared<base16_encode>());
     func(make_shared<base58_decode>());
@@ -54,6 +56,7 @@ void broadcast(const function<void(shared_ptr<command>)> func)
     func(make_shared<btc_to_satoshi>());
     func(make_shared<cert_new>());
     func(make_shared<cert_public>());
+    func(make_shared<compute_filters>());
     func(make_shared<ec_add>());
     func(make_shared<ec_add_secrets>());
     func(make_shared<ec_decompress>());
@@ -74,10 +77,12 @@ void broadcast(const function<void(shared_ptr<command>)> func)
     func(make_shared<ek_to_ec>());
     func(make_shared<electrum_new>());
     func(make_shared<electrum_to_seed>());
+    func(make_shared<export_blocks>());
     func(make_shared<fetch_balance>());
     func(make_shared<fetch_block>());
     func(make_shared<fetch_block_hashes>());
     func(make_shared<fetch_block_height>());
+    func(make_shared<fetch_block_txs>());
     func(make_shared<fetch_filter>());
     func(make_shared<fetch_filter_checkpoint>());
     func(make_shared<fetch_filter_headers>());
@@ -88,6 +93,7 @@ void broadcast(const function<void(shared_ptr<command>)> func)
     func(make_shared<fetch_tx>());
     func(make_shared<fetch_tx_index>());
     func(make_shared<fetch_utxo>());
+    func(make_shared<fetch_wallet>());
     func(make_shared<get_filter_checkpoint>());
     func(make_shared<get_filter_headers>());
     func(make_shared<get_filters>());
@@ -98,18 +104,23 @@ void broadcast(const function<void(shared_ptr<command>)> func)
     func(make_shared<hd_to_ec>());
     func(make_shared<hd_to_public>());
     func(make_shared<hd_to_wif>());
+    func(make_shared<header_sync>());
     func(make_shared<help>());
     func(make_shared<input_set>());
     func(make_shared<input_sign>());
     func(make_shared<input_validate>());
     func(make_shared<match_neutrino_address>());
     func(make_shared<match_neutrino_script>());
+    func(make_shared<merkle_branch>());
+    func(make_shared<merkle_verify>());
+    func(make_shared<message_batch>());
     func(make_shared<message_sign>());
     func(make_shared<message_validate>());
     func(make_shared<mnemonic_decode>());
     func(make_shared<mnemonic_encode>());
     func(make_shared<mnemonic_new>());
     func(make_shared<mnemonic_to_seed>());
+    func(make_shared<pipeline>());
     func(make_shared<put_tx>());
     func(make_shared<qrcode>());
     func(make_shared<ripemd160>());
@@ -119,6 +130,7 @@ void broadcast(const function<void(shared_ptr<command>)> func)
     func(make_shared<script_to_address>());
     func(make_shared<script_to_key>());
     func(make_shared<seed>());
+    func(make_shared<select_utxo>());
     func(make_shared<send_tx>());
     func(make_shared<settings>());
     func(make_shared<sha160>());
@@ -150,6 +162,8 @@ void broadcast(const function<void(shared_ptr<command>)> func)
 
 shared_ptr<command> find(const string& symbol)
 {
+    if (symbol == address_batch::symbol())
+        return make_shared<address_batch>();
     if (symbol == address_decode::symbol())
         return make_shared<address_decode>();
     if (symbol == address_embed::symbol())
@@ -158,6 +172,8 @@ shared_ptr<command> find(const string& symbol)
         return make_shared<address_encode>();
     if (symbol == address_to_key::symbol())
         return make_shared<address_to_key>();
+    if (symbol == agent::symbol())
+        return make_shared<agent>();
     if (symbol == base16_decode::symbol())
         return make_shared<base16_decode>();
     if (symbol == base16_encode::symbol())
@@ -186,6 +202,8 @@ shared_ptr<command> find(const string& symbol)
         return make_shared<cert_new>();
     if (symbol == cert_public::symbol())
         return make_shared<cert_public>();
+    if (symbol == compute_filters::symbol())
+        return make_shared<compute_filters>();
     if (symbol == ec_add::symbol())
         return make_shared<ec_add>();
     if (symbol == ec_add_secrets::symbol())
@@ -226,6 +244,8 @@ shared_ptr<command> find(const string& symbol)
         return make_shared<electrum_new>();
     if (symbol == electrum_to_seed::symbol())
         return make_shared<electrum_to_seed>();
+    if (symbol == export_blocks::symbol())
+        return make_shared<export_blocks>();
     if (symbol == fetch_balance::symbol())
         return make_shared<fetch_balance>();
     if (symbol == fetch_block::symbol())
@@ -234,6 +254,8 @@ shared_ptr<command> find(const string& symbol)
         return make_shared<fetch_block_hashes>();
     if (symbol == fetch_block_height::symbol())
         return make_shared<fetch_block_height>();
+    if (symbol == fetch_block_txs::symbol())
+        return make_shared<fetch_block_txs>();
     if (symbol == fetch_filter::symbol())
         return make_shared<fetch_filter>();
     if (symbol == fetch_filter_checkpoint::symbol())
@@ -254,6 +276,8 @@ shared_ptr<command> find(const string& symbol)
         return make_shared<fetch_tx_index>();
     if (symbol == fetch_utxo::symbol())
         return make_shared<fetch_utxo>();
+    if (symbol == fetch_wallet::symbol())
+        return make_shared<fetch_wallet>();
     if (symbol == get_filter_checkpoint::symbol())
         return make_shared<get_filter_checkpoint>();
     if (symbol == get_filter_headers::symbol())
@@ -274,6 +298,8 @@ shared_ptr<command> find(const string& symbol)
         return make_shared<hd_to_public>();
     if (symbol == hd_to_wif::symbol())
         return make_shared<hd_to_wif>();
+    if (symbol == header_sync::symbol())
+        return make_shared<header_sync>();
     if (symbol == help::symbol())
         return make_shared<help>();
     if (symbol == input_set::symbol())
@@ -286,6 +312,12 @@ shared_ptr<command> find(const string& symbol)
         return make_shared<match_neutrino_address>();
     if (symbol == match_neutrino_script::symbol())
         return make_shared<match_neutrino_script>();
+    if (symbol == merkle_branch::symbol())
+        return make_shared<merkle_branch>();
+    if (symbol == merkle_verify::symbol())
+        return make_shared<merkle_verify>();
+    if (symbol == message_batch::symbol())
+        return make_shared<message_batch>();
     if (symbol == message_sign::symbol())
         return make_shared<message_sign>();
     if (symbol == message_validate::symbol())
@@ -298,6 +330,8 @@ shared_ptr<command> find(const string& symbol)
         return make_shared<mnemonic_new>();
     if (symbol == mnemonic_to_seed::symbol())
         return make_shared<mnemonic_to_seed>();
+    if (symbol == pipeline::symbol())
+        return make_shared<pipeline>();
     if (symbol == put_tx::symbol())
         return make_shared<put_tx>();
     if (symbol == qrcode::symbol())
@@ -316,6 +350,8 @@ shared_ptr<command> find(const string& symbol)
         return make_shared<script_to_key>();
     if (symbol == seed::symbol())
         return make_shared<seed>();
+    if (symbol == select_utxo::symbol())
+        return make_shared<select_utxo>();
     if (symbol == send_tx::symbol())
         return make_shared<send_tx>();
     if (symbol == settings::symbol())
@@ -0,0 +1,273 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/header_chain.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <bitcoin/system.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+using namespace bc::system;
+using namespace boost::interprocess;
+
+const size_t header_chain::record_size;
+const size_t header_chain::confirmation_depth;
+
+// The message header identifiers (magic) of testnet and regtest.
+static const uint32_t testnet_identifier = 118034699;
+static const uint32_t regtest_identifier = 3669344250;
+
+// The retargeting consensus values, which are common to the networks.
+static const size_t retargeting_interval = 2016;
+static const uint32_t target_timespan = 14 * 24 * 60 * 60;
+static const uint32_t target_spacing = 10 * 60;
+static const uint32_t retargeting_factor = 4;
+
+// The work required of the first header of a period, from the timespan of
+// the preceding period, bounded by the factor and capped at the limit.
+static uint32_t retarget(uint32_t bits, int64_t timespan, uint32_t limit)
+{
+    const int64_t minimum = target_timespan / retargeting_factor;
+    const int64_t maximum = target_timespan * retargeting_factor;
+    const auto bounded = std::min(std::max(timespan, minimum), maximum);
+
+    uint256_t target(chain::compact{ bits });
+    target *= static_cast<uint64_t>(bounded);
+    target /= target_timespan;
+
+    const uint256_t maximum_target(chain::compact{ limit });
+    return chain::compact(std::min(target, maximum_target)).normal();
+}
+
+// The state of the chain at the header following the header at the height.
+static void advance(header_chain::work_state& state,
+    const header_chain::work_rules& rules, const chain::header& header)
+{
+    const auto first = state.height % retargeting_interval == 0;
+
+    if (first || header.bits() != rules.limit)
+        state.last_bits = header.bits();
+
+    if (first)
+        state.period_time = header.timestamp();
+
+    state.bits = header.bits();
+    state.time = header.timestamp();
+    ++state.height;
+}
+
+static header_chain::work_rules make_rules(system::config::settings network,
+    bool retarget, bool easy_blocks)
+{
+    const system::settings settings(network);
+    const chain::block& genesis = settings.genesis_block;
+    return { settings.proof_of_work_limit, retarget, easy_blocks,
+        genesis.header().hash() };
+}
+
+header_chain::work_rules header_chain::rules(uint32_t identifier)
+{
+    typedef system::config::settings network;
+
+    switch (identifier)
+    {
+        case testnet_identifier:
+            return make_rules(network::testnet, true, true);
+        case regtest_identifier:
+            return make_rules(network::regtest, false, true);
+        default:
+            return make_rules(network::mainnet, true, false);
+    }
+}
+
+// Within a period the work is that of the preceding header, except that on
+// testnet a late header may be of the limit, which is then disregarded.
+uint32_t header_chain::work_required(const work_rules& rules,
+    const work_state& state, uint32_t time)
+{
+    if (!rules.retarget)
+        return state.bits;
+
+    if (state.height % retargeting_interval == 0)
+        return retarget(state.bits, static_cast<int64_t>(state.time) -
+            state.period_time, rules.limit);
+
+    if (rules.easy_blocks)
+        return static_cast<uint64_t>(time) > static_cast<uint64_t>(
+            state.time) + 2 * target_spacing ? rules.limit : state.last_bits;
+
+    return state.bits;
+}
+
+header_chain::header_chain(const boost::filesystem::path& file)
+  : file_(file)
+{
+}
+
+bool header_chain::open()
+{
+    close();
+
+    // An empty file cannot be mapped.
+    boost::system::error_code ec;
+    const auto size = boost::filesystem::file_size(file_, ec);
+    if (ec || size < record_size)
+        return false;
+
+    try
+    {
+        mapping_.reset(new file_mapping(file_.string().c_str(), read_only));
+        region_.reset(new mapped_region(*mapping_, read_only));
+    }
+    catch (const interprocess_exception&)
+    {
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+void header_chain::close()
+{
+    region_.reset();
+    mapping_.reset();
+}
+
+// A partial record, from an interrupted write, is ignored.
+size_t header_chain::size() const
+{
+    return region_ ? region_->get_size() / record_size : 0;
+}
+
+bool header_chain::get(chain::header& out, size_t height) const
+{
+    if (height >= size())
+        return false;
+
+    const auto begin = static_cast<const uint8_t*>(region_->get_address()) +
+        height * record_size;
+
+    return out.from_data(data_chunk(begin, begin + record_size));
+}
+
+bool header_chain::get_confirmed(chain::header& out, size_t height) const
+{
+    return height + confirmation_depth < size() && get(out, height);
+}
+
+// The state is advanced from the first header of the preceding period.
+bool header_chain::get_state(work_state& out, const work_rules& rules,
+    size_t height) const
+{
+    out = { 0, rules.limit, rules.limit, 0, 0 };
+
+    if (height == 0)
+        return true;
+
+    if (height > size())
+        return false;
+
+    const auto period = (height - 1) / retargeting_interval;
+    out.height = period * retargeting_interval;
+
+    chain::header header;
+    for (auto index = out.height; index < height; ++index)
+    {
+        if (!get(header, index))
+            return false;
+
+        advance(out, rules, header);
+    }
+
+    return true;
+}
+
+// The work required is checked in order, as it depends on the preceding
+// headers, and it is cheap relative to the proof of work.
+size_t header_chain::verify(const chain::header::list& headers,
+    const hash_digest& previous, const work_rules& rules, work_state& state)
+{
+    auto count = headers.size();
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        const auto& header = headers[index];
+
+        // The genesis header has no preceding chain, but is of the network.
+        if (state.height == 0 ? header.hash() != rules.genesis :
+            header.bits() != work_required(rules, state, header.timestamp()))
+        {
+            count = index;
+            break;
+        }
+
+        advance(state, rules, header);
+    }
+
+    const auto limit = rules.limit;
+    const auto threads = std::max(std::thread::hardware_concurrency(), 1u);
+    const auto chunk = (count + threads - 1) / threads;
+    std::atomic<size_t> first_invalid(count);
+
+    // Each chunk checks the link to its preceding header, so chunks are
+    // independent and the first invalid index is the minimum of all chunks.
+    const auto verify_chunk = [&](size_t begin, size_t end)
+    {
+        for (auto index = begin; index < end; ++index)
+        {
+            const auto& header = headers[index];
+            const auto& link = index == 0 ? previous :
+                headers[index - 1].hash();
+
+            if (header.previous_block_hash() == link &&
+                header.is_valid_proof_of_work(limit))
+                continue;
+
+            auto current = first_invalid.load();
+            while (index < current &&
+                !first_invalid.compare_exchange_weak(current, index));
+
+            return;
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t begin = 0; begin < count; begin += chunk)
+        workers.emplace_back(verify_chunk, begin,
+            std::min(begin + chunk, count));
+
+    for (auto& worker: workers)
+        worker.join();
+
+    return first_invalid;
+}
+
+} // namespace explorer
+} // namespace libbitcoin
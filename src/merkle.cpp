@@ -0,0 +1,153 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/merkle.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <vector>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/config/merkle_proof.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+using namespace bc::system;
+
+// A chunk of fewer nodes than this is not worth a thread.
+static const size_t minimum_chunk = 512;
+
+// Invoke the function over each chunk of [0, count) on its own thread.
+static void parallel_chunks(size_t count,
+    const std::function<void(size_t, size_t)>& function)
+{
+    const size_t threads = std::max(std::thread::hardware_concurrency(), 1u);
+    const auto chunk = std::max(minimum_chunk, (count + threads - 1) / threads);
+
+    if (count <= chunk)
+    {
+        function(0, count);
+        return;
+    }
+
+    std::vector<std::thread> workers;
+    for (size_t begin = 0; begin < count; begin += chunk)
+        workers.emplace_back(function, begin, std::min(begin + chunk, count));
+
+    for (auto& worker: workers)
+        worker.join();
+}
+
+static hash_digest merkle_node(const hash_digest& left,
+    const hash_digest& right)
+{
+    std::array<uint8_t, 2 * hash_size> pair;
+    std::copy(left.begin(), left.end(), pair.begin());
+    std::copy(right.begin(), right.end(), pair.begin() + hash_size);
+    return bitcoin_hash(pair);
+}
+
+hash_list merkle_level(const hash_list& level)
+{
+    const auto size = level.size();
+    hash_list next((size + 1) / 2);
+
+    parallel_chunks(next.size(), [&](size_t begin, size_t end)
+    {
+        for (auto node = begin; node < end; ++node)
+        {
+            const auto left = 2 * node;
+            const auto right = std::min(left + 1, size - 1);
+            next[node] = merkle_node(level[left], level[right]);
+        }
+    });
+
+    return next;
+}
+
+hash_digest merkle_root(const hash_digest& leaf, size_t index,
+    const hash_list& branch)
+{
+    auto node = leaf;
+
+    for (const auto& sibling: branch)
+    {
+        node = (index % 2 == 0) ? merkle_node(node, sibling) :
+            merkle_node(sibling, node);
+
+        index /= 2;
+    }
+
+    return node;
+}
+
+hash_list merkle_roots(const std::vector<config::merkle_proof>& proofs)
+{
+    hash_list roots(proofs.size());
+
+    parallel_chunks(proofs.size(), [&](size_t begin, size_t end)
+    {
+        for (auto proof = begin; proof < end; ++proof)
+            roots[proof] = merkle_root(proofs[proof].hash(),
+                proofs[proof].index(), proofs[proof].branch());
+    });
+
+    return roots;
+}
+
+merkle_tree::merkle_tree(const hash_list& leaves)
+{
+    if (leaves.empty())
+        return;
+
+    levels_.push_back(leaves);
+
+    while (levels_.back().size() > 1)
+        levels_.push_back(merkle_level(levels_.back()));
+}
+
+hash_digest merkle_tree::root() const
+{
+    return levels_.empty() ? null_hash : levels_.back().front();
+}
+
+bool merkle_tree::branch(hash_list& out, size_t index) const
+{
+    if (levels_.empty() || index >= levels_.front().size())
+        return false;
+
+    out.clear();
+
+    // The root level has no sibling.
+    for (size_t level = 0; level + 1 < levels_.size(); ++level)
+    {
+        const auto& nodes = levels_[level];
+        const auto sibling = std::min(index ^ 1, nodes.size() - 1);
+        out.push_back(nodes[sibling]);
+        index /= 2;
+    }
+
+    return true;
+}
+
+} // namespace explorer
+} // namespace libbitcoin
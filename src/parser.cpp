@@ -43,6 +43,11 @@ bool parser::help() const
     return help_;
 }
 
+const system::variables_map& parser::variables() const
+{
+    return variables_;
+}
+
 options_metadata parser::load_options()
 {
     return instance_.load_options();
@@ -118,6 +123,7 @@ bool parser::parse(std::string& out_error, std::istream& input,
         return false;
     }
 
+    variables_ = variables;
     return true;
 }
 
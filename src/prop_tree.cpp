@@ -26,6 +26,7 @@
 #include <bitcoin/client.hpp>
 #include <bitcoin/explorer/define.hpp>
 #include <bitcoin/explorer/config/wrapper.hpp>
+#include <bitcoin/explorer/wallet_scanner.hpp>
 
 namespace libbitcoin {
 namespace explorer {
@@ -84,14 +85,14 @@ ptree prop_list(const client::history& row)
 ptree prop_tree(const client::history& row)
 {
     ptree tree;
-    tree.add_child("transfer", prop_list(row));
+    add_child(tree, "transfer", prop_list(row));
     return tree;
 }
 
 ptree prop_tree(const client::history::list& rows, bool json)
 {
     ptree tree;
-    tree.add_child("transfers", prop_tree_list("transfer", rows, json));
+    add_child(tree, "transfers", prop_tree_list("transfer", rows, json));
     return tree;
 }
 
@@ -120,7 +121,7 @@ ptree prop_list(const client::history::list& rows, const hash_digest& key)
 ptree prop_tree(const client::history::list& rows, const hash_digest& key)
 {
     ptree tree;
-    tree.add_child("balance", prop_list(rows, key));
+    add_child(tree, "balance", prop_list(rows, key));
     return tree;
 }
 
@@ -149,7 +150,133 @@ ptree prop_tree(const client::history::list& rows,
     const payment_address& balance_address)
 {
     ptree tree;
-    tree.add_child("balance", prop_list(rows, balance_address));
+    add_child(tree, "balance", prop_list(rows, balance_address));
+    return tree;
+}
+
+// wallet
+
+ptree prop_list(const used_address& used, bool json)
+{
+    ptree tree;
+    ptree unspent;
+    uint64_t spent = 0;
+    uint64_t received = 0;
+
+    for (const auto& row: used.rows)
+    {
+        received = ceiling_add(received, row.value);
+
+        if (row.spend.hash() != null_hash)
+        {
+            spent = ceiling_add(spent, row.value);
+            continue;
+        }
+
+        // missing output implies output cut off by server's history threshold
+        if (row.output.hash() == null_hash)
+            continue;
+
+        ptree output;
+        output.put("hash", hash256(row.output.hash()));
+
+        // zeroized height implies output unconfirmed (in mempool)
+        if (row.output_height != 0)
+            output.put("height", row.output_height);
+
+        output.put("index", row.output.index());
+        output.put("value", row.value);
+        add_child(unspent, "output", std::move(output), json);
+    }
+
+    tree.put("address", used.address);
+    tree.put("chain", used.chain);
+    tree.put("index", used.index);
+    tree.put("key", used.key);
+    tree.put("received", received);
+    tree.put("spent", spent);
+    add_child(tree, "unspent", std::move(unspent));
+    return tree;
+}
+
+ptree prop_tree(const used_address::list& addresses, bool json)
+{
+    ptree tree;
+    add_child(tree, "addresses",
+        prop_tree_list_of_lists("address", addresses, json));
+    return tree;
+}
+
+// inputs
+
+ptree prop_list(const tx_input_type& tx_input)
+{
+    const auto& point = tx_input.previous_output();
+
+    ptree tree;
+    tree.put("previous_output.hash", hash256(point.hash()));
+    tree.put("previous_output.index", point.index());
+    tree.put("script", tx_input.script().to_string(rule_fork::all_rules));
+    tree.put("sequence", tx_input.sequence());
+    return tree;
+}
+
+ptree prop_tree(const tx_input_type& tx_input)
+{
+    ptree tree;
+    add_child(tree, "input", prop_list(tx_input));
+    return tree;
+}
+
+ptree prop_tree(const tx_input_type::list& tx_inputs, bool json)
+{
+    ptree tree;
+    add_child(tree, "inputs", prop_tree_list("input", tx_inputs, json));
+    return tree;
+}
+
+// outputs
+
+ptree prop_list(const tx_output_type& tx_output)
+{
+    ptree tree;
+    tree.put("script", tx_output.script().to_string(rule_fork::all_rules));
+    tree.put("value", tx_output.value());
+    return tree;
+}
+
+ptree prop_tree(const tx_output_type& tx_output)
+{
+    ptree tree;
+    add_child(tree, "output", prop_list(tx_output));
+    return tree;
+}
+
+ptree prop_tree(const tx_output_type::list& tx_outputs, bool json)
+{
+    ptree tree;
+    add_child(tree, "outputs", prop_tree_list("output", tx_outputs, json));
+    return tree;
+}
+
+// confirmation
+
+ptree prop_list(const std::string& event, const hash_digest& hash,
+    size_t height, size_t index)
+{
+    ptree tree;
+    tree.put("event", event);
+    tree.put("hash", encode_hash(hash));
+    tree.put("height", height);
+    tree.put("index", index);
+    return tree;
+}
+
+ptree prop_tree(const std::string& event, const hash_digest& hash,
+    size_t height, size_t index)
+{
+    ptree tree;
+    add_child(tree, "confirmation", prop_list(event, hash, height, index));
     return tree;
 }
 
@@ -0,0 +1,600 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/relay.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include <bitcoin/client.hpp>
+#include <bitcoin/protocol.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/generated.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+using namespace std::chrono;
+using namespace bc::client;
+using namespace bc::protocol;
+using namespace bc::system;
+
+// The relay wakes at this interval to hedge and expire requests.
+static const int32_t poll_milliseconds = 5;
+
+// The hedge delay until enough latencies have been observed.
+static const uint32_t initial_hedge_delay = 100;
+
+// The hedge delay is the percentile of this many recent latencies.
+static const size_t latency_window = 1024;
+
+// The hedge delay is recomputed at this interval of responses.
+static const size_t hedge_interval = 64;
+
+// Without a timeout, a request fails after this interval.
+static const milliseconds abandon_timeout(60000);
+
+// The server expires a subscription after this interval, unless renewed.
+static const minutes subscription_expiry(10);
+
+// The relay answers this command itself, as a check that it is running.
+static const std::string ping_command = "relay.ping";
+
+// A subscription is identified by its command and payload on this prefix.
+static const std::string subscribe_prefix = "subscribe.";
+static const std::string unsubscribe_prefix = "unsubscribe.";
+
+// A client request held until its first response, by relay request id.
+struct pending_request
+{
+    data_chunk route;
+    data_chunk command;
+    data_chunk id;
+    data_stack payload;
+    steady_clock::time_point started;
+    bool hedged;
+    bool subscription;
+};
+
+typedef std::map<uint32_t, pending_request> pending_requests;
+
+static bool is_prefixed(const data_chunk& command, const std::string& prefix)
+{
+    return command.size() > prefix.size() &&
+        std::equal(prefix.begin(), prefix.end(), command.begin());
+}
+
+// An unsubscribe releases the subscription of its client with its payload.
+static bool is_released(const pending_request& subscription,
+    const pending_request& unsubscribe)
+{
+    const auto& command = subscription.command;
+    const auto& release = unsubscribe.command;
+
+    return subscription.route == unsubscribe.route &&
+        subscription.payload == unsubscribe.payload &&
+        command.size() - subscribe_prefix.size() ==
+            release.size() - unsubscribe_prefix.size() &&
+        std::equal(command.begin() + subscribe_prefix.size(), command.end(),
+            release.begin() + unsubscribe_prefix.size());
+}
+
+template <typename Container>
+static uint32_t percentile(const Container& values, size_t percent)
+{
+    if (values.empty())
+        return 0;
+
+    std::vector<uint32_t> sorted(values.begin(), values.end());
+    const auto index = std::min(sorted.size() - 1,
+        sorted.size() * percent / 100);
+
+    std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+    return sorted[index];
+}
+
+// This mirrors the obelisk_client connection, with its certificate.
+static bool connect_server(zmq::socket& socket,
+    const connection_settings& connection,
+    const system::config::endpoint& server,
+    const system::config::sodium& server_key)
+{
+    if (connection.socks && !socket.set_socks_proxy(connection.socks))
+        return false;
+
+    if (server_key)
+    {
+        if (!socket.set_curve_client(server_key))
+            return false;
+
+        // An arbitrary certificate is generated if no key is configured.
+        if (!socket.set_certificate({ connection.client_private_key }))
+            return false;
+    }
+
+    return socket.connect(server) == error::success;
+}
+
+static bool connect_service(zmq::socket& socket,
+    const connection_settings& connection,
+    const system::config::endpoint& service)
+{
+    if (connection.socks && !socket.set_socks_proxy(connection.socks))
+        return false;
+
+    return socket.connect(service) == error::success;
+}
+
+static void forward_notification(zmq::socket& subscriber,
+    zmq::socket& publisher)
+{
+    zmq::message notification;
+    if (subscriber.receive(notification) == error::success)
+        publisher.send(notification);
+}
+
+// Server requests are [command][id][payload...].
+static code send_request(zmq::socket& socket, uint32_t id,
+    const pending_request& request)
+{
+    zmq::message message;
+    message.enqueue(request.command);
+    message.enqueue_little_endian(id);
+
+    for (const auto& frame: request.payload)
+        message.enqueue(frame);
+
+    return socket.send(message);
+}
+
+// A request that is not relayed or answered is failed in place of the
+// server, as its client would otherwise wait for it indefinitely.
+static code send_error(zmq::socket& socket, const pending_request& request,
+    const code& reason)
+{
+    const auto ec = static_cast<uint32_t>(reason.value());
+
+    zmq::message message;
+    message.enqueue(request.route);
+    message.enqueue(request.command);
+    message.enqueue(request.id);
+    message.enqueue(to_chunk(to_little_endian(ec)));
+    return socket.send(message);
+}
+
+// A ping is answered with success and no payload.
+static code send_pong(zmq::socket& socket, const pending_request& request)
+{
+    zmq::message message;
+    message.enqueue(request.route);
+    message.enqueue(request.command);
+    message.enqueue(request.id);
+    message.enqueue(to_chunk(to_little_endian(uint32_t(0))));
+    return socket.send(message);
+}
+
+relay::relay(const connection_settings& server,
+    const system::config::endpoint& hedge,
+    const system::config::sodium& hedge_key, uint32_t timeout,
+    uint16_t percentile)
+  : server_(server),
+    hedge_(hedge),
+    hedge_key_(hedge_key),
+    timeout_(timeout),
+    percentile_(percentile),
+    stopped_(true),
+    statistics_(),
+    hedge_delay_(initial_hedge_delay)
+{
+}
+
+relay::~relay()
+{
+    stop();
+}
+
+bool relay::start(const boost::filesystem::path& socket)
+{
+    std::promise<bool> started;
+    auto result = started.get_future();
+
+    socket_ = socket;
+    stopped_ = false;
+    thread_ = std::thread([this, &started]()
+    {
+        run(started);
+    });
+
+    if (result.get())
+        return true;
+
+    stop();
+    return false;
+}
+
+void relay::stop()
+{
+    stopped_ = true;
+
+    if (!thread_.joinable())
+        return;
+
+    thread_.join();
+
+    // The query socket file is removed first, as clients detect the relay by
+    // it.
+    boost::system::error_code ignored;
+    boost::filesystem::remove(get_agent_endpoint(socket_, "").host(),
+        ignored);
+    boost::filesystem::remove(get_agent_endpoint(socket_, "block").host(),
+        ignored);
+    boost::filesystem::remove(
+        get_agent_endpoint(socket_, "transaction").host(), ignored);
+}
+
+relay::statistics relay::report() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto result = statistics_;
+    result.median = percentile(latencies_, 50);
+    result.ninetieth = percentile(latencies_, 90);
+    result.ninety_ninth = percentile(latencies_, 99);
+    return result;
+}
+
+void relay::write_report(std::ostream& stream) const
+{
+    const auto result = report();
+    stream << format(BX_RELAY_REPORT) % result.requests % result.responses %
+        result.hedged % result.hedge_wins % result.timeouts % result.median %
+        result.ninetieth % result.ninety_ninth << std::endl;
+}
+
+void relay::record(uint32_t latency, bool hedge)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (hedge)
+        ++statistics_.hedge_wins;
+
+    latencies_.push_back(latency);
+    if (latencies_.size() > latency_window)
+        latencies_.pop_front();
+
+    if (++statistics_.responses % hedge_interval == 0)
+        hedge_delay_ = std::max(percentile(latencies_, percentile_), 1u);
+}
+
+// The started promise is not referenced once it has been set.
+void relay::run(std::promise<bool>& started)
+{
+    const auto hedging = static_cast<bool>(hedge_);
+
+    zmq::context context;
+    zmq::socket primary(context, zmq::socket::role::dealer);
+    zmq::socket secondary(context, zmq::socket::role::dealer);
+    zmq::socket block_subscriber(context, zmq::socket::role::subscriber);
+    zmq::socket transaction_subscriber(context,
+        zmq::socket::role::subscriber);
+
+    // The hedge server shares the key of the server unless it has its own.
+    const auto& hedge_key = hedge_key_ ? hedge_key_ :
+        server_.server_public_key;
+
+    if (!connect_server(primary, server_, server_.server,
+            server_.server_public_key) ||
+        (hedging && !connect_server(secondary, server_, hedge_, hedge_key)) ||
+        !connect_service(block_subscriber, server_, server_.block_server) ||
+        !connect_service(transaction_subscriber, server_,
+            server_.transaction_server))
+    {
+        started.set_value(false);
+        return;
+    }
+
+    zmq::socket local(context, zmq::socket::role::router);
+    zmq::socket block_publisher(context, zmq::socket::role::publisher);
+    zmq::socket transaction_publisher(context,
+        zmq::socket::role::publisher);
+
+    if (block_publisher.bind(get_agent_endpoint(socket_, "block")) !=
+            error::success ||
+        transaction_publisher.bind(get_agent_endpoint(socket_,
+            "transaction")) != error::success ||
+        local.bind(get_agent_endpoint(socket_, "")) != error::success)
+    {
+        started.set_value(false);
+        return;
+    }
+
+    started.set_value(true);
+
+    zmq::poller poller;
+    poller.add(local);
+    poller.add(primary);
+    poller.add(block_subscriber);
+    poller.add(transaction_subscriber);
+
+    if (hedging)
+        poller.add(secondary);
+
+    pending_requests pending;
+    pending_requests subscriptions;
+    uint32_t next_id = 0;
+
+    // Client requests are [route][command][id][payload...].
+    const auto receive_request = [&]()
+    {
+        zmq::message message;
+        if (local.receive(message) != error::success || message.size() < 3)
+            return;
+
+        pending_request received;
+        received.route = message.dequeue_data();
+        received.command = message.dequeue_data();
+        received.id = message.dequeue_data();
+        received.started = steady_clock::now();
+        received.hedged = false;
+        received.subscription = is_prefixed(received.command,
+            subscribe_prefix);
+
+        while (!message.empty())
+            received.payload.push_back(message.dequeue_data());
+
+        if (received.command == to_chunk(ping_command))
+        {
+            send_pong(local, received);
+            return;
+        }
+
+        if (is_prefixed(received.command, unsubscribe_prefix))
+        {
+            for (auto entry = subscriptions.begin();
+                entry != subscriptions.end();)
+                entry = is_released(entry->second, received) ?
+                    subscriptions.erase(entry) : std::next(entry);
+        }
+
+        const auto id = next_id++;
+        auto& request = pending[id];
+        request = std::move(received);
+
+        if (send_request(primary, id, request) != error::success)
+        {
+            send_error(local, request, error::operation_failed);
+            pending.erase(id);
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++statistics_.requests;
+    };
+
+    // The first response wins, a later one is from the other server.
+    const auto receive_response = [&](zmq::socket& socket, bool hedge)
+    {
+        zmq::message message;
+        if (socket.receive(message) != error::success || message.size() < 2)
+            return;
+
+        uint32_t id;
+        const auto command = message.dequeue_data();
+        if (!message.dequeue(id))
+            return;
+
+        // A notification is routed by the id of its subscription.
+        auto entry = subscriptions.find(id);
+        const auto notification = entry != subscriptions.end();
+
+        if (!notification)
+        {
+            entry = pending.find(id);
+            if (entry == pending.end())
+                return;
+        }
+
+        const auto& request = entry->second;
+        zmq::message reply;
+        reply.enqueue(request.route);
+        reply.enqueue(command);
+        reply.enqueue(request.id);
+
+        while (!message.empty())
+            reply.enqueue(message.dequeue_data());
+
+        local.send(reply);
+
+        if (notification)
+            return;
+
+        const auto latency = duration_cast<milliseconds>(
+            steady_clock::now() - request.started).count();
+
+        record(static_cast<uint32_t>(latency), hedge);
+
+        // The subscription is held from its first response until expiry.
+        if (request.subscription)
+        {
+            auto& subscription = subscriptions[id];
+            subscription = std::move(entry->second);
+            subscription.started = steady_clock::now();
+        }
+
+        pending.erase(entry);
+    };
+
+    while (!stopped_ && !poller.terminated())
+    {
+        const auto ready = poller.wait(poll_milliseconds);
+
+        if (ready.contains(local.id()))
+            receive_request();
+
+        if (ready.contains(primary.id()))
+            receive_response(primary, false);
+
+        if (hedging && ready.contains(secondary.id()))
+            receive_response(secondary, true);
+
+        if (ready.contains(block_subscriber.id()))
+            forward_notification(block_subscriber, block_publisher);
+
+        if (ready.contains(transaction_subscriber.id()))
+            forward_notification(transaction_subscriber,
+                transaction_publisher);
+
+        milliseconds delay;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            delay = milliseconds(hedge_delay_);
+        }
+
+        const auto timeout = timeout_ == 0 ? abandon_timeout :
+            milliseconds(timeout_);
+
+        // Requests are in order of age, so stop at the first that is due for
+        // neither hedging nor timeout.
+        const auto due = hedging ? std::min(delay, timeout) : timeout;
+        const auto now = steady_clock::now();
+
+        for (auto entry = pending.begin(); entry != pending.end();)
+        {
+            auto& request = entry->second;
+            const auto age = now - request.started;
+
+            if (age < due)
+                break;
+
+            if (age >= timeout)
+            {
+                send_error(local, request, error::channel_timeout);
+                entry = pending.erase(entry);
+
+                std::lock_guard<std::mutex> lock(mutex_);
+                ++statistics_.timeouts;
+                continue;
+            }
+
+            // A hedged subscription would be notified by both servers.
+            if (hedging && !request.hedged && !request.subscription &&
+                send_request(secondary, entry->first, request) ==
+                    error::success)
+            {
+                request.hedged = true;
+                std::lock_guard<std::mutex> lock(mutex_);
+                ++statistics_.hedged;
+            }
+
+            ++entry;
+        }
+
+        for (auto entry = subscriptions.begin(); entry != subscriptions.end();)
+            entry = now - entry->second.started >= subscription_expiry ?
+                subscriptions.erase(entry) : std::next(entry);
+    }
+
+    local.stop();
+    block_publisher.stop();
+    transaction_publisher.stop();
+}
+
+bool ping_relay(const boost::filesystem::path& socket, int32_t timeout)
+{
+    zmq::context context;
+    zmq::socket dealer(context, zmq::socket::role::dealer);
+
+    if (dealer.connect(get_agent_endpoint(socket, "")) != error::success)
+        return false;
+
+    zmq::message request;
+    request.enqueue(to_chunk(ping_command));
+    request.enqueue_little_endian(uint32_t(0));
+
+    if (dealer.send(request) != error::success)
+        return false;
+
+    zmq::poller poller;
+    poller.add(dealer);
+
+    zmq::message reply;
+    const auto answered = poller.wait(timeout).contains(dealer.id()) &&
+        dealer.receive(reply) == error::success;
+
+    dealer.stop();
+    return answered;
+}
+
+// Process relay.
+//-----------------------------------------------------------------------------
+
+static std::mutex process_mutex;
+static std::unique_ptr<relay> process_relay;
+static boost::filesystem::path process_socket;
+
+boost::filesystem::path start_process_relay(
+    const connection_settings& server, const system::config::endpoint& hedge,
+    const system::config::sodium& hedge_key, uint32_t timeout,
+    uint16_t percentile)
+{
+    std::lock_guard<std::mutex> lock(process_mutex);
+
+    if (process_relay)
+        return process_socket;
+
+    using namespace boost::filesystem;
+    boost::system::error_code ec;
+    const auto socket = temp_directory_path(ec) /
+        unique_path("bx-%%%%-%%%%-%%%%.relay");
+
+    std::unique_ptr<relay> instance(new relay(server, hedge, hedge_key,
+        timeout, percentile));
+
+    if (ec || !instance->start(socket))
+        return {};
+
+    process_relay = std::move(instance);
+    process_socket = socket;
+    return process_socket;
+}
+
+void stop_process_relay(std::ostream& stream)
+{
+    std::lock_guard<std::mutex> lock(process_mutex);
+
+    if (!process_relay)
+        return;
+
+    process_relay->stop();
+    process_relay->write_report(stream);
+    process_relay.reset();
+    process_socket.clear();
+}
+
+} // namespace explorer
+} // namespace libbitcoin
@@ -18,10 +18,28 @@
  */
 #include <bitcoin/explorer/utility.hpp>
 
+#ifdef _MSC_VER
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+    #include <bcrypt.h>
+    #pragma comment(lib, "bcrypt.lib")
+#endif
+
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <iomanip>
 #include <iostream>
 #include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
 #include <vector>
 #include <boost/date_time.hpp>
 #include <boost/filesystem.hpp>
@@ -36,6 +54,7 @@
 #include <bitcoin/client.hpp>
 #include <bitcoin/explorer/command.hpp>
 #include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/relay.hpp>
 
 using namespace bc::client;
 using namespace bc::system;
@@ -44,9 +63,12 @@ using boost::filesystem::path;
 namespace libbitcoin {
 namespace explorer {
 
-connection_settings get_connection(const command& command)
+// The time allowed for a running agent to answer.
+static const int32_t agent_ping_milliseconds = 250;
+
+connection_settings get_connection(const command& command, bool agent)
 {
-    return connection_settings
+    connection_settings connection
     {
         command.get_server_connect_retries_setting(),
         command.get_server_url_setting(),
@@ -56,6 +78,61 @@ connection_settings get_connection(const command& command)
         command.get_server_server_public_key_setting(),
         command.get_server_client_private_key_setting()
     };
+
+    if (!agent)
+        return connection;
+
+    auto socket = get_agent_path(command);
+
+    // The socket of a killed agent remains, so the agent must also answer.
+    if (socket.empty() || !boost::filesystem::exists(socket) ||
+        !ping_relay(socket, agent_ping_milliseconds))
+    {
+        const auto hedge = command.get_server_hedge_url_setting();
+        const auto timeout =
+            command.get_server_request_timeout_milliseconds_setting();
+
+        if (!hedge && timeout == 0)
+            return connection;
+
+        // Without an agent requests are hedged and bounded by a relay of
+        // this process, or are direct if the relay cannot start.
+        socket = start_process_relay(connection, hedge,
+            command.get_server_hedge_server_public_key_setting(), timeout,
+            command.get_server_hedge_percentile_setting());
+
+        if (socket.empty())
+            return connection;
+    }
+
+    // The relay holds the authenticated connections, so the local connection
+    // requires neither a proxy nor a certificate.
+    connection.server = get_agent_endpoint(socket, "");
+    connection.block_server = get_agent_endpoint(socket, "block");
+    connection.transaction_server = get_agent_endpoint(socket, "transaction");
+    connection.socks = system::config::authority();
+    connection.server_public_key = system::config::sodium();
+    connection.client_private_key = system::config::sodium();
+    return connection;
+}
+
+path get_agent_path(const command& command)
+{
+    const auto variable = std::getenv(BX_AGENT_VARIABLE);
+    if (variable != nullptr && *variable != '\0')
+        return path(variable);
+
+    return command.get_server_agent_setting();
+}
+
+system::config::endpoint get_agent_endpoint(const path& socket,
+    const std::string& service)
+{
+    auto name = boost::filesystem::absolute(socket).string();
+    if (!service.empty())
+        name += "." + service;
+
+    return system::config::endpoint("ipc", name, 0);
 }
 
 // The key may be invalid, caller may test for null secret.
@@ -65,15 +142,192 @@ ec_secret new_key(const data_chunk& seed)
     return key.secret();
 }
 
-// Not testable due to lack of random engine injection.
+// The generator of the operating system is not seeded by the clock, so
+// concurrent processes and threads do not draw the same values.
+bool random_fill(data_chunk& out)
+{
+    if (out.empty())
+        return true;
+
+#ifdef _MSC_VER
+    return BCryptGenRandom(nullptr, out.data(),
+        static_cast<ULONG>(out.size()),
+        BCRYPT_USE_SYSTEM_PREFERRED_RNG) == 0;
+#else
+    std::ifstream source("/dev/urandom", std::ios::binary);
+    return static_cast<bool>(source.read(
+        reinterpret_cast<char*>(out.data()), out.size()));
+#endif
+}
+
 data_chunk new_seed(size_t bit_length)
 {
     size_t fill_seed_size = bit_length / byte_bits;
     data_chunk seed(fill_seed_size);
-    pseudo_random_fill(seed);
+    if (!random_fill(seed))
+        return {};
+
     return seed;
 }
 
+// The number of seeds drawn from the generator at once.
+static const size_t seed_batch = 1024;
+
+evaluation write_seeded(std::ostream& output, size_t count,
+    size_t seed_size, seed_writer writer)
+{
+    const auto batches = (count + seed_batch - 1) / seed_batch;
+    const auto threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+    // Bound the memory held by batches completed ahead of the output.
+    const size_t window = 4 * threads;
+
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::map<size_t, std::string> completed;
+    std::atomic<size_t> next(0);
+    std::atomic<bool> failed(false);
+    auto outcome = evaluation::okay;
+    size_t written = 0;
+
+    const auto fail = [&](evaluation reason)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!failed)
+            outcome = reason;
+
+        failed = true;
+        ready.notify_all();
+    };
+
+    const auto work = [&]()
+    {
+        data_chunk block;
+
+        for (auto batch = next++; batch < batches && !failed; batch = next++)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                ready.wait(lock, [&]()
+                {
+                    return failed || batch < written + window;
+                });
+            }
+
+            if (failed)
+                break;
+
+            const auto values = std::min(seed_batch,
+                count - batch * seed_batch);
+            block.resize(values * seed_size);
+            if (!random_fill(block))
+            {
+                fail(evaluation::no_entropy);
+                break;
+            }
+
+            std::ostringstream text;
+            for (size_t value = 0; value < values && !failed; ++value)
+            {
+                const auto first = block.begin() + value * seed_size;
+                if (!writer(text, data_chunk(first, first + seed_size)))
+                    fail(evaluation::invalid_key);
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            completed.emplace(batch, text.str());
+            ready.notify_all();
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (size_t thread = 0; thread < threads; ++thread)
+        pool.emplace_back(work);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while (written < batches && !failed)
+    {
+        ready.wait(lock, [&]()
+        {
+            return failed || completed.count(written) != 0;
+        });
+
+        if (failed)
+            break;
+
+        const auto batch = completed.find(written);
+        const auto text = std::move(batch->second);
+        completed.erase(batch);
+        ++written;
+        ready.notify_all();
+
+        lock.unlock();
+        output << text;
+        lock.lock();
+    }
+
+    lock.unlock();
+    for (auto& thread: pool)
+        thread.join();
+
+    return outcome;
+}
+
+// The number of lines read and then written in parallel.
+static const size_t chunk_lines = 65536;
+
+void write_lines(std::ostream& output, std::istream& input,
+    line_writer writer)
+{
+    const auto threads = std::max(std::thread::hardware_concurrency(), 1u);
+    std::vector<std::string> results(threads);
+    std::vector<std::string> lines;
+    lines.reserve(chunk_lines);
+
+    std::string line;
+    auto more = true;
+
+    // Each thread writes a share of the chunk into its own result, so the
+    // results are written in order of the lines.
+    while (more)
+    {
+        lines.clear();
+        while (lines.size() < chunk_lines &&
+            (more = static_cast<bool>(std::getline(input, line))))
+        {
+            // A line is passed as read, without its line ending.
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+
+            lines.push_back(line);
+        }
+
+        const auto share = (lines.size() + threads - 1) / threads;
+        std::vector<std::thread> workers;
+
+        for (size_t begin = 0; begin < lines.size(); begin += share)
+        {
+            const auto worker = workers.size();
+            const auto end = std::min(begin + share, lines.size());
+
+            workers.emplace_back([&, worker, begin, end]()
+            {
+                results[worker].clear();
+                for (auto index = begin; index < end; ++index)
+                    writer(results[worker], lines[index]);
+            });
+        }
+
+        for (size_t worker = 0; worker < workers.size(); ++worker)
+        {
+            workers[worker].join();
+            output << results[worker];
+        }
+    }
+
+    output.flush();
+}
+
 string_list numbers_to_strings(
     const chain::point::indexes& indexes)
 {
@@ -0,0 +1,251 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/wallet_scanner.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <vector>
+#include <bitcoin/client.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/explorer/decoded_address.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+using namespace bc::system;
+using namespace bc::system::wallet;
+
+// The number of addresses derived at a time, outside of the lock.
+static constexpr size_t derive_batch = 100;
+
+// Addresses are derived up to a gap beyond the horizon of their chain, so
+// that an advance of the window does not wait for derivation.
+static size_t derive_target(uint32_t horizon, uint32_t gap)
+{
+    return std::min<size_t>(static_cast<size_t>(horizon) + gap,
+        hd_first_hardened_key);
+}
+
+wallet_scanner::wallet_scanner(const std::vector<hd_public>& keys,
+    uint32_t gap, uint8_t version)
+  : gap_(std::max(gap, 1u)), version_(version), cursor_(0), stopped_(false)
+{
+    static const uint32_t chains[] = { 0, 1 };
+    const auto horizon = std::min(gap_, hd_first_hardened_key);
+
+    for (size_t key = 0; key < keys.size(); ++key)
+    {
+        for (const auto chain: chains)
+        {
+            const auto parent = keys[key].derive_public(chain);
+
+            // A chain that cannot be derived has no addresses to scan.
+            chains_.push_back(
+            {
+                key, chain, parent, {}, 0, parent ? horizon : 0, 0, {}
+            });
+        }
+    }
+
+    deriver_ = std::thread(&wallet_scanner::derive, this);
+}
+
+wallet_scanner::~wallet_scanner()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+    }
+
+    needed_.notify_all();
+    deriver_.join();
+}
+
+bool wallet_scanner::next(size_t& chain, uint32_t& index, hash_digest& key)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    // Chains are taken in turn, so that each advances as its results arrive.
+    for (size_t count = 0; count < chains_.size(); ++count)
+    {
+        const auto current = cursor_;
+        cursor_ = (cursor_ + 1) % chains_.size();
+        auto& scan = chains_[current];
+
+        while (scan.next < scan.horizon)
+        {
+            derived_.wait(lock, [&scan]()
+            {
+                return scan.derived.size() > scan.next;
+            });
+
+            const auto& derived = scan.derived[scan.next];
+
+            // An index that cannot be derived is skipped as unused (BIP32).
+            if (!derived.address)
+            {
+                ++scan.next;
+                continue;
+            }
+
+            chain = current;
+            index = scan.next++;
+            key = derived.key;
+            ++scan.pending;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void wallet_scanner::complete(size_t chain, uint32_t index,
+    const client::history::list& rows)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto& scan = chains_[chain];
+    --scan.pending;
+
+    if (rows.empty())
+        return;
+
+    scan.used[index] = rows;
+    const auto horizon = static_cast<uint32_t>(std::min<size_t>(
+        static_cast<size_t>(index) + 1 + gap_, hd_first_hardened_key));
+
+    if (horizon <= scan.horizon)
+        return;
+
+    scan.horizon = horizon;
+    lock.unlock();
+    needed_.notify_all();
+}
+
+bool wallet_scanner::done() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return std::all_of(chains_.begin(), chains_.end(),
+        [this](const chain_scan& scan)
+        {
+            return scanned(scan);
+        });
+}
+
+used_address::list wallet_scanner::used() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    used_address::list out;
+
+    for (const auto& scan: chains_)
+        for (const auto& entry: scan.used)
+            out.push_back(
+            {
+                scan.key, scan.chain, entry.first,
+                scan.derived[entry.first].address, entry.second
+            });
+
+    return out;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+bool wallet_scanner::scanned(const chain_scan& scan) const
+{
+    return scan.pending == 0 && scan.next >= scan.horizon;
+}
+
+// Obtain the chain with the fewest addresses derived ahead of its scan.
+bool wallet_scanner::behind(size_t& chain) const
+{
+    auto lead = std::numeric_limits<size_t>::max();
+
+    for (size_t current = 0; current < chains_.size(); ++current)
+    {
+        const auto& scan = chains_[current];
+        const auto size = scan.derived.size();
+
+        if (scanned(scan) || size >= derive_target(scan.horizon, gap_) ||
+            size - scan.next >= lead)
+            continue;
+
+        chain = current;
+        lead = size - scan.next;
+    }
+
+    return lead != std::numeric_limits<size_t>::max();
+}
+
+void wallet_scanner::derive()
+{
+    while (true)
+    {
+        size_t chain;
+        std::unique_lock<std::mutex> lock(mutex_);
+        needed_.wait(lock, [this, &chain]()
+        {
+            return stopped_ || behind(chain);
+        });
+
+        if (stopped_)
+            return;
+
+        const auto parent = chains_[chain].parent;
+        const auto start = chains_[chain].derived.size();
+        const auto end = std::min(start + derive_batch,
+            derive_target(chains_[chain].horizon, gap_));
+        lock.unlock();
+
+        std::vector<derived_address> batch;
+        batch.reserve(end - start);
+
+        for (auto index = start; index < end; ++index)
+        {
+            const auto child = parent.derive_public(
+                static_cast<uint32_t>(index));
+
+            if (!child)
+            {
+                batch.push_back({ {}, null_hash });
+                continue;
+            }
+
+            const payment_address address(ec_public(child.point()),
+                version_);
+
+            decoded_address decoded{ false, false, short_hash_size, {} };
+            const auto hash = address.hash();
+            std::copy(hash.begin(), hash.end(), decoded.hash.begin());
+            batch.push_back({ address, payments_key(decoded) });
+        }
+
+        lock.lock();
+        auto& derived = chains_[chain].derived;
+        derived.insert(derived.end(), batch.begin(), batch.end());
+        lock.unlock();
+        derived_.notify_all();
+    }
+}
+
+} // namespace explorer
+} // namespace libbitcoin
@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <string>
+#include <boost/filesystem.hpp>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+using namespace bc::system;
+
+#define ASYNC_LOG_DEBUG_FILE "async_log_debug.log"
+#define ASYNC_LOG_ERROR_FILE "async_log_error.log"
+
+static std::string read_file(const std::string& path)
+{
+    ifstream stream(path);
+    return std::string(std::istreambuf_iterator<char>(stream),
+        std::istreambuf_iterator<char>());
+}
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(async_log__write)
+
+BOOST_AUTO_TEST_CASE(async_log__write__minimum_info__filtered_by_file)
+{
+    boost::filesystem::remove(ASYNC_LOG_DEBUG_FILE);
+    boost::filesystem::remove(ASYNC_LOG_ERROR_FILE);
+
+    {
+        async_log network_log(ASYNC_LOG_DEBUG_FILE, ASYNC_LOG_ERROR_FILE,
+            log::severity::info);
+
+        LOG_DEBUG(LOG_NETWORK) << "debug record";
+        LOG_INFO(LOG_NETWORK) << "info record";
+        LOG_ERROR(LOG_NETWORK) << "error record";
+    }
+
+    const auto debug = read_file(ASYNC_LOG_DEBUG_FILE);
+    BOOST_REQUIRE(debug.find("debug record") == std::string::npos);
+    BOOST_REQUIRE(debug.find("info record") != std::string::npos);
+    BOOST_REQUIRE(debug.find("error record") != std::string::npos);
+
+    const auto error = read_file(ASYNC_LOG_ERROR_FILE);
+    BOOST_REQUIRE(error.find("info record") == std::string::npos);
+    BOOST_REQUIRE(error.find("error record") != std::string::npos);
+
+    boost::filesystem::remove(ASYNC_LOG_DEBUG_FILE);
+    boost::filesystem::remove(ASYNC_LOG_ERROR_FILE);
+}
+
+BOOST_AUTO_TEST_CASE(async_log__write__no_records__no_files)
+{
+    boost::filesystem::remove(ASYNC_LOG_DEBUG_FILE);
+    boost::filesystem::remove(ASYNC_LOG_ERROR_FILE);
+
+    {
+        async_log network_log(ASYNC_LOG_DEBUG_FILE, ASYNC_LOG_ERROR_FILE,
+            log::severity::info);
+    }
+
+    BOOST_REQUIRE(!boost::filesystem::exists(ASYNC_LOG_DEBUG_FILE));
+    BOOST_REQUIRE(!boost::filesystem::exists(ASYNC_LOG_ERROR_FILE));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
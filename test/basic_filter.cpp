@@ -0,0 +1,206 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cstdint>
+#include <vector>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+using namespace bc::system;
+
+// Vector: github.com/bitcoin/bips/blob/master/bip-0158/testnet-19.json
+#define BASIC_FILTER_TESTNET_GENESIS_BLOCK \
+"0100000000000000000000000000000000000000000000000000000000000000000000003ba3edfd7a7b12b27ac72c3e67768f617fc81bc3888a51323a9fb8aa4b1e5e4adae5494dffff001d1aa4ae180101000000010000000000000000000000000000000000000000000000000000000000000000ffffffff4d04ffff001d0104455468652054696d65732030332f4a616e2f32303039204368616e63656c6c6f72206f6e206272696e6b206f66207365636f6e64206261696c6f757420666f722062616e6b73ffffffff0100f2052a01000000434104678afdb0fe5548271967f1a67130b7105cd6a828e03909a67962e0ea1f61deb649f6bc3f4cef38c4f35504e51ec112de5c384df7ba0b8d578a4c702b6bf11d5fac00000000"
+#define BASIC_FILTER_TESTNET_GENESIS_HASH "000000000933ea01ad0ee984209779baaec3ced90fa3f408719526f8d77f4943"
+#define BASIC_FILTER_TESTNET_GENESIS_FILTER "019dfca8"
+#define BASIC_FILTER_TESTNET_GENESIS_HEADER "21584579b7eb08997773e5aeff3a7f932700042d0ed2a6129012b7d7ae81b750"
+
+// The expected values of the synthesized block are of an independent
+// implementation of BIP158.
+#define BASIC_FILTER_P2PKH "76a914111111111111111111111111111111111111111188ac"
+#define BASIC_FILTER_P2SH "a914222222222222222222222222222222222222222287"
+#define BASIC_FILTER_OP_1 "51"
+#define BASIC_FILTER_OP_RETURN "6a0401020304"
+#define BASIC_FILTER_KEY_HASH "000000006c02c8ea6e4ff69651f7fcde348fb9d557a06e6957b65552002a7820"
+#define BASIC_FILTER_SYNTHESIZED_FILTER "032e7319085b167420"
+#define BASIC_FILTER_SYNTHESIZED_HEADER "b766eead488b58ee2e1d707463564e02dc2db5bef2565a080df35dd6343295b4"
+
+static chain::script make_script(const std::string& base16)
+{
+    data_chunk data;
+    BOOST_REQUIRE(decode_base16(data, base16));
+    return chain::script(data, false);
+}
+
+static data_chunk make_chunk(const std::string& base16)
+{
+    data_chunk data;
+    BOOST_REQUIRE(decode_base16(data, base16));
+    return data;
+}
+
+static chain::transaction make_transaction(const chain::input::list& inputs,
+    const chain::output::list& outputs)
+{
+    return chain::transaction(1, 0, inputs, outputs);
+}
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(basic_filter__compute)
+
+// Vector: the SipHash paper, appendix A.
+BOOST_AUTO_TEST_CASE(basic_filter__sip_hash__reference__expected)
+{
+    const auto k0 = UINT64_C(0x0706050403020100);
+    const auto k1 = UINT64_C(0x0f0e0d0c0b0a0908);
+    const data_chunk message
+    {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e
+    };
+
+    BOOST_REQUIRE_EQUAL(sip_hash(k0, k1, message),
+        UINT64_C(0xa129ca6149be45e5));
+    BOOST_REQUIRE_EQUAL(sip_hash(k0, k1, {}), UINT64_C(0x726fdb47dd0e0e31));
+}
+
+// A quotient of at least 32 is written in words of unary bits.
+BOOST_AUTO_TEST_CASE(basic_filter__golomb_encode__quotient_above_32__expected)
+{
+    const auto value = (UINT64_C(40) << 19) + 5;
+    const auto encoded = golomb_encode({ value });
+    BOOST_REQUIRE_EQUAL(encode_base16(encoded), "ffffffffff000050");
+}
+
+BOOST_AUTO_TEST_CASE(basic_filter__golomb_encode__small_differences__expected)
+{
+    // Differences 1, 2 and 2^19 + 1 have quotients 0, 0 and 1.
+    const uint64_t third = (UINT64_C(1) << 19) + 4;
+    const auto encoded = golomb_encode({ 1, 3, third });
+    BOOST_REQUIRE_EQUAL(encode_base16(encoded), "0000100002800008");
+}
+
+BOOST_AUTO_TEST_CASE(basic_filter__compute_filter__testnet_genesis__expected)
+{
+    chain::block block;
+    BOOST_REQUIRE(block.from_data(make_chunk(
+        BASIC_FILTER_TESTNET_GENESIS_BLOCK)));
+    BOOST_REQUIRE_EQUAL(encode_hash(block.hash()),
+        BASIC_FILTER_TESTNET_GENESIS_HASH);
+
+    data_stack elements;
+    BOOST_REQUIRE(filter_elements(elements, block, {}, {}));
+    BOOST_REQUIRE_EQUAL(elements.size(), 1u);
+
+    const auto filter = compute_filter(block.hash(), elements);
+    BOOST_REQUIRE_EQUAL(encode_base16(filter),
+        BASIC_FILTER_TESTNET_GENESIS_FILTER);
+    BOOST_REQUIRE_EQUAL(encode_hash(filter_header(filter, null_hash)),
+        BASIC_FILTER_TESTNET_GENESIS_HEADER);
+}
+
+BOOST_AUTO_TEST_CASE(basic_filter__compute_filter__empty__count_only)
+{
+    data_stack elements;
+    const auto filter = compute_filter(
+        hash_literal(BASIC_FILTER_KEY_HASH), elements);
+    BOOST_REQUIRE_EQUAL(encode_base16(filter), "00");
+}
+
+// The elements of a block with prevout scripts, of a transaction confirmed
+// in the window and of a previous transaction, are deduplicated and exclude
+// empty and null data scripts and the coinbase input.
+BOOST_AUTO_TEST_CASE(basic_filter__compute_filter__prevout_scripts__expected)
+{
+    const auto previous_tx = make_transaction(
+        { { { null_hash, 0 }, {}, 0 } },
+        {
+            { 1, make_script(BASIC_FILTER_P2PKH) },
+            { 2, {} }
+        });
+
+    const auto confirmed_tx = make_transaction(
+        { { { null_hash, 1 }, {}, 0 } },
+        { { 3, make_script(BASIC_FILTER_P2SH) } });
+
+    const auto coinbase = make_transaction(
+        { { { null_hash, chain::point::null_index }, {}, 0 } },
+        {
+            { 50, make_script(BASIC_FILTER_OP_1) },
+            { 0, make_script(BASIC_FILTER_OP_RETURN) }
+        });
+
+    const auto spend = make_transaction(
+        {
+            { { previous_tx.hash(), 0 }, {}, 0 },
+            { { previous_tx.hash(), 1 }, {}, 0 },
+            { { confirmed_tx.hash(), 0 }, {}, 0 }
+        },
+        {
+            { 4, make_script(BASIC_FILTER_P2PKH) },
+            { 5, {} }
+        });
+
+    const chain::block block({}, { coinbase, spend });
+    const transaction_index confirmed
+    {
+        { confirmed_tx.hash(), &confirmed_tx }
+    };
+    const transaction_map previous
+    {
+        { previous_tx.hash(), previous_tx }
+    };
+
+    data_stack elements;
+    BOOST_REQUIRE(filter_elements(elements, block, confirmed, previous));
+    BOOST_REQUIRE_EQUAL(elements.size(), 4u);
+    BOOST_REQUIRE_EQUAL(encode_base16(elements[0]), BASIC_FILTER_OP_1);
+    BOOST_REQUIRE_EQUAL(encode_base16(elements[1]), BASIC_FILTER_P2PKH);
+    BOOST_REQUIRE_EQUAL(encode_base16(elements[2]), BASIC_FILTER_P2PKH);
+    BOOST_REQUIRE_EQUAL(encode_base16(elements[3]), BASIC_FILTER_P2SH);
+
+    const auto filter = compute_filter(hash_literal(BASIC_FILTER_KEY_HASH),
+        elements);
+    BOOST_REQUIRE_EQUAL(encode_base16(filter),
+        BASIC_FILTER_SYNTHESIZED_FILTER);
+    BOOST_REQUIRE_EQUAL(encode_hash(filter_header(filter,
+        hash_literal(BASIC_FILTER_TESTNET_GENESIS_HEADER))),
+        BASIC_FILTER_SYNTHESIZED_HEADER);
+}
+
+BOOST_AUTO_TEST_CASE(basic_filter__filter_elements__missing_prevout__false)
+{
+    const auto coinbase = make_transaction(
+        { { { null_hash, chain::point::null_index }, {}, 0 } },
+        { { 50, make_script(BASIC_FILTER_OP_1) } });
+
+    const auto spend = make_transaction(
+        { { { hash_literal(BASIC_FILTER_KEY_HASH), 0 }, {}, 0 } },
+        { { 1, make_script(BASIC_FILTER_P2SH) } });
+
+    const chain::block block({}, { coinbase, spend });
+
+    data_stack elements;
+    BOOST_REQUIRE(!filter_elements(elements, block, {}, {}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,201 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE libbitcoin_explorer_benchmark
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer::config;
+using namespace bc::system;
+
+// This program replaces the global allocation functions, so it is built apart
+// from the test suite. Allocations are counted only on a thread that is
+// within a counting scope.
+static thread_local size_t counting_depth = 0;
+static thread_local size_t allocations = 0;
+
+class counting_scope
+{
+public:
+    counting_scope()
+      : start_(allocations)
+    {
+        ++counting_depth;
+    }
+
+    ~counting_scope()
+    {
+        --counting_depth;
+    }
+
+    size_t counted() const
+    {
+        return allocations - start_;
+    }
+
+private:
+    const size_t start_;
+};
+
+static void* allocate(std::size_t size)
+{
+    if (counting_depth != 0)
+        ++allocations;
+
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* operator new(std::size_t size)
+{
+    if (auto memory = allocate(size))
+        return memory;
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept
+{
+    std::free(memory);
+}
+
+#define PROP_TREE_SATOSHIS_WORDS_TX \
+"01000000010000000000000000000000000000000000000000000000000000000000000000ffffffff4d04ffff001d0104455468652054696d65732030332f4a616e2f32303039204368616e63656c6c6f72206f6e206272696e6b206f66207365636f6e64206261696c6f757420666f722062616e6b73ffffffff0100f2052a01000000434104678afdb0fe5548271967f1a67130b7105cd6a828e03909a67962e0ea1f61deb649f6bc3f4cef38c4f35504e51ec112de5c384df7ba0b8d578a4c702b6bf11d5fac00000000"
+
+static chain::transaction make_transaction()
+{
+    data_chunk data;
+    BOOST_REQUIRE(decode_base16(data, PROP_TREE_SATOSHIS_WORDS_TX));
+
+    chain::transaction tx;
+    BOOST_REQUIRE(tx.from_data(data));
+    return tx;
+}
+
+static client::history::list make_rows(size_t count)
+{
+    client::history::list rows(count);
+    for (size_t index = 0; index < count; ++index)
+    {
+        rows[index].output = { null_hash, static_cast<uint32_t>(index) };
+        rows[index].output_height = index;
+        rows[index].value = index;
+    }
+
+    return rows;
+}
+
+// Run with: --log_level=message
+BOOST_AUTO_TEST_SUITE(benchmark)
+BOOST_AUTO_TEST_SUITE(benchmark__prop_tree)
+
+static const size_t iterations = 1000;
+
+template <typename Builder>
+static void measure(const std::string& name, Builder builder)
+{
+    size_t counted;
+    const auto start = std::chrono::steady_clock::now();
+
+    {
+        const counting_scope scope;
+        for (size_t iteration = 0; iteration < iterations; ++iteration)
+            builder();
+
+        counted = scope.counted();
+    }
+
+    const auto elapsed = std::chrono::duration_cast<
+        std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    BOOST_TEST_MESSAGE(name << ": " << counted / iterations <<
+        " allocations, " << elapsed.count() / iterations << " us");
+}
+
+BOOST_AUTO_TEST_CASE(benchmark__prop_tree__inputs)
+{
+    const auto tx = make_transaction();
+    const tx_input_type::list inputs(1000, tx.inputs().front());
+    measure("inputs info", [&]() { prop_tree(inputs, false); });
+    measure("inputs json", [&]() { prop_tree(inputs, true); });
+}
+
+BOOST_AUTO_TEST_CASE(benchmark__prop_tree__outputs)
+{
+    const auto tx = make_transaction();
+    const tx_output_type::list outputs(1000, tx.outputs().front());
+    measure("outputs info", [&]() { prop_tree(outputs, false); });
+    measure("outputs json", [&]() { prop_tree(outputs, true); });
+}
+
+BOOST_AUTO_TEST_CASE(benchmark__prop_tree__fetch_history)
+{
+    const auto rows = make_rows(1000);
+    measure("fetch-history info", [&]() { prop_tree(rows, false); });
+    measure("fetch-history json", [&]() { prop_tree(rows, true); });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
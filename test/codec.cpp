@@ -0,0 +1,187 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+using namespace bc::system;
+
+#define CODEC_HASH "f54a5851e9372b87810a8e60cdd2e7cfd80b6e31"
+#define CODEC_ADDRESS "1PMycacnJaSqwwJqjawXBErnLsZ7RkXUAs"
+
+// Random data of random length, with leading zeros in some values so that
+// the Base58 zero prefix is exercised.
+static data_chunk random_data(std::mt19937& generator, size_t maximum)
+{
+    data_chunk data(generator() % (maximum + 1));
+    for (auto& byte: data)
+        byte = static_cast<uint8_t>(generator());
+
+    const auto zeros = generator() % 4;
+    for (size_t index = 0; index < zeros && index < data.size(); ++index)
+        data[index] = 0x00;
+
+    return data;
+}
+
+BOOST_AUTO_TEST_SUITE(config)
+BOOST_AUTO_TEST_SUITE(config__codec)
+
+static const size_t fuzz_iterations = 2000;
+static const size_t fuzz_size = 100;
+
+BOOST_AUTO_TEST_CASE(codec__base16__fuzzed__matches_system)
+{
+    data_chunk decoded;
+    std::mt19937 generator(16);
+
+    for (size_t iteration = 0; iteration < fuzz_iterations; ++iteration)
+    {
+        const auto data = random_data(generator, fuzz_size);
+        const auto encoded = to_base16(data);
+        BOOST_REQUIRE_EQUAL(encoded, encode_base16(data));
+        BOOST_REQUIRE(from_base16(decoded, encoded));
+        BOOST_REQUIRE(decoded == data);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(codec__base58__fuzzed__matches_system)
+{
+    data_chunk decoded;
+    std::mt19937 generator(58);
+
+    for (size_t iteration = 0; iteration < fuzz_iterations; ++iteration)
+    {
+        const auto data = random_data(generator, fuzz_size);
+        const auto encoded = to_base58(data);
+        BOOST_REQUIRE_EQUAL(encoded, encode_base58(data));
+        BOOST_REQUIRE(from_base58(decoded, encoded));
+        BOOST_REQUIRE(decoded == data);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(codec__base64__fuzzed__matches_system)
+{
+    data_chunk decoded;
+    std::mt19937 generator(64);
+
+    for (size_t iteration = 0; iteration < fuzz_iterations; ++iteration)
+    {
+        const auto data = random_data(generator, fuzz_size);
+        const auto encoded = to_base64(data);
+        BOOST_REQUIRE_EQUAL(encoded, encode_base64(data));
+        BOOST_REQUIRE(from_base64(decoded, encoded));
+        BOOST_REQUIRE(decoded == data);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(codec__to_base58check__address__expected)
+{
+    const auto hash = base16_literal(CODEC_HASH);
+    BOOST_REQUIRE_EQUAL(to_base58check(0x00, hash), CODEC_ADDRESS);
+}
+
+BOOST_AUTO_TEST_CASE(codec__from_base16__invalid__false)
+{
+    data_chunk decoded;
+    BOOST_REQUIRE(!from_base16(decoded, "0"));
+    BOOST_REQUIRE(!from_base16(decoded, "0g"));
+    BOOST_REQUIRE(from_base16(decoded, "0A"));
+    BOOST_REQUIRE_EQUAL(decoded.front(), 0x0a);
+}
+
+BOOST_AUTO_TEST_CASE(codec__from_base58__invalid__false)
+{
+    data_chunk decoded;
+    BOOST_REQUIRE(!from_base58(decoded, "10"));
+    BOOST_REQUIRE(!from_base58(decoded, "1l"));
+    BOOST_REQUIRE(from_base58(decoded, "11"));
+    BOOST_REQUIRE_EQUAL(decoded.size(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(codec__from_base64__invalid__false)
+{
+    data_chunk decoded;
+    BOOST_REQUIRE(!from_base64(decoded, "aGVsbG8"));
+    BOOST_REQUIRE(!from_base64(decoded, "aG=sbG8="));
+    BOOST_REQUIRE(from_base64(decoded, "aGVsbG8="));
+    BOOST_REQUIRE_EQUAL(std::string(decoded.begin(), decoded.end()), "hello");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+// Run with: --run_test=benchmark
+BOOST_AUTO_TEST_SUITE(benchmark, *boost::unit_test::disabled())
+BOOST_AUTO_TEST_SUITE(benchmark__codec)
+
+static const size_t iterations = 10000;
+
+template <typename Codec>
+static void measure(const std::string& name, Codec codec)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    for (size_t iteration = 0; iteration < iterations; ++iteration)
+        codec();
+
+    const auto elapsed = std::chrono::duration_cast<
+        std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    BOOST_TEST_MESSAGE(name << ": " << elapsed.count() / iterations << " ns");
+}
+
+BOOST_AUTO_TEST_CASE(benchmark__codec__address)
+{
+    const auto hash = base16_literal(CODEC_HASH);
+    const wallet::payment_address address(hash, 0x00);
+    const auto payment = address.to_payment();
+    const auto encoded = address.encoded();
+    data_chunk decoded;
+
+    measure("system base58check", [&]() { address.encoded(); });
+    measure("codec base58check", [&]() { to_base58(payment); });
+    measure("system base58 decode", [&]() { decode_base58(decoded, encoded); });
+    measure("codec base58 decode", [&]() { from_base58(decoded, encoded); });
+}
+
+BOOST_AUTO_TEST_CASE(benchmark__codec__kilobyte)
+{
+    std::mt19937 generator(1024);
+    data_chunk data(1024);
+    for (auto& byte: data)
+        byte = static_cast<uint8_t>(generator());
+
+    measure("system base16", [&]() { encode_base16(data); });
+    measure("codec base16", [&]() { to_base16(data); });
+    measure("system base58", [&]() { encode_base58(data); });
+    measure("codec base58", [&]() { to_base58(data); });
+    measure("system base64", [&]() { encode_base64(data); });
+    measure("codec base64", [&]() { to_base64(data); });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,172 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+using namespace std::chrono;
+
+static const size_t unlimited_steps = 1000000;
+
+static steady_clock::time_point unlimited_deadline()
+{
+    return steady_clock::now() + hours(1);
+}
+
+static uint64_t total(const std::vector<uint64_t>& values,
+    const std::vector<size_t>& selection)
+{
+    uint64_t sum = 0;
+    for (const auto index: selection)
+        sum += values[index];
+
+    return sum;
+}
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(coin_selection__select)
+
+BOOST_AUTO_TEST_CASE(coin_selection__branch_and_bound__exact_match__zero_excess)
+{
+    const std::vector<uint64_t> values{ 5, 4, 3, 2 };
+    std::vector<size_t> selection;
+    BOOST_REQUIRE(branch_and_bound(selection, values, 7, 0, unlimited_steps,
+        unlimited_deadline()));
+    BOOST_REQUIRE_EQUAL(total(values, selection), 7u);
+}
+
+BOOST_AUTO_TEST_CASE(coin_selection__branch_and_bound__within_cost_of_change__least_excess)
+{
+    // Totals 10 and 11 lie in the window [8, 11], 10 has the least excess.
+    const std::vector<uint64_t> values{ 11, 10, 6 };
+    std::vector<size_t> selection;
+    BOOST_REQUIRE(branch_and_bound(selection, values, 8, 3, unlimited_steps,
+        unlimited_deadline()));
+    BOOST_REQUIRE_EQUAL(selection.size(), 1u);
+    BOOST_REQUIRE_EQUAL(selection.front(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(coin_selection__branch_and_bound__no_total_in_window__false)
+{
+    const std::vector<uint64_t> values{ 10, 6 };
+    std::vector<size_t> selection;
+    BOOST_REQUIRE(!branch_and_bound(selection, values, 12, 1,
+        unlimited_steps, unlimited_deadline()));
+    BOOST_REQUIRE(selection.empty());
+}
+
+BOOST_AUTO_TEST_CASE(coin_selection__branch_and_bound__step_limit__stops)
+{
+    const std::vector<uint64_t> values{ 5, 4, 3, 2 };
+    std::vector<size_t> selection;
+
+    // The first step includes the largest value, which is not a match.
+    BOOST_REQUIRE(!branch_and_bound(selection, values, 7, 0, 1,
+        unlimited_deadline()));
+    BOOST_REQUIRE(selection.empty());
+}
+
+BOOST_AUTO_TEST_CASE(coin_selection__branch_and_bound__equal_values__exact_match)
+{
+    // Many equal values would make an unpruned search exponential.
+    const std::vector<uint64_t> values(40, 3);
+    std::vector<size_t> selection;
+    BOOST_REQUIRE(!branch_and_bound(selection, values, 61, 0,
+        unlimited_steps, unlimited_deadline()));
+    BOOST_REQUIRE(branch_and_bound(selection, values, 60, 0,
+        unlimited_steps, unlimited_deadline()));
+    BOOST_REQUIRE_EQUAL(selection.size(), 20u);
+}
+
+BOOST_AUTO_TEST_CASE(coin_selection__select_coins__changeless__no_change)
+{
+    const std::vector<uint64_t> values{ 11, 10, 6 };
+    std::vector<size_t> selection;
+    auto changeless = false;
+    BOOST_REQUIRE(select_coins(selection, changeless, values, 8, 2, 0, 3,
+        unlimited_steps, unlimited_deadline()));
+    BOOST_REQUIRE(changeless);
+    BOOST_REQUIRE_EQUAL(total(values, selection), 10u);
+}
+
+BOOST_AUTO_TEST_CASE(coin_selection__select_coins__no_changeless__falls_back_to_change)
+{
+    // No total lies in [12, 13], so the largest values fund 12 and change 2.
+    const std::vector<uint64_t> values{ 10, 6, 1 };
+    std::vector<size_t> selection;
+    auto changeless = true;
+    BOOST_REQUIRE(select_coins(selection, changeless, values, 12, 2, 0, 1,
+        unlimited_steps, unlimited_deadline()));
+    BOOST_REQUIRE(!changeless);
+    BOOST_REQUIRE_EQUAL(selection.size(), 2u);
+    BOOST_REQUIRE_EQUAL(total(values, selection), 16u);
+}
+
+BOOST_AUTO_TEST_CASE(coin_selection__select_coins__step_limit__falls_back_to_change)
+{
+    const std::vector<uint64_t> values{ 5, 4, 3, 2 };
+    std::vector<size_t> selection;
+    auto changeless = true;
+    BOOST_REQUIRE(select_coins(selection, changeless, values, 7, 1, 0, 0, 1,
+        unlimited_deadline()));
+    BOOST_REQUIRE(!changeless);
+    BOOST_REQUIRE_EQUAL(total(values, selection), 9u);
+}
+
+BOOST_AUTO_TEST_CASE(coin_selection__select_coins__change_below_dust__no_change)
+{
+    // Change of 1 is below dust 5, so the remainder is left to the fee.
+    const std::vector<uint64_t> values{ 10, 3 };
+    std::vector<size_t> selection;
+    auto changeless = false;
+    BOOST_REQUIRE(select_coins(selection, changeless, values, 12, 1, 5, 0,
+        unlimited_steps, unlimited_deadline()));
+    BOOST_REQUIRE(changeless);
+    BOOST_REQUIRE_EQUAL(total(values, selection), 13u);
+}
+
+BOOST_AUTO_TEST_CASE(coin_selection__select_coins__change_of_dust__change)
+{
+    const std::vector<uint64_t> values{ 10, 8 };
+    std::vector<size_t> selection;
+    auto changeless = true;
+    BOOST_REQUIRE(select_coins(selection, changeless, values, 12, 1, 5, 0,
+        unlimited_steps, unlimited_deadline()));
+    BOOST_REQUIRE(!changeless);
+    BOOST_REQUIRE_EQUAL(total(values, selection), 18u);
+}
+
+BOOST_AUTO_TEST_CASE(coin_selection__select_coins__insufficient__false)
+{
+    const std::vector<uint64_t> values{ 2, 1 };
+    std::vector<size_t> selection;
+    auto changeless = true;
+    BOOST_REQUIRE(!select_coins(selection, changeless, values, 5, 1, 0, 1,
+        unlimited_steps, unlimited_deadline()));
+    BOOST_REQUIRE(!changeless);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
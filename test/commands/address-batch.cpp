@@ -0,0 +1,124 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <boost/filesystem.hpp>
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(address_batch__invoke)
+
+// Vectors.
+#define ADDRESS_BATCH_FILE "address_batch.txt"
+#define ADDRESS_BATCH_P2KH "1A1zP1eP5QGefi2DMPTfTL5SLmv7DivfNa"
+#define ADDRESS_BATCH_P2SH "36rNbEV2yvhWxZzb61sYJ6pPcdqsQY4KrA"
+#define ADDRESS_BATCH_P2WPKH "bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4"
+#define ADDRESS_BATCH_TESTNET_P2WPKH "tb1qw508d6qejxtdg4y5r3zarvary0c5xw7kxpjzsx"
+#define ADDRESS_BATCH_VERSION_1 "bc1pw508d6qejxtdg4y5r3zarvary0c5xw7kw508d6qejxtdg4y5r3zarvary0c5xw7k7grplx"
+#define ADDRESS_BATCH_TESTNET 118034699u
+
+// Expectations.
+#define ADDRESS_BATCH_P2KH_HASH "62e907b15cbf27d5425399ebf6f0fb50ebb88f18"
+#define ADDRESS_BATCH_P2WPKH_HASH "751e76e8199196d454941c45d1b3a323f1433bd6"
+#define ADDRESS_BATCH_P2KH_KEY "6191c3b590bfcfa0475e877c302da1e323497acf3b42c08d8fa28e364edf018b"
+#define ADDRESS_BATCH_P2SH_KEY "52ec1b5ed6b3a96365e0e2722771cdfe09381783e88c6d01bf7850cb7e160473"
+
+static void write_lines(const std::string& text)
+{
+    ofstream stream(ADDRESS_BATCH_FILE);
+    stream << text;
+}
+
+BOOST_AUTO_TEST_CASE(address_batch__invoke__missing_file__failure_error)
+{
+    BX_DECLARE_COMMAND(address_batch);
+    command.set_file_option({ "address_batch_missing.txt" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR((format(BX_ADDRESS_BATCH_FILE_FAILURE) %
+        "address_batch_missing.txt").str() + "\n");
+}
+
+BOOST_AUTO_TEST_CASE(address_batch__invoke__hashes__okay_output)
+{
+    write_lines(ADDRESS_BATCH_P2KH "\nbogus\n " ADDRESS_BATCH_P2WPKH "\n");
+
+    BX_DECLARE_COMMAND(address_batch);
+    command.set_file_option({ ADDRESS_BATCH_FILE });
+    command.set_wallet_pay_to_script_hash_version_setting(5);
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(ADDRESS_BATCH_P2KH_HASH "\n" BX_ADDRESS_BATCH_INVALID
+        "\n" ADDRESS_BATCH_P2WPKH_HASH "\n");
+    boost::filesystem::remove(ADDRESS_BATCH_FILE);
+}
+
+BOOST_AUTO_TEST_CASE(address_batch__invoke__key__okay_output)
+{
+    write_lines(ADDRESS_BATCH_P2KH "\n" ADDRESS_BATCH_P2SH "\n");
+
+    BX_DECLARE_COMMAND(address_batch);
+    command.set_file_option({ ADDRESS_BATCH_FILE });
+    command.set_key_option(true);
+    command.set_wallet_pay_to_script_hash_version_setting(5);
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(ADDRESS_BATCH_P2KH_KEY "\n" ADDRESS_BATCH_P2SH_KEY "\n");
+    boost::filesystem::remove(ADDRESS_BATCH_FILE);
+}
+
+BOOST_AUTO_TEST_CASE(address_batch__invoke__valid_p2sh_not_configured__false)
+{
+    write_lines(ADDRESS_BATCH_P2KH "\n" ADDRESS_BATCH_P2SH "\n");
+
+    BX_DECLARE_COMMAND(address_batch);
+    command.set_file_option({ ADDRESS_BATCH_FILE });
+    command.set_valid_option(true);
+    command.set_wallet_pay_to_script_hash_version_setting(196);
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("true\nfalse\n");
+    boost::filesystem::remove(ADDRESS_BATCH_FILE);
+}
+
+BOOST_AUTO_TEST_CASE(address_batch__invoke__valid_other_network_or_version__false)
+{
+    write_lines(ADDRESS_BATCH_P2WPKH "\n" ADDRESS_BATCH_TESTNET_P2WPKH "\n"
+        ADDRESS_BATCH_VERSION_1 "\n");
+
+    BX_DECLARE_COMMAND(address_batch);
+    command.set_file_option({ ADDRESS_BATCH_FILE });
+    command.set_valid_option(true);
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("true\nfalse\nfalse\n");
+    boost::filesystem::remove(ADDRESS_BATCH_FILE);
+}
+
+BOOST_AUTO_TEST_CASE(address_batch__invoke__testnet_witness__okay_output)
+{
+    write_lines(ADDRESS_BATCH_P2WPKH "\n" ADDRESS_BATCH_TESTNET_P2WPKH "\n");
+
+    BX_DECLARE_COMMAND(address_batch);
+    command.set_file_option({ ADDRESS_BATCH_FILE });
+    command.set_network_identifier_setting(ADDRESS_BATCH_TESTNET);
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(BX_ADDRESS_BATCH_INVALID "\n" ADDRESS_BATCH_P2WPKH_HASH
+        "\n");
+    boost::filesystem::remove(ADDRESS_BATCH_FILE);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,300 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <fstream>
+#include <string>
+#include <boost/filesystem.hpp>
+#include "command.hpp"
+#include "../stub_server.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(agent__invoke)
+
+static boost::filesystem::path make_socket()
+{
+    using namespace boost::filesystem;
+    return temp_directory_path() / unique_path("bx-test-%%%%-%%%%.agent");
+}
+
+// Client requests are [command][id][payload].
+static bool send_request(protocol::zmq::socket& socket,
+    const std::string& command, uint32_t id, const data_chunk& payload)
+{
+    protocol::zmq::message request;
+    request.enqueue(to_chunk(command));
+    request.enqueue_little_endian(id);
+    request.enqueue(payload);
+    return socket.send(request) == error::success;
+}
+
+// Replies are [command][id][code][payload], the id and code are returned.
+static bool receive_reply(protocol::zmq::socket& socket, uint32_t& id,
+    uint32_t& code, int32_t timeout=5000)
+{
+    protocol::zmq::poller poller;
+    poller.add(socket);
+
+    protocol::zmq::message reply;
+    if (!poller.wait(timeout).contains(socket.id()) ||
+        socket.receive(reply) != error::success)
+        return false;
+
+    reply.dequeue_data();
+    if (!reply.dequeue(id))
+        return false;
+
+    const auto frame = reply.dequeue_data();
+    if (frame.size() < sizeof(uint32_t))
+        return false;
+
+    code = from_little_endian_unsafe<uint32_t>(frame.begin());
+    return true;
+}
+
+// Connect a client to the query socket of the relay.
+static bool connect_client(protocol::zmq::socket& client,
+    const boost::filesystem::path& socket)
+{
+    return client.connect(get_agent_endpoint(socket, "")) ==
+        error::success;
+}
+
+BOOST_AUTO_TEST_CASE(agent__invoke__no_path__failure_error)
+{
+    BX_DECLARE_COMMAND(agent);
+    BOOST_REQUIRE(get_agent_path(command).empty());
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_AGENT_PATH_REQUIRED "\n");
+}
+
+BOOST_AUTO_TEST_CASE(agent__get_connection__agent_not_running__configured_server)
+{
+    BX_DECLARE_COMMAND(agent);
+    command.set_server_url_setting({ "tcp://localhost:9091" });
+    command.set_server_agent_setting("missing.agent");
+    BOOST_REQUIRE_EQUAL(get_connection(command).server.to_string(), "tcp://localhost:9091");
+}
+
+BOOST_AUTO_TEST_CASE(agent__get_agent_endpoint__block__suffixed_ipc)
+{
+    const auto endpoint = get_agent_endpoint("/tmp/bx.agent", "block");
+    BOOST_REQUIRE_EQUAL(endpoint.to_string(), "ipc:///tmp/bx.agent.block");
+}
+
+BOOST_AUTO_TEST_CASE(agent__get_connection__no_hedge_or_timeout__configured_server)
+{
+    BX_DECLARE_COMMAND(agent);
+    command.set_server_url_setting({ "tcp://localhost:9091" });
+    command.set_server_hedge_percentile_setting(95);
+    BOOST_REQUIRE_EQUAL(get_connection(command).server.to_string(), "tcp://localhost:9091");
+}
+
+BOOST_AUTO_TEST_CASE(agent__relay_report__not_started__zero)
+{
+    BX_DECLARE_COMMAND(agent);
+    const explorer::relay instance(get_connection(command), {}, {}, 0, 95);
+    const auto report = instance.report();
+    BOOST_REQUIRE_EQUAL(report.requests, 0u);
+    BOOST_REQUIRE_EQUAL(report.hedged, 0u);
+    BOOST_REQUIRE_EQUAL(report.timeouts, 0u);
+    BOOST_REQUIRE_EQUAL(report.median, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(agent__ping_relay__started__answers_until_stopped)
+{
+    stub_server server;
+    BOOST_REQUIRE(server.start());
+
+    BX_DECLARE_STUB_COMMAND(agent, server);
+    const auto socket = make_socket();
+    explorer::relay instance(get_connection(command, false), {}, {}, 0, 95);
+    BOOST_REQUIRE(instance.start(socket));
+    BOOST_REQUIRE(ping_relay(socket, 5000));
+
+    instance.stop();
+    BOOST_REQUIRE(!boost::filesystem::exists(socket));
+    BOOST_REQUIRE(!ping_relay(socket, 100));
+}
+
+BOOST_AUTO_TEST_CASE(agent__get_connection__stale_socket__configured_server)
+{
+    const auto socket = make_socket();
+    std::ofstream(socket.string()).put('\0');
+    BOOST_REQUIRE(boost::filesystem::exists(socket));
+
+    BX_DECLARE_COMMAND(agent);
+    command.set_server_url_setting({ "tcp://localhost:9091" });
+    command.set_server_agent_setting(socket);
+    const auto server = get_connection(command).server.to_string();
+    boost::filesystem::remove(socket);
+    BOOST_REQUIRE_EQUAL(server, "tcp://localhost:9091");
+}
+
+BOOST_AUTO_TEST_CASE(agent__relay__subscription__notifications_routed)
+{
+    stub_server server;
+    server.set_reply("subscribe.key", {});
+    BOOST_REQUIRE(server.start());
+
+    BX_DECLARE_STUB_COMMAND(agent, server);
+    const auto socket = make_socket();
+    explorer::relay instance(get_connection(command, false), {}, {}, 0, 95);
+    BOOST_REQUIRE(instance.start(socket));
+
+    protocol::zmq::context context;
+    protocol::zmq::socket client(context,
+        protocol::zmq::socket::role::dealer);
+    BOOST_REQUIRE(connect_client(client, socket));
+
+    const auto key = to_chunk(null_hash);
+    BOOST_REQUIRE(send_request(client, "subscribe.key", 42, key));
+
+    uint32_t id;
+    uint32_t code;
+    BOOST_REQUIRE(receive_reply(client, id, code));
+    BOOST_REQUIRE_EQUAL(id, 42u);
+
+    // The notifications follow the response to the subscription.
+    server.notify("subscribe.key", { 0x01 });
+    BOOST_REQUIRE(receive_reply(client, id, code));
+    BOOST_REQUIRE_EQUAL(id, 42u);
+
+    server.notify("subscribe.key", { 0x02 });
+    BOOST_REQUIRE(receive_reply(client, id, code));
+    BOOST_REQUIRE_EQUAL(id, 42u);
+
+    client.stop();
+    instance.stop();
+}
+
+BOOST_AUTO_TEST_CASE(agent__relay__slow_server__hedge_wins)
+{
+    stub_server server;
+    server.set_reply("blockchain.fetch_last_height", { 0x2a, 0, 0, 0 });
+    server.set_latency(2000, 0);
+    BOOST_REQUIRE(server.start());
+
+    stub_server hedge;
+    hedge.set_reply("blockchain.fetch_last_height", { 0x2a, 0, 0, 0 });
+    BOOST_REQUIRE(hedge.start());
+
+    BX_DECLARE_COMMAND(agent);
+    hedge.configure(command);
+    const auto hedge_url = command.get_server_url_setting();
+    server.configure(command);
+
+    const auto socket = make_socket();
+    explorer::relay instance(get_connection(command, false), hedge_url, {},
+        0, 95);
+    BOOST_REQUIRE(instance.start(socket));
+
+    protocol::zmq::context context;
+    protocol::zmq::socket client(context,
+        protocol::zmq::socket::role::dealer);
+    BOOST_REQUIRE(connect_client(client, socket));
+    BOOST_REQUIRE(send_request(client, "blockchain.fetch_last_height", 7,
+        {}));
+
+    // The request is hedged after the initial delay of 100 milliseconds.
+    uint32_t id;
+    uint32_t code;
+    BOOST_REQUIRE(receive_reply(client, id, code, 1000));
+    BOOST_REQUIRE_EQUAL(id, 7u);
+    BOOST_REQUIRE_EQUAL(code, 0u);
+    BOOST_REQUIRE_EQUAL(hedge.requests("blockchain.fetch_last_height"), 1u);
+
+    client.stop();
+    instance.stop();
+
+    const auto report = instance.report();
+    BOOST_REQUIRE_EQUAL(report.hedged, 1u);
+    BOOST_REQUIRE_EQUAL(report.hedge_wins, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(agent__relay__slow_server__timeout_reply)
+{
+    stub_server server;
+    server.set_reply("blockchain.fetch_last_height", { 0x2a, 0, 0, 0 });
+    server.set_latency(2000, 0);
+    BOOST_REQUIRE(server.start());
+
+    BX_DECLARE_STUB_COMMAND(agent, server);
+    const auto socket = make_socket();
+    explorer::relay instance(get_connection(command, false), {}, {}, 100,
+        95);
+    BOOST_REQUIRE(instance.start(socket));
+
+    protocol::zmq::context context;
+    protocol::zmq::socket client(context,
+        protocol::zmq::socket::role::dealer);
+    BOOST_REQUIRE(connect_client(client, socket));
+    BOOST_REQUIRE(send_request(client, "blockchain.fetch_last_height", 7,
+        {}));
+
+    uint32_t id;
+    uint32_t code;
+    BOOST_REQUIRE(receive_reply(client, id, code, 1000));
+    BOOST_REQUIRE_EQUAL(id, 7u);
+    BOOST_REQUIRE_EQUAL(code,
+        static_cast<uint32_t>(system::error::channel_timeout));
+
+    client.stop();
+    instance.stop();
+    BOOST_REQUIRE_EQUAL(instance.report().timeouts, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(agent__relay__late_response__not_relayed)
+{
+    stub_server server;
+    server.set_reply("blockchain.fetch_last_height", { 0x2a, 0, 0, 0 });
+    server.set_latency(500, 0);
+    BOOST_REQUIRE(server.start());
+
+    BX_DECLARE_STUB_COMMAND(agent, server);
+    const auto socket = make_socket();
+    explorer::relay instance(get_connection(command, false), {}, {}, 100,
+        95);
+    BOOST_REQUIRE(instance.start(socket));
+
+    protocol::zmq::context context;
+    protocol::zmq::socket client(context,
+        protocol::zmq::socket::role::dealer);
+    BOOST_REQUIRE(connect_client(client, socket));
+    BOOST_REQUIRE(send_request(client, "blockchain.fetch_last_height", 7,
+        {}));
+
+    uint32_t id;
+    uint32_t code;
+    BOOST_REQUIRE(receive_reply(client, id, code, 1000));
+    BOOST_REQUIRE_EQUAL(code,
+        static_cast<uint32_t>(system::error::channel_timeout));
+
+    // The response of the server follows the timeout and is dropped.
+    BOOST_REQUIRE(!receive_reply(client, id, code, 1500));
+    BOOST_REQUIRE_EQUAL(server.requests("blockchain.fetch_last_height"), 1u);
+
+    client.stop();
+    instance.stop();
+    BOOST_REQUIRE_EQUAL(instance.report().responses, 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
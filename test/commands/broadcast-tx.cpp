@@ -18,6 +18,7 @@
  */
 
 #include "command.hpp"
+#include "../stub_peer.hpp"
 
 BX_USING_NAMESPACES()
 
@@ -39,5 +40,88 @@ BOOST_AUTO_TEST_SUITE(send_tx_p2p__invoke)
 ////    BX_REQUIRE_OKAY(command.invoke(output, error));
 ////}
 
+BOOST_AUTO_TEST_CASE(broadcast_tx__invoke__batch_zero_nodes__okay)
+{
+    BX_DECLARE_PEER_COMMAND(broadcast_tx);
+    command.set_nodes_option(0);
+    command.set_transactions_argument(
+    {
+        { BX_SATOSHIS_WORDS_TX_BASE16 },
+        { BX_SATOSHIS_WORDS_TX_BASE16 }
+    });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(broadcast_tx__invoke)
+
+// Distinct transactions, by lock time, of the Satoshi's words transaction.
+static std::vector<system::config::transaction> make_transactions(
+    size_t count)
+{
+    data_chunk data;
+    BOOST_REQUIRE(decode_base16(data, BX_SATOSHIS_WORDS_TX_BASE16));
+
+    std::vector<system::config::transaction> transactions;
+    for (size_t index = 0; index < count; ++index)
+    {
+        chain::transaction tx;
+        BOOST_REQUIRE(tx.from_data(data));
+        tx.set_locktime(static_cast<uint32_t>(index));
+        transactions.emplace_back(tx);
+    }
+
+    return transactions;
+}
+
+static std::string acceptance(
+    const std::vector<system::config::transaction>& transactions,
+    size_t requested, size_t announced)
+{
+    std::string out;
+    for (const auto& tx: transactions)
+        out += (format(BX_BROADCAST_TX_ACCEPTANCE) %
+            encode_hash(tx_type(tx).hash()) % requested %
+            announced).str() + "\n";
+
+    return out;
+}
+
+BOOST_AUTO_TEST_CASE(broadcast_tx__invoke__stub_peer_batch__requested)
+{
+    stub_peer peer;
+    BOOST_REQUIRE(peer.start());
+
+    const auto transactions = make_transactions(2);
+    BX_DECLARE_STUB_PEER_COMMAND(broadcast_tx, peer);
+    command.set_nodes_option(1);
+    command.set_duration_option(10);
+    command.set_transactions_argument(transactions);
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(acceptance(transactions, 1, 1));
+    BOOST_REQUIRE_EQUAL(peer.transactions().size(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(broadcast_tx__invoke__stub_peer_requested_twice__one_peer)
+{
+    stub_peer peer;
+    peer.set_requests(2);
+    BOOST_REQUIRE(peer.start());
+
+    // The one peer requests each transaction twice, which is not two nodes,
+    // so acceptance by two nodes is not achieved within the duration.
+    const auto transactions = make_transactions(2);
+    BX_DECLARE_STUB_PEER_COMMAND(broadcast_tx, peer);
+    command.set_nodes_option(2);
+    command.set_duration_option(2);
+    command.set_transactions_argument(transactions);
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(acceptance(transactions, 1, 1));
+    BOOST_REQUIRE_EQUAL(peer.transactions().size(), 4u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
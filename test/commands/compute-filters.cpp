@@ -0,0 +1,49 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(network)
+BOOST_AUTO_TEST_SUITE(compute_filters__invoke)
+
+// Vector: github.com/bitcoin/bips/blob/master/bip-0158/testnet-19.json
+#define BX_COMPUTE_FILTERS_TESTNET_GENESIS \
+"0 000000000933ea01ad0ee984209779baaec3ced90fa3f408719526f8d77f4943 21584579b7eb08997773e5aeff3a7f932700042d0ed2a6129012b7d7ae81b750\n"
+
+BOOST_AUTO_TEST_CASE(compute_filters__invoke__testnet_genesis__okay_output)
+{
+    BX_DECLARE_CLIENT_TESTNET_COMMAND(compute_filters);
+    command.set_height_argument(0);
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(BX_COMPUTE_FILTERS_TESTNET_GENESIS);
+}
+
+BOOST_AUTO_TEST_CASE(compute_filters__invoke__zero_count__failure_error)
+{
+    BX_DECLARE_CLIENT_COMMAND(compute_filters);
+    command.set_height_argument(0);
+    command.set_count_option(0);
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_COMPUTE_FILTERS_COUNT_REQUIRED "\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -50,5 +50,23 @@ BOOST_AUTO_TEST_CASE(ec_new__invoke__64_bit_seed__failure_error)
 ////    BX_REQUIRE_ERROR(BX_EC_NEW_INVALID_KEY "\n");
 ////}
 
+BOOST_AUTO_TEST_CASE(ec_new__invoke__count_128_bits__okay_output)
+{
+    BX_DECLARE_COMMAND(ec_new);
+    command.set_count_option(3);
+    command.set_bit_length_option(128);
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BOOST_REQUIRE_EQUAL(output.str().size(), 3u * (2 * ec_secret_size + 1));
+}
+
+BOOST_AUTO_TEST_CASE(ec_new__invoke__count_64_bits__failure_error)
+{
+    BX_DECLARE_COMMAND(ec_new);
+    command.set_count_option(3);
+    command.set_bit_length_option(64);
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_EC_NEW_BIT_LENGTH_UNSUPPORTED "\n");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
@@ -54,5 +54,14 @@ BOOST_AUTO_TEST_CASE(ec_to_public__invoke__uncompressed__okay_output)
     BX_REQUIRE_OUTPUT("0447140d2811498679fe9a0467a75ac7aa581476c102d27377bc0232635af8ad36e87bb04f401be3b770a0f3e2267a6c3b14a3074f6b5ce4419f1fcdc1ca4b1cb6\n");
 }
 
+BOOST_AUTO_TEST_CASE(ec_to_public__evaluate__compressed__okay_result)
+{
+    system::wallet::ec_public point;
+    const explorer::config::ec_private secret("8ed1d17dabce1fccbbe5e9bf008b318334e5bcc78eb9e7c1ea850b7eb0ddb9c8");
+    BOOST_REQUIRE(ec_to_public::evaluate(point, secret, false) ==
+        evaluation::okay);
+    BOOST_REQUIRE_EQUAL(point.encoded(), "0247140d2811498679fe9a0467a75ac7aa581476c102d27377bc0232635af8ad36");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
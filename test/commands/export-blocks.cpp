@@ -0,0 +1,134 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <boost/filesystem.hpp>
+#include "command.hpp"
+#include "../stub_server.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(export_blocks__invoke)
+
+#define EXPORT_BLOCKS_GENESIS_HEADER \
+"0100000000000000000000000000000000000000000000000000000000000000000000003ba3edfd7a7b12b27ac72c3e67768f617fc81bc3888a51323a9fb8aa4b1e5e4a29ab5f49ffff001d1dac2b7c"
+#define EXPORT_BLOCKS_DIRECTORY "export_blocks"
+#define EXPORT_BLOCKS_GENESIS_ADDRESS "1A1zP1eP5QGefi2DMPTfTL5SLmv7DivfNa"
+
+static chain::block genesis_block()
+{
+    data_chunk header;
+    data_chunk tx;
+    BOOST_REQUIRE(decode_base16(header, EXPORT_BLOCKS_GENESIS_HEADER));
+    BOOST_REQUIRE(decode_base16(tx, BX_SATOSHIS_WORDS_TX_BASE16));
+
+    chain::block block;
+    BOOST_REQUIRE(block.from_data(build_chunk({ header, data_chunk{ 1 },
+        tx })));
+    return block;
+}
+
+static uintmax_t column_size(const std::string& name)
+{
+    return boost::filesystem::file_size(
+        boost::filesystem::path(EXPORT_BLOCKS_DIRECTORY) / name);
+}
+
+BOOST_AUTO_TEST_CASE(export_blocks__block_columns__genesis__expected)
+{
+    const block_columns columns(genesis_block(), 0, 0x00, 0x05);
+    BOOST_REQUIRE_EQUAL(encode_hash(columns.hash), BX_GENESIS_BLOCK_HASH);
+    BOOST_REQUIRE_EQUAL(columns.transactions, 1u);
+    BOOST_REQUIRE_EQUAL(columns.inputs, 1u);
+    BOOST_REQUIRE_EQUAL(columns.outputs, 1u);
+    BOOST_REQUIRE_EQUAL(columns.tx_hashes.size(), hash_size);
+    BOOST_REQUIRE_EQUAL(columns.input_outpoints.size(), hash_size + 4u);
+    BOOST_REQUIRE_EQUAL(columns.output_values.size(), 8u);
+    BOOST_REQUIRE_EQUAL(columns.script_types.size(), 1u);
+    BOOST_REQUIRE_EQUAL(columns.script_types.front(), static_cast<uint8_t>(
+        block_columns::script_type::pay_public_key));
+    BOOST_REQUIRE_EQUAL(columns.addresses.size(), 1u);
+    BOOST_REQUIRE_EQUAL(columns.addresses.front().encoded(),
+        EXPORT_BLOCKS_GENESIS_ADDRESS);
+}
+
+BOOST_AUTO_TEST_CASE(export_blocks__column_writer__two_blocks__fixed_width)
+{
+    const auto block = genesis_block();
+    const auto columns = block_columns::extract({ block, block }, 0, 0x00,
+        0x05);
+    BOOST_REQUIRE_EQUAL(columns.size(), 2u);
+    BOOST_REQUIRE_EQUAL(columns[1].height, 1u);
+
+    column_writer writer(EXPORT_BLOCKS_DIRECTORY);
+    BOOST_REQUIRE(writer.open());
+    BOOST_REQUIRE(writer.write(columns[0]));
+    BOOST_REQUIRE(writer.write(columns[1]));
+    BOOST_REQUIRE(writer.close());
+
+    // The repeated address is written to the dictionary once.
+    BOOST_REQUIRE_EQUAL(writer.addresses(), 1u);
+    BOOST_REQUIRE_EQUAL(column_size("blocks.col"),
+        2 * column_writer::block_record_size);
+    BOOST_REQUIRE_EQUAL(column_size("tx_hashes.col"), 2 * hash_size);
+    BOOST_REQUIRE_EQUAL(column_size("input_outpoints.col"),
+        2 * (hash_size + 4u));
+    BOOST_REQUIRE_EQUAL(column_size("output_values.col"), 2 * 8u);
+    BOOST_REQUIRE_EQUAL(column_size("script_types.col"), 2u);
+    BOOST_REQUIRE_EQUAL(column_size("addresses.col"), 2 * 4u);
+    BOOST_REQUIRE_EQUAL(column_size("addresses.dict"),
+        column_writer::address_record_size);
+    boost::filesystem::remove_all(EXPORT_BLOCKS_DIRECTORY);
+}
+
+BOOST_AUTO_TEST_CASE(export_blocks__invoke__stub_server__okay_output)
+{
+    stub_server server;
+    server.set_reply("blockchain.fetch_block", genesis_block().to_data());
+    BOOST_REQUIRE(server.start());
+
+    BX_DECLARE_STUB_COMMAND(export_blocks, server);
+    command.set_wallet_pay_to_public_key_hash_version_setting(0x00);
+    command.set_wallet_pay_to_script_hash_version_setting(0x05);
+    command.set_directory_option(EXPORT_BLOCKS_DIRECTORY);
+    command.set_start_option(0);
+    command.set_stop_option(2);
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT((format(BX_EXPORT_BLOCKS_EXPORTED) % 3 % 3 % 3 % 3 %
+        1).str() + "\n");
+    BOOST_REQUIRE_EQUAL(server.requests("blockchain.fetch_block"), 3u);
+    boost::filesystem::remove_all(EXPORT_BLOCKS_DIRECTORY);
+}
+
+BOOST_AUTO_TEST_CASE(export_blocks__invoke__start_above_stop__failure_error)
+{
+    stub_server server;
+    BOOST_REQUIRE(server.start());
+
+    BX_DECLARE_STUB_COMMAND(export_blocks, server);
+    command.set_directory_option(EXPORT_BLOCKS_DIRECTORY);
+    command.set_start_option(5);
+    command.set_stop_option(2);
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR((format(BX_EXPORT_BLOCKS_INVALID_RANGE) % 5 % 2).str() +
+        "\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
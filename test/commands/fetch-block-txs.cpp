@@ -0,0 +1,153 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <chrono>
+#include <memory>
+#include <vector>
+#include "command.hpp"
+#include "../stub_server.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(fetch_block_txs__invoke)
+
+// Distinct transactions, by lock time, of the Satoshi's words transaction.
+static chain::transaction::list make_transactions(size_t count)
+{
+    data_chunk data;
+    BOOST_REQUIRE(decode_base16(data, BX_SATOSHIS_WORDS_TX_BASE16));
+
+    chain::transaction::list transactions(count);
+    for (size_t index = 0; index < count; ++index)
+    {
+        BOOST_REQUIRE(transactions[index].from_data(data));
+        transactions[index].set_locktime(static_cast<uint32_t>(index));
+    }
+
+    return transactions;
+}
+
+static void script(stub_server& server,
+    const chain::transaction::list& transactions)
+{
+    data_chunk hashes;
+    for (const auto& tx: transactions)
+        extend_data(hashes, tx.hash());
+
+    server.set_reply("blockchain.fetch_block_transaction_hashes", hashes);
+    server.set_handler("transaction_pool.fetch_transaction",
+        [transactions](const data_stack& request) -> data_chunk
+        {
+            for (const auto& tx: transactions)
+                if (!request.empty() && request.front() == to_chunk(tx.hash()))
+                    return tx.to_data();
+
+            return {};
+        });
+}
+
+BOOST_AUTO_TEST_CASE(fetch_block_txs__invoke__reordered__block_order)
+{
+    const auto transactions = make_transactions(20);
+
+    stub_server server;
+    script(server, transactions);
+    server.set_latency(0, 20);
+    BOOST_REQUIRE(server.start());
+
+    BX_DECLARE_STUB_COMMAND(fetch_block_txs, server);
+    command.set_format_option({ "json" });
+    command.set_connections_option(2);
+    command.set_window_option(4);
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+
+    size_t position = 0;
+    const auto text = output.str();
+    for (const auto& tx: transactions)
+    {
+        const auto found = text.find(encode_hash(tx.hash()), position);
+        BOOST_REQUIRE(found != std::string::npos);
+        position = found;
+    }
+
+    BOOST_REQUIRE_EQUAL(
+        server.requests("transaction_pool.fetch_transaction"), 20u);
+}
+
+BOOST_AUTO_TEST_CASE(fetch_block_txs__invoke__delayed_head__held_bounded)
+{
+    typedef std::chrono::steady_clock clock;
+    static const uint32_t head_delay = 1000;
+    const auto transactions = make_transactions(20);
+    const auto head = to_chunk(transactions.front().hash());
+
+    // The request time of each transaction, by position in the block.
+    const auto requested = std::make_shared<std::vector<clock::time_point>>(
+        transactions.size());
+
+    stub_server server;
+    script(server, transactions);
+    server.set_delay("transaction_pool.fetch_transaction",
+        [=](const data_stack& request) -> uint32_t
+        {
+            for (size_t index = 0; index < transactions.size(); ++index)
+                if (!request.empty() &&
+                    request.front() == to_chunk(transactions[index].hash()))
+                    (*requested)[index] = clock::now();
+
+            return !request.empty() && request.front() == head ?
+                head_delay : 0;
+        });
+    BOOST_REQUIRE(server.start());
+
+    BX_DECLARE_STUB_COMMAND(fetch_block_txs, server);
+    command.set_connections_option(2);
+    command.set_window_option(2);
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+
+    // Stopping the server orders its record before the checks.
+    server.stop();
+    BOOST_REQUIRE_EQUAL(
+        server.requests("transaction_pool.fetch_transaction"), 20u);
+
+    // Until the first is written only the combined window is requested.
+    const auto released = requested->front() +
+        std::chrono::milliseconds(head_delay / 2);
+    for (size_t index = 0; index < requested->size(); ++index)
+        BOOST_REQUIRE_EQUAL((*requested)[index] < released, index < 4);
+}
+
+BOOST_AUTO_TEST_CASE(fetch_block_txs__invoke__missing__failure_error)
+{
+    const auto transactions = make_transactions(3);
+
+    stub_server server;
+    script(server, transactions);
+    server.set_error("transaction_pool.fetch_transaction", error::not_found);
+    BOOST_REQUIRE(server.start());
+
+    BX_DECLARE_STUB_COMMAND(fetch_block_txs, server);
+    command.set_window_option(1);
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_ERROR_MESSAGE(not_found) + "\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
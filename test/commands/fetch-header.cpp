@@ -18,11 +18,13 @@
  */
 
 #include "command.hpp"
+#include "../stub_server.hpp"
 
 BX_USING_NAMESPACES()
 
-BOOST_AUTO_TEST_SUITE(network)
-BOOST_AUTO_TEST_SUITE(fetch_header__invoke)
+#define FETCH_HEADER_GENESIS_HEADER \
+"0100000000000000000000000000000000000000000000000000000000000000000000003ba3edfd7a7b12b27ac72c3e67768f617fc81bc3888a51323a9fb8aa4b1e5e4a29ab5f49ffff001d1dac2b7c"
+#define FETCH_HEADER_FILE "fetch_header.headers"
 
 #define FETCH_HEADER_GENESIS_INFO \
 "header\n" \
@@ -39,6 +41,66 @@ BOOST_AUTO_TEST_SUITE(fetch_header__invoke)
 "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n" \
 "<header><bits>486604799</bits><hash>00000000839a8e6886ab5951d76f411475428afc90947ee320161bbf18eb6048</hash><merkle_root>0e3e2357e806b6cdb1f70b54c3a3a17b6714ee1f0e68bebb44a74b1efd512098</merkle_root><nonce>2573394689</nonce><previous_block_hash>000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f</previous_block_hash><time_stamp>1231469665</time_stamp><version>1</version></header>\n"
 
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(fetch_header__invoke)
+
+static data_chunk genesis_data()
+{
+    data_chunk data;
+    BOOST_REQUIRE(decode_base16(data, FETCH_HEADER_GENESIS_HEADER));
+    return data;
+}
+
+// A chain of the genesis header repeated, as records above it are unread.
+static void write_chain(size_t records)
+{
+    const auto data = genesis_data();
+    ofstream stream(FETCH_HEADER_FILE, std::ofstream::binary);
+
+    for (size_t index = 0; index < records; ++index)
+        stream.write(reinterpret_cast<const char*>(data.data()), data.size());
+}
+
+BOOST_AUTO_TEST_CASE(fetch_header__invoke__local_confirmed__not_requested)
+{
+    stub_server server;
+    server.set_reply("blockchain.fetch_block_header", genesis_data());
+    BOOST_REQUIRE(server.start());
+
+    write_chain(header_chain::confirmation_depth + 1);
+    BX_DECLARE_STUB_COMMAND(fetch_header, server);
+    command.set_server_headers_file_setting(FETCH_HEADER_FILE);
+    command.set_height_option(0);
+    command.set_format_option({ "info" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    boost::filesystem::remove(FETCH_HEADER_FILE);
+    BX_REQUIRE_OUTPUT(FETCH_HEADER_GENESIS_INFO);
+    BOOST_REQUIRE_EQUAL(server.requests("blockchain.fetch_block_header"), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(fetch_header__invoke__local_unconfirmed__requested)
+{
+    stub_server server;
+    server.set_reply("blockchain.fetch_block_header", genesis_data());
+    BOOST_REQUIRE(server.start());
+
+    write_chain(header_chain::confirmation_depth);
+    BX_DECLARE_STUB_COMMAND(fetch_header, server);
+    command.set_server_headers_file_setting(FETCH_HEADER_FILE);
+    command.set_height_option(0);
+    command.set_format_option({ "info" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    boost::filesystem::remove(FETCH_HEADER_FILE);
+    BX_REQUIRE_OUTPUT(FETCH_HEADER_GENESIS_INFO);
+    BOOST_REQUIRE_EQUAL(server.requests("blockchain.fetch_block_header"), 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(network)
+BOOST_AUTO_TEST_SUITE(fetch_header__invoke)
+
 BOOST_AUTO_TEST_CASE(fetch_header__invoke__mainnet_block_height_0_info__okay_output)
 {
     BX_DECLARE_CLIENT_COMMAND(fetch_header);
@@ -17,17 +17,122 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "command.hpp"
+#include "../stub_server.hpp"
 
 BX_USING_NAMESPACES()
 
-BOOST_AUTO_TEST_SUITE(stub)
+BOOST_AUTO_TEST_SUITE(network)
 BOOST_AUTO_TEST_SUITE(fetch_public_key__invoke)
 
-BOOST_AUTO_TEST_CASE(fetch_public_key__invoke__always__failure_error)
+// Vector: github.com/spesmilo/sx/blob/master/README.md
+#define BX_FETCH_PUBLIC_KEY_SPENT_KEY "a0e0be1350a3d3eaa3f381e3aa78f64d16e712c1bfffc7d7ca3b9b5f7409adf8" // 134HfD2fdeBTohfx8YANxEpsYXsv5UoWyz
+#define BX_FETCH_PUBLIC_KEY_UNSPENT_KEY "0550bf9055a9a10e453f7ee6cf584ab61307f64a62aa0b3dba11068cf4ac7efe" // 13Ft7SkreJY9D823NPm4t6D1cBqLYTJtAe
+
+BOOST_AUTO_TEST_CASE(fetch_public_key__invoke__mainnet_spent_key__okay)
+{
+    BX_DECLARE_CLIENT_COMMAND(fetch_public_key);
+    command.set_keys_argument({ { BX_FETCH_PUBLIC_KEY_SPENT_KEY } });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BOOST_REQUIRE_EQUAL(output.str().find(BX_FETCH_PUBLIC_KEY_SPENT_KEY " "), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(fetch_public_key__invoke__mainnet_unspent_key__failure_error)
+{
+    BX_DECLARE_CLIENT_COMMAND(fetch_public_key);
+    command.set_keys_argument({ { BX_FETCH_PUBLIC_KEY_UNSPENT_KEY } });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("No public key has been revealed for key: " BX_FETCH_PUBLIC_KEY_UNSPENT_KEY "\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(fetch_public_key__invoke)
+
+// Vectors: the generator point, compressed and uncompressed.
+#define FETCH_PUBLIC_KEY_COMPRESSED "0279be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798"
+#define FETCH_PUBLIC_KEY_UNCOMPRESSED "0479be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798483ada7726a3c4655da4fbfc0e1108a8fd17b448a68554199c47d08ffb10d4b8"
+
+// A spend of a p2pkh output, ending in the push of the point.
+static chain::transaction make_spend(const std::string& point,
+    uint32_t sequence)
+{
+    data_chunk data;
+    BOOST_REQUIRE(decode_base16(data, point));
+
+    const chain::script script(chain::operation::list
+    {
+        chain::operation(data_chunk(71, 0x42)),
+        chain::operation(data)
+    });
+
+    chain::transaction tx;
+    tx.set_version(1);
+    tx.set_inputs({ chain::input({ null_hash, 0 }, script, sequence) });
+    return tx;
+}
+
+// A history4 spend row, as [kind][hash][index][height][checksum].
+static data_chunk spend_row(const hash_digest& hash)
 {
-    BX_DECLARE_COMMAND(fetch_public_key);
+    return build_chunk(
+    {
+        data_chunk{ 1 },
+        to_chunk(hash),
+        to_chunk(to_little_endian<uint32_t>(0)),
+        to_chunk(to_little_endian<uint32_t>(42)),
+        to_chunk(to_little_endian<uint64_t>(0))
+    });
+}
+
+BOOST_AUTO_TEST_CASE(fetch_public_key__invoke__unpaid_point__next_spend)
+{
+    const wallet::ec_public point(FETCH_PUBLIC_KEY_COMPRESSED);
+    const wallet::payment_address address(point, 0x00);
+    const auto key = sha256_hash(address.output_script().to_data(false));
+
+    // The first spend ends in a point that the key does not pay.
+    const auto unpaid = make_spend(FETCH_PUBLIC_KEY_UNCOMPRESSED, 0);
+    const auto paid = make_spend(FETCH_PUBLIC_KEY_COMPRESSED, 1);
+
+    stub_server server;
+    server.set_reply("blockchain.fetch_history4",
+        build_chunk({ spend_row(unpaid.hash()), spend_row(paid.hash()) }));
+    server.set_handler("transaction_pool.fetch_transaction2",
+        [=](const data_stack& request) -> data_chunk
+        {
+            BOOST_REQUIRE_EQUAL(request.size(), 1u);
+            return request.front() == to_chunk(unpaid.hash()) ?
+                unpaid.to_data() : paid.to_data();
+        });
+    BOOST_REQUIRE(server.start());
+
+    BX_DECLARE_STUB_COMMAND(fetch_public_key, server);
+    command.set_keys_argument({ { encode_hash(key) } });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(encode_hash(key) + " " FETCH_PUBLIC_KEY_COMPRESSED "\n");
+    BOOST_REQUIRE_EQUAL(
+        server.requests("transaction_pool.fetch_transaction2"), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(fetch_public_key__invoke__only_unpaid_point__failure_error)
+{
+    const wallet::ec_public point(FETCH_PUBLIC_KEY_COMPRESSED);
+    const wallet::payment_address address(point, 0x00);
+    const auto key = sha256_hash(address.output_script().to_data(false));
+    const auto unpaid = make_spend(FETCH_PUBLIC_KEY_UNCOMPRESSED, 0);
+
+    stub_server server;
+    server.set_reply("blockchain.fetch_history4", spend_row(unpaid.hash()));
+    server.set_reply("transaction_pool.fetch_transaction2", unpaid.to_data());
+    BOOST_REQUIRE(server.start());
+
+    BX_DECLARE_STUB_COMMAND(fetch_public_key, server);
+    command.set_keys_argument({ { encode_hash(key) } });
     BX_REQUIRE_FAILURE(command.invoke(output, error));
-    BX_REQUIRE_ERROR(BX_FETCH_PUBLIC_KEY_NOT_IMPLEMENTED "\n");
+    BX_REQUIRE_ERROR((format(BX_FETCH_PUBLIC_KEY_NOT_FOUND) %
+        encode_hash(key)).str() + "\n");
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,158 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "command.hpp"
+#include "../stub_server.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(fetch_wallet__invoke)
+
+// Vector: BIP32 test vector 1, chain m.
+#define FETCH_WALLET_XPUB "xpub661MyMwAqRbcFtXgS5sYJABqqG9YLmC4Q1Rdap9gSE8NqtwybGhePY2gZ29ESFjqJoCu1Rupje8YtGqsefD265TMg7usUDFdp6W1EGMcet8"
+
+static wallet::hd_public make_key()
+{
+    const wallet::hd_public key(FETCH_WALLET_XPUB);
+    BOOST_REQUIRE(key);
+    return key;
+}
+
+static client::history::list make_rows()
+{
+    client::history row;
+    row.output = { null_hash, 0 };
+    row.output_height = 0;
+    row.spend = { null_hash, 0 };
+    row.spend_height = 0;
+    row.value = 42;
+    return { row };
+}
+
+// Take the addresses to query, until none is to be queried.
+static std::vector<std::pair<size_t, uint32_t>> take(wallet_scanner& scanner)
+{
+    size_t chain;
+    uint32_t index;
+    hash_digest key;
+    std::vector<std::pair<size_t, uint32_t>> taken;
+
+    while (scanner.next(chain, index, key))
+        taken.emplace_back(chain, index);
+
+    return taken;
+}
+
+BOOST_AUTO_TEST_CASE(fetch_wallet__wallet_scanner__unused__gap_of_each_chain)
+{
+    wallet_scanner scanner({ make_key() }, 3, 0x00);
+    const auto taken = take(scanner);
+    BOOST_REQUIRE_EQUAL(taken.size(), 6u);
+    BOOST_REQUIRE(!scanner.done());
+
+    for (const auto& address: taken)
+        scanner.complete(address.first, address.second, {});
+
+    BOOST_REQUIRE(take(scanner).empty());
+    BOOST_REQUIRE(scanner.done());
+    BOOST_REQUIRE(scanner.used().empty());
+}
+
+BOOST_AUTO_TEST_CASE(fetch_wallet__wallet_scanner__used__window_advances)
+{
+    wallet_scanner scanner({ make_key() }, 3, 0x00);
+    const auto taken = take(scanner);
+    BOOST_REQUIRE_EQUAL(taken.size(), 6u);
+
+    for (const auto& address: taken)
+        scanner.complete(address.first, address.second,
+            address.first == 0 && address.second == 1 ?
+                make_rows() : client::history::list{});
+
+    // Indexes 3 and 4 of the receive chain follow the used index 1.
+    const auto advanced = take(scanner);
+    BOOST_REQUIRE_EQUAL(advanced.size(), 2u);
+    BOOST_REQUIRE_EQUAL(advanced[0].first, 0u);
+    BOOST_REQUIRE_EQUAL(advanced[0].second, 3u);
+    BOOST_REQUIRE_EQUAL(advanced[1].second, 4u);
+    BOOST_REQUIRE(!scanner.done());
+
+    for (const auto& address: advanced)
+        scanner.complete(address.first, address.second, {});
+
+    BOOST_REQUIRE(scanner.done());
+
+    const auto child = make_key().derive_public(0).derive_public(1);
+    const wallet::payment_address expected(wallet::ec_public(child.point()),
+        0x00);
+
+    const auto used = scanner.used();
+    BOOST_REQUIRE_EQUAL(used.size(), 1u);
+    BOOST_REQUIRE_EQUAL(used[0].key, 0u);
+    BOOST_REQUIRE_EQUAL(used[0].chain, 0u);
+    BOOST_REQUIRE_EQUAL(used[0].index, 1u);
+    BOOST_REQUIRE(used[0].address == expected);
+    BOOST_REQUIRE_EQUAL(used[0].rows.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(fetch_wallet__wallet_scanner__key__payments_key)
+{
+    wallet_scanner scanner({ make_key() }, 1, 0x00);
+
+    size_t chain;
+    uint32_t index;
+    hash_digest key;
+    BOOST_REQUIRE(scanner.next(chain, index, key));
+    BOOST_REQUIRE_EQUAL(chain, 0u);
+    BOOST_REQUIRE_EQUAL(index, 0u);
+
+    const auto child = make_key().derive_public(0).derive_public(0);
+    const wallet::payment_address address(wallet::ec_public(child.point()),
+        0x00);
+    const auto script = address.output_script().to_data(false);
+    BOOST_REQUIRE(key == sha256_hash(script));
+}
+
+BOOST_AUTO_TEST_CASE(fetch_wallet__invoke__invalid_key__failure_error)
+{
+    BX_DECLARE_COMMAND(fetch_wallet);
+    command.set_hd_public_keys_argument({ { FETCH_WALLET_XPUB } });
+    command.set_public_version_option(0);
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR((format(BX_FETCH_WALLET_INVALID_KEY) % 1).str() + "\n");
+}
+
+BOOST_AUTO_TEST_CASE(fetch_wallet__invoke__unused__gap_requests)
+{
+    stub_server server;
+    server.set_reply("blockchain.fetch_history4", {});
+    BOOST_REQUIRE(server.start());
+
+    BX_DECLARE_STUB_COMMAND(fetch_wallet, server);
+    command.set_hd_public_keys_argument({ { FETCH_WALLET_XPUB } });
+    command.set_public_version_option(76067358);
+    command.set_version_option(0x00);
+    command.set_gap_option(5);
+    command.set_window_option(4);
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BOOST_REQUIRE_EQUAL(server.requests("blockchain.fetch_history4"), 10u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
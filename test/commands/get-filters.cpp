@@ -20,6 +20,7 @@
 // Sponsored in part by Digital Contract Design, LLC
 
 #include "command.hpp"
+#include "../stub_peer.hpp"
 
 BX_USING_NAMESPACES()
 
@@ -45,5 +46,154 @@ BOOST_AUTO_TEST_CASE(get_filters__invoke__mainnet__success)
     BX_REQUIRE_FAILURE(command.invoke(output, error));
 }
 
+BOOST_AUTO_TEST_CASE(get_filters__invoke__peers_without_start__failure_error)
+{
+    BX_DECLARE_PEER_COMMAND(get_filters);
+    command.set_peers_option(4);
+    command.set_hash_argument({ BLOCK_49291_HASH });
+    command.set_height_argument(49285);
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_GET_FILTERS_START_REQUIRED "\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(get_filters__invoke)
+
+// Start the peers, each serving the same chain.
+static void start_peers(stub_peer* peers, size_t count, size_t blocks)
+{
+    for (size_t index = 0; index < count; ++index)
+    {
+        peers[index].set_chain(blocks, 32);
+        BOOST_REQUIRE(peers[index].start());
+    }
+}
+
+// Configure the command to seed from each of the peers.
+static void configure(command& command, const stub_peer* peers, size_t count)
+{
+    peers[0].configure(command);
+
+    std::vector<system::config::endpoint> seeds;
+    for (size_t index = 0; index < count; ++index)
+        seeds.emplace_back("127.0.0.1", peers[index].port());
+
+    command.set_network_seeds_setting(seeds);
+    command.set_peers_option(count);
+}
+
+// The range partially covers its first and last checkpoint intervals, and
+// covers one interval entirely. The first end closes at a checkpoint and the
+// last end is confirmed by the filter headers of the other peers.
+BOOST_AUTO_TEST_CASE(get_filters__invoke__stub_peer_parallel__okay)
+{
+    log::initialize();
+
+    stub_peer peers[3];
+    start_peers(peers, 3, 2500);
+
+    BX_DECLARE_PEER_COMMAND(get_filters);
+    configure(command, peers, 3);
+    command.set_duration_option(60);
+    command.set_start_option(peers[0].hash(500));
+    command.set_height_argument(500);
+    command.set_hash_argument(peers[0].hash(2400));
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+
+    const auto text = output.str();
+    BOOST_REQUIRE(text.find(encode_hash(peers[0].hash(500))) !=
+        std::string::npos);
+    BOOST_REQUIRE(text.find(encode_hash(peers[0].hash(2400))) !=
+        std::string::npos);
+    BOOST_REQUIRE_EQUAL(error.str(), "");
+}
+
+BOOST_AUTO_TEST_CASE(get_filters__invoke__stub_peer_parallel_within_interval__okay)
+{
+    log::initialize();
+
+    stub_peer peers[3];
+    start_peers(peers, 3, 300);
+
+    BX_DECLARE_PEER_COMMAND(get_filters);
+    configure(command, peers, 3);
+    command.set_duration_option(60);
+    command.set_start_option(peers[0].hash(10));
+    command.set_height_argument(10);
+    command.set_hash_argument(peers[0].hash(250));
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BOOST_REQUIRE_EQUAL(error.str(), "");
+}
+
+// No checkpoint commits to the range and no other peer can confirm it.
+BOOST_AUTO_TEST_CASE(get_filters__invoke__stub_peer_parallel_one_peer__unverified)
+{
+    log::initialize();
+
+    stub_peer peer;
+    peer.set_chain(300, 32);
+    BOOST_REQUIRE(peer.start());
+
+    BX_DECLARE_STUB_PEER_COMMAND(get_filters, peer);
+    command.set_peers_option(1);
+    command.set_duration_option(5);
+    command.set_start_option(peer.hash(10));
+    command.set_height_argument(10);
+    command.set_hash_argument(peer.hash(250));
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR((format(BX_GET_FILTERS_UNVERIFIED) % 10 % 250).str() +
+        "\n" + (format(BX_GET_FILTERS_TIMEOUT) % 5).str() + "\n");
+}
+
+// The filters of the lying peer are disputed by the others and retrieved
+// again, until it is dropped and only its correct filters are written.
+BOOST_AUTO_TEST_CASE(get_filters__invoke__stub_peer_parallel_lying_peer__correct_filters)
+{
+    log::initialize();
+
+    stub_peer peers[4];
+    peers[3].set_lying(true);
+    start_peers(peers, 4, 300);
+
+    BX_DECLARE_PEER_COMMAND(get_filters);
+    configure(command, peers, 4);
+    command.set_duration_option(60);
+    command.set_start_option(peers[0].hash(10));
+    command.set_height_argument(10);
+    command.set_hash_argument(peers[0].hash(250));
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BOOST_REQUIRE_EQUAL(error.str(), "");
+
+    const auto text = output.str();
+    for (size_t height = 10; height <= 250; ++height)
+        BOOST_REQUIRE(text.find(encode_base16(peers[0].filter(height))) !=
+            std::string::npos);
+}
+
+// A peer without BIP157 is stopped and replaced, so the retrieval expires.
+BOOST_AUTO_TEST_CASE(get_filters__invoke__stub_peer_parallel_no_compact_filters__timeout)
+{
+    log::initialize();
+
+    stub_peer peer;
+    peer.set_chain(100, 32);
+    peer.set_compact_filters(false);
+    BOOST_REQUIRE(peer.start());
+
+    BX_DECLARE_STUB_PEER_COMMAND(get_filters, peer);
+    command.set_peers_option(1);
+    command.set_duration_option(3);
+    command.set_start_option(peer.hash(0));
+    command.set_height_argument(0);
+    command.set_hash_argument(peer.hash(99));
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+
+    const auto expected = (format(BX_GET_FILTERS_TIMEOUT) % 3).str();
+    BOOST_REQUIRE(error.str().find(expected) != std::string::npos);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
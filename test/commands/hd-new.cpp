@@ -79,5 +79,28 @@ BOOST_AUTO_TEST_CASE(hd_new__invoke__64_bit_seed_testnet__failure_error)
     BX_REQUIRE_ERROR(BX_HD_NEW_SHORT_SEED "\n");
 }
 
+BOOST_AUTO_TEST_CASE(hd_new__invoke__count_mainnet__okay_output)
+{
+    BX_DECLARE_COMMAND(hd_new);
+    command.set_count_option(2);
+    command.set_bit_length_option(128);
+    command.set_version_option(76066276);
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    const auto text = output.str();
+    BOOST_REQUIRE_EQUAL(text.size(), 2u * (111 + 1));
+    BOOST_REQUIRE_EQUAL(text.substr(0, 4), "xprv");
+    BOOST_REQUIRE_EQUAL(text.substr(112, 4), "xprv");
+}
+
+BOOST_AUTO_TEST_CASE(hd_new__invoke__count_unaligned_bits__failure_error)
+{
+    BX_DECLARE_COMMAND(hd_new);
+    command.set_count_option(2);
+    command.set_bit_length_option(129);
+    command.set_version_option(76066276);
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_HD_NEW_BIT_LENGTH_UNSUPPORTED "\n");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
@@ -302,5 +302,21 @@ BOOST_AUTO_TEST_CASE(hd_public__invoke__public_derivation_testnet__okay_output)
     BX_REQUIRE_OUTPUT("tpubDBUXE2QrFFQBfPLxoKD3U1zG294LmLSG3rD9MvREmKcExYBeH4U1gyHcrtZDZe6JFxMFYVzYYhRDWCuJAQE3AbdpD3Qz4FdPVu5UHLT1NKa\n");
 }
 
+BOOST_AUTO_TEST_CASE(hd_public__evaluate__hard_public_key__hard_option_conflict)
+{
+    system::wallet::hd_public child;
+    const explorer::config::hd_key key("xpub661MyMwAqRbcFtXgS5sYJABqqG9YLmC4Q1Rdap9gSE8NqtwybGhePY2gZ29ESFjqJoCu1Rupje8YtGqsefD265TMg7usUDFdp6W1EGMcet8");
+    BOOST_REQUIRE(hd_public::evaluate(child, key, true, 0, 76066276,
+        76067358) == evaluation::hard_option_conflict);
+}
+
+BOOST_AUTO_TEST_CASE(hd_public__evaluate__unknown_version__invalid_version)
+{
+    system::wallet::hd_public child;
+    const explorer::config::hd_key key("xpub661MyMwAqRbcFtXgS5sYJABqqG9YLmC4Q1Rdap9gSE8NqtwybGhePY2gZ29ESFjqJoCu1Rupje8YtGqsefD265TMg7usUDFdp6W1EGMcet8");
+    BOOST_REQUIRE(hd_public::evaluate(child, key, false, 0, 76066276, 42) ==
+        evaluation::invalid_version);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
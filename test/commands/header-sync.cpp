@@ -0,0 +1,172 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(header_sync__invoke)
+
+#define HEADER_SYNC_GENESIS_HEADER \
+"0100000000000000000000000000000000000000000000000000000000000000000000003ba3edfd7a7b12b27ac72c3e67768f617fc81bc3888a51323a9fb8aa4b1e5e4a29ab5f49ffff001d1dac2b7c"
+#define HEADER_SYNC_FILE "header_sync.headers"
+
+static chain::header genesis_header()
+{
+    data_chunk data;
+    chain::header header;
+    BOOST_REQUIRE(decode_base16(data, HEADER_SYNC_GENESIS_HEADER));
+    BOOST_REQUIRE(header.from_data(data));
+    return header;
+}
+
+BOOST_AUTO_TEST_CASE(header_sync__invoke__no_file__failure_error)
+{
+    BX_DECLARE_COMMAND(header_sync);
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_HEADER_SYNC_FILE_REQUIRED "\n");
+}
+
+// The message header identifiers (magic) of mainnet and testnet.
+#define HEADER_SYNC_MAINNET 3652501241u
+#define HEADER_SYNC_TESTNET 118034699u
+
+// The compact work of the genesis header, which is the mainnet limit.
+#define HEADER_SYNC_GENESIS_BITS 0x1d00ffffu
+
+// The timespan of a retargeting period at the target spacing.
+#define HEADER_SYNC_TIMESPAN (14u * 24u * 60u * 60u)
+
+static header_chain::work_state genesis_state()
+{
+    return { 0, HEADER_SYNC_GENESIS_BITS, HEADER_SYNC_GENESIS_BITS, 0, 0 };
+}
+
+// The state at the first header of the second period.
+static header_chain::work_state retarget_state(uint32_t timespan)
+{
+    return
+    {
+        2016, HEADER_SYNC_GENESIS_BITS, HEADER_SYNC_GENESIS_BITS,
+        1000000 + timespan, 1000000
+    };
+}
+
+BOOST_AUTO_TEST_CASE(header_sync__verify__genesis__valid)
+{
+    const auto rules = header_chain::rules(HEADER_SYNC_MAINNET);
+    const chain::header::list headers{ genesis_header() };
+    auto state = genesis_state();
+    BOOST_REQUIRE_EQUAL(header_chain::verify(headers, null_hash, rules, state), 1u);
+    BOOST_REQUIRE_EQUAL(state.height, 1u);
+    BOOST_REQUIRE_EQUAL(state.bits, HEADER_SYNC_GENESIS_BITS);
+}
+
+BOOST_AUTO_TEST_CASE(header_sync__verify__other_network_genesis__first_invalid)
+{
+    const auto rules = header_chain::rules(HEADER_SYNC_TESTNET);
+    const chain::header::list headers{ genesis_header() };
+    auto state = genesis_state();
+    BOOST_REQUIRE_EQUAL(header_chain::verify(headers, null_hash, rules, state), 0u);
+    BOOST_REQUIRE_EQUAL(state.height, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(header_sync__verify__unlinked__first_invalid)
+{
+    const auto rules = header_chain::rules(HEADER_SYNC_MAINNET);
+    const chain::header::list headers{ genesis_header(), genesis_header() };
+    auto state = genesis_state();
+    BOOST_REQUIRE_EQUAL(header_chain::verify(headers, null_hash, rules, state), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(header_sync__verify__unexpected_work__first_invalid)
+{
+    const auto rules = header_chain::rules(HEADER_SYNC_MAINNET);
+    const chain::header::list headers{ genesis_header() };
+    auto state = genesis_state();
+    state.height = 1;
+    state.bits = 0x1c00ffff;
+    BOOST_REQUIRE_EQUAL(header_chain::verify(headers, null_hash, rules, state), 0u);
+    BOOST_REQUIRE_EQUAL(state.height, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(header_sync__work_required__within_period__preceding_bits)
+{
+    const auto rules = header_chain::rules(HEADER_SYNC_MAINNET);
+    auto state = retarget_state(HEADER_SYNC_TIMESPAN);
+    state.height = 2017;
+    state.bits = 0x1c00ffff;
+    BOOST_REQUIRE_EQUAL(header_chain::work_required(rules, state, 0), 0x1c00ffffu);
+}
+
+BOOST_AUTO_TEST_CASE(header_sync__work_required__target_timespan__unchanged)
+{
+    const auto rules = header_chain::rules(HEADER_SYNC_MAINNET);
+    const auto state = retarget_state(HEADER_SYNC_TIMESPAN);
+    BOOST_REQUIRE_EQUAL(header_chain::work_required(rules, state, 0), HEADER_SYNC_GENESIS_BITS);
+}
+
+BOOST_AUTO_TEST_CASE(header_sync__work_required__short_timespan__quarter_target)
+{
+    const auto rules = header_chain::rules(HEADER_SYNC_MAINNET);
+    const auto state = retarget_state(HEADER_SYNC_TIMESPAN / 8);
+    BOOST_REQUIRE_EQUAL(header_chain::work_required(rules, state, 0), 0x1c3fffc0u);
+}
+
+BOOST_AUTO_TEST_CASE(header_sync__work_required__long_timespan__limit)
+{
+    const auto rules = header_chain::rules(HEADER_SYNC_MAINNET);
+    const auto state = retarget_state(HEADER_SYNC_TIMESPAN * 2);
+    BOOST_REQUIRE_EQUAL(header_chain::work_required(rules, state, 0), rules.limit);
+}
+
+BOOST_AUTO_TEST_CASE(header_sync__work_required__testnet_late_header__limit)
+{
+    const auto rules = header_chain::rules(HEADER_SYNC_TESTNET);
+    auto state = retarget_state(HEADER_SYNC_TIMESPAN);
+    state.height = 2017;
+    state.bits = 0x1c00ffff;
+    state.last_bits = 0x1c00ffff;
+    BOOST_REQUIRE_EQUAL(header_chain::work_required(rules, state, state.time + 1201), rules.limit);
+    BOOST_REQUIRE_EQUAL(header_chain::work_required(rules, state, state.time + 1200), 0x1c00ffffu);
+}
+
+BOOST_AUTO_TEST_CASE(header_sync__header_chain__one_record__round_trip)
+{
+    const auto expected = genesis_header();
+    const auto data = expected.to_data();
+    {
+        ofstream stream(HEADER_SYNC_FILE, std::ofstream::binary);
+        stream.write(reinterpret_cast<const char*>(data.data()), data.size());
+    }
+
+    chain::header header;
+    header_chain local(HEADER_SYNC_FILE);
+    BOOST_REQUIRE(local.open());
+    BOOST_REQUIRE_EQUAL(local.size(), 1u);
+    BOOST_REQUIRE(local.get(header, 0));
+    BOOST_REQUIRE(!local.get(header, 1));
+    BOOST_REQUIRE(header.hash() == expected.hash());
+    local.close();
+    boost::filesystem::remove(HEADER_SYNC_FILE);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(merkle_branch__invoke)
+
+BOOST_AUTO_TEST_CASE(merkle_branch__merkle_tree__odd_leaves__branches_prove_root)
+{
+    const hash_list leaves{ bitcoin_hash(data_chunk{ 1 }),
+        bitcoin_hash(data_chunk{ 2 }), bitcoin_hash(data_chunk{ 3 }) };
+    const merkle_tree tree(leaves);
+
+    for (size_t index = 0; index < leaves.size(); ++index)
+    {
+        hash_list branch;
+        BOOST_REQUIRE(tree.branch(branch, index));
+        BOOST_REQUIRE_EQUAL(branch.size(), 2u);
+        BOOST_REQUIRE(merkle_root(leaves[index], index, branch) == tree.root());
+    }
+
+    hash_list branch;
+    BOOST_REQUIRE(!tree.branch(branch, leaves.size()));
+}
+
+BOOST_AUTO_TEST_CASE(merkle_branch__merkle_tree__one_leaf__leaf_root)
+{
+    const hash_digest leaf = bitcoin_hash(data_chunk{ 42 });
+    const merkle_tree tree({ leaf });
+    hash_list branch;
+    BOOST_REQUIRE(tree.branch(branch, 0));
+    BOOST_REQUIRE(branch.empty());
+    BOOST_REQUIRE(tree.root() == leaf);
+}
+
+BOOST_AUTO_TEST_CASE(merkle_branch__merkle_proof__text__round_trips)
+{
+    const auto text = "42:1:" BX_SATOSHIS_WORDS_TX_HASH ":" BX_GENESIS_BLOCK_HASH;
+    const config::merkle_proof proof(text);
+    BOOST_REQUIRE_EQUAL(proof.height(), 42u);
+    BOOST_REQUIRE_EQUAL(proof.index(), 1u);
+    BOOST_REQUIRE_EQUAL(proof.branch().size(), 1u);
+
+    std::stringstream stream;
+    stream << proof;
+    BOOST_REQUIRE_EQUAL(stream.str(), text);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(network)
+BOOST_AUTO_TEST_SUITE(merkle_branch__invoke)
+
+BOOST_AUTO_TEST_CASE(merkle_branch__invoke__mainnet_block_height_0__okay_output)
+{
+    BX_DECLARE_CLIENT_COMMAND(merkle_branch);
+    command.set_height_option(0);
+    command.set_txids_argument({ { BX_SATOSHIS_WORDS_TX_HASH } });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("0:0:" BX_SATOSHIS_WORDS_TX_HASH "\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
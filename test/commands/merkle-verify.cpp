@@ -0,0 +1,65 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(merkle_verify__invoke)
+
+#define MERKLE_VERIFY_GENESIS_HEADER \
+"0100000000000000000000000000000000000000000000000000000000000000000000003ba3edfd7a7b12b27ac72c3e67768f617fc81bc3888a51323a9fb8aa4b1e5e4a29ab5f49ffff001d1dac2b7c"
+#define MERKLE_VERIFY_FILE "merkle_verify.headers"
+
+// The genesis header is confirmed by the records above it, which are unread.
+static void write_genesis_chain()
+{
+    data_chunk data;
+    BOOST_REQUIRE(decode_base16(data, MERKLE_VERIFY_GENESIS_HEADER));
+    ofstream stream(MERKLE_VERIFY_FILE, std::ofstream::binary);
+
+    for (size_t index = 0; index <= header_chain::confirmation_depth; ++index)
+        stream.write(reinterpret_cast<const char*>(data.data()), data.size());
+}
+
+BOOST_AUTO_TEST_CASE(merkle_verify__invoke__local_genesis_coinbase__okay_output)
+{
+    write_genesis_chain();
+    BX_DECLARE_COMMAND(merkle_verify);
+    command.set_server_headers_file_setting(MERKLE_VERIFY_FILE);
+    command.set_proofs_argument({ { "0:0:" BX_SATOSHIS_WORDS_TX_HASH } });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT((format(BX_MERKLE_VERIFY_VALID) % BX_SATOSHIS_WORDS_TX_HASH % 0).str() + "\n");
+    boost::filesystem::remove(MERKLE_VERIFY_FILE);
+}
+
+BOOST_AUTO_TEST_CASE(merkle_verify__invoke__local_genesis_wrong_branch__failure_error)
+{
+    write_genesis_chain();
+    BX_DECLARE_COMMAND(merkle_verify);
+    command.set_server_headers_file_setting(MERKLE_VERIFY_FILE);
+    command.set_proofs_argument({ { "0:0:" BX_SATOSHIS_WORDS_TX_HASH ":" BX_GENESIS_BLOCK_HASH } });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR((format(BX_MERKLE_VERIFY_INVALID) % BX_SATOSHIS_WORDS_TX_HASH % 0).str() + "\n");
+    boost::filesystem::remove(MERKLE_VERIFY_FILE);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
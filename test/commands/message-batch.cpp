@@ -0,0 +1,182 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <boost/filesystem.hpp>
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(message_batch__invoke)
+
+// Vectors.
+#define MESSAGE_BATCH_FILE "message_batch.txt"
+#define MESSAGE_BATCH_WIF "KwE19y2Ud8EUEBjeUG4Uc4qWUJUUoZJxHR3xUfTpCSsJEDv2o8fu"
+#define MESSAGE_BATCH_ADDRESS_COMPRESSED "1PeChFbhxDD9NLbU21DfD55aQBC4ZTR3tE"
+#define MESSAGE_BATCH_SIGNATURE_COMPRESSED "HxQp3cXgOIhBEGXks27sfeSQHVgNUeYgl5i5wG/dOUYaSIRnnzXR6NcyH+AfNAHtkWcyOD9rX4pojqmuQyH79K4="
+#define MESSAGE_BATCH_ADDRESS_UNCOMPRESSED "1Em1SX7qQq1pTmByqLRafhL1ypx2V786tP"
+#define MESSAGE_BATCH_SIGNATURE_OTHER_RECOVERY_ID "IBQp3cXgOIhBEGXks27sfeSQHVgNUeYgl5i5wG/dOUYaSIRnnzXR6NcyH+AfNAHtkWcyOD9rX4pojqmuQyH79K4="
+#define MESSAGE_BATCH_SIGNATURE_UNCOMPRESSED "GxQp3cXgOIhBEGXks27sfeSQHVgNUeYgl5i5wG/dOUYaSIRnnzXR6NcyH+AfNAHtkWcyOD9rX4pojqmuQyH79K4="
+
+// Records.
+#define MESSAGE_BATCH_SIGN "sign," MESSAGE_BATCH_WIF ",Nakomoto\n"
+#define MESSAGE_BATCH_VALIDATE_COMPRESSED "validate," \
+    MESSAGE_BATCH_ADDRESS_COMPRESSED "," \
+    MESSAGE_BATCH_SIGNATURE_COMPRESSED ",Nakomoto\n"
+#define MESSAGE_BATCH_VALIDATE_UNCOMPRESSED "validate," \
+    MESSAGE_BATCH_ADDRESS_UNCOMPRESSED "," \
+    MESSAGE_BATCH_SIGNATURE_UNCOMPRESSED ",Nakomoto\n"
+#define MESSAGE_BATCH_VALIDATE_BOGUS "validate," \
+    MESSAGE_BATCH_ADDRESS_COMPRESSED "," \
+    MESSAGE_BATCH_SIGNATURE_COMPRESSED ",Satoshi\n"
+#define MESSAGE_BATCH_VALIDATE_OTHER_RECOVERY_ID "validate," \
+    MESSAGE_BATCH_ADDRESS_COMPRESSED "," \
+    MESSAGE_BATCH_SIGNATURE_OTHER_RECOVERY_ID ",Nakomoto\n"
+
+static void write_lines(const std::string& text)
+{
+    ofstream stream(MESSAGE_BATCH_FILE);
+    stream << text;
+}
+
+static std::string report(size_t signed_count, size_t valid, size_t invalid,
+    size_t malformed, size_t signers)
+{
+    return (format(BX_MESSAGE_BATCH_REPORT) % signed_count % valid % invalid %
+        malformed % signers).str() + "\n";
+}
+
+BOOST_AUTO_TEST_CASE(message_batch__invoke__missing_file__failure_error)
+{
+    BX_DECLARE_COMMAND(message_batch);
+    command.set_file_option({ "message_batch_missing.txt" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR((format(BX_MESSAGE_BATCH_FILE_FAILURE) %
+        "message_batch_missing.txt").str() + "\n");
+}
+
+BOOST_AUTO_TEST_CASE(message_batch__invoke__sign_validate__okay_output)
+{
+    write_lines("# comment\n" MESSAGE_BATCH_SIGN "\n"
+        MESSAGE_BATCH_VALIDATE_COMPRESSED MESSAGE_BATCH_VALIDATE_UNCOMPRESSED);
+
+    BX_DECLARE_COMMAND(message_batch);
+    command.set_file_option({ MESSAGE_BATCH_FILE });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(MESSAGE_BATCH_SIGNATURE_COMPRESSED "\n"
+        BX_MESSAGE_BATCH_VALID "\n" BX_MESSAGE_BATCH_VALID "\n" +
+        report(1, 2, 0, 0, 2));
+    boost::filesystem::remove(MESSAGE_BATCH_FILE);
+}
+
+BOOST_AUTO_TEST_CASE(message_batch__invoke__bogus__invalid_output)
+{
+    write_lines(MESSAGE_BATCH_VALIDATE_BOGUS "sign,bogus,Nakomoto\n"
+        "validate,bogus\n");
+
+    BX_DECLARE_COMMAND(message_batch);
+    command.set_file_option({ MESSAGE_BATCH_FILE });
+    BX_REQUIRE_INVALID(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(BX_MESSAGE_BATCH_INVALID "\n"
+        BX_MESSAGE_BATCH_MALFORMED "\n" BX_MESSAGE_BATCH_MALFORMED "\n" +
+        report(0, 0, 1, 2, 0));
+    boost::filesystem::remove(MESSAGE_BATCH_FILE);
+}
+
+BOOST_AUTO_TEST_CASE(message_batch__invoke__repeated_signer__one_signer)
+{
+    write_lines(MESSAGE_BATCH_VALIDATE_COMPRESSED
+        MESSAGE_BATCH_VALIDATE_COMPRESSED MESSAGE_BATCH_VALIDATE_COMPRESSED);
+
+    BX_DECLARE_COMMAND(message_batch);
+    command.set_file_option({ MESSAGE_BATCH_FILE });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(BX_MESSAGE_BATCH_VALID "\n" BX_MESSAGE_BATCH_VALID "\n"
+        BX_MESSAGE_BATCH_VALID "\n" + report(0, 3, 0, 0, 1));
+    boost::filesystem::remove(MESSAGE_BATCH_FILE);
+}
+
+BOOST_AUTO_TEST_CASE(message_batch__invoke__padded_message__invalid_output)
+{
+    write_lines("validate, " MESSAGE_BATCH_ADDRESS_COMPRESSED " , "
+        MESSAGE_BATCH_SIGNATURE_COMPRESSED " ,Nakomoto\r\n"
+        "validate," MESSAGE_BATCH_ADDRESS_COMPRESSED ","
+        MESSAGE_BATCH_SIGNATURE_COMPRESSED ",Nakomoto \n");
+
+    BX_DECLARE_COMMAND(message_batch);
+    command.set_file_option({ MESSAGE_BATCH_FILE });
+    BX_REQUIRE_INVALID(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(BX_MESSAGE_BATCH_VALID "\n" BX_MESSAGE_BATCH_INVALID
+        "\n" + report(0, 1, 1, 0, 1));
+    boost::filesystem::remove(MESSAGE_BATCH_FILE);
+}
+
+BOOST_AUTO_TEST_CASE(message_batch__invoke__known_signer_other_message__invalid_output)
+{
+    write_lines(MESSAGE_BATCH_SIGN MESSAGE_BATCH_VALIDATE_COMPRESSED
+        MESSAGE_BATCH_VALIDATE_BOGUS);
+
+    BX_DECLARE_COMMAND(message_batch);
+    command.set_file_option({ MESSAGE_BATCH_FILE });
+    BX_REQUIRE_INVALID(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(MESSAGE_BATCH_SIGNATURE_COMPRESSED "\n"
+        BX_MESSAGE_BATCH_VALID "\n" BX_MESSAGE_BATCH_INVALID "\n" +
+        report(1, 1, 1, 0, 1));
+    boost::filesystem::remove(MESSAGE_BATCH_FILE);
+}
+
+BOOST_AUTO_TEST_CASE(message_batch__invoke__sign_only__one_signer)
+{
+    write_lines(MESSAGE_BATCH_SIGN MESSAGE_BATCH_SIGN);
+
+    BX_DECLARE_COMMAND(message_batch);
+    command.set_file_option({ MESSAGE_BATCH_FILE });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(MESSAGE_BATCH_SIGNATURE_COMPRESSED "\n"
+        MESSAGE_BATCH_SIGNATURE_COMPRESSED "\n" + report(2, 0, 0, 0, 1));
+    boost::filesystem::remove(MESSAGE_BATCH_FILE);
+}
+
+BOOST_AUTO_TEST_CASE(message_batch__invoke__known_signer_other_recovery_id__invalid_output)
+{
+    write_lines(MESSAGE_BATCH_SIGN MESSAGE_BATCH_VALIDATE_COMPRESSED
+        MESSAGE_BATCH_VALIDATE_OTHER_RECOVERY_ID);
+
+    BX_DECLARE_COMMAND(message_batch);
+    command.set_file_option({ MESSAGE_BATCH_FILE });
+    BX_REQUIRE_INVALID(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(MESSAGE_BATCH_SIGNATURE_COMPRESSED "\n"
+        BX_MESSAGE_BATCH_VALID "\n" BX_MESSAGE_BATCH_INVALID "\n" +
+        report(1, 1, 1, 0, 1));
+    boost::filesystem::remove(MESSAGE_BATCH_FILE);
+}
+
+BOOST_AUTO_TEST_CASE(message_batch__invoke__unknown_signer_other_recovery_id__invalid_output)
+{
+    write_lines(MESSAGE_BATCH_VALIDATE_OTHER_RECOVERY_ID);
+
+    BX_DECLARE_COMMAND(message_batch);
+    command.set_file_option({ MESSAGE_BATCH_FILE });
+    BX_REQUIRE_INVALID(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(BX_MESSAGE_BATCH_INVALID "\n" + report(0, 0, 1, 0, 0));
+    boost::filesystem::remove(MESSAGE_BATCH_FILE);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
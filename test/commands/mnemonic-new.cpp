@@ -148,5 +148,25 @@ BOOST_AUTO_TEST_CASE(mnemonic_new__invoke__128_bits_zh_Hant__okay_output)
     BX_REQUIRE_OUTPUT("博 肉 地 危 惜 多 陪 荒 因 患 伊 基\n");
 }
 
+BOOST_AUTO_TEST_CASE(mnemonic_new__invoke__count_64_bits__okay_output)
+{
+    BX_DECLARE_COMMAND(mnemonic_new);
+    command.set_count_option(2);
+    command.set_bit_length_option(64);
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    const auto text = output.str();
+    BOOST_REQUIRE_EQUAL(std::count(text.begin(), text.end(), '\n'), 2);
+    BOOST_REQUIRE_EQUAL(std::count(text.begin(), text.end(), ' '), 2 * 5);
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic_new__invoke__count_48_bits__failure_error)
+{
+    BX_DECLARE_COMMAND(mnemonic_new);
+    command.set_count_option(2);
+    command.set_bit_length_option(48);
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_MNEMONIC_NEW_BIT_LENGTH_UNSUPPORTED "\n");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command.hpp"
+
+#include <sstream>
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(pipeline__invoke)
+
+#define BX_PIPELINE_PRIVATE_KEY "8ed1d17dabce1fccbbe5e9bf008b318334e5bcc78eb9e7c1ea850b7eb0ddb9c8"
+
+BOOST_AUTO_TEST_CASE(pipeline__invoke__no_stages__failure_error)
+{
+    BX_DECLARE_COMMAND(pipeline);
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_PIPELINE_STAGE_REQUIRED "\n");
+}
+
+BOOST_AUTO_TEST_CASE(pipeline__invoke__unknown_stage__failure_error)
+{
+    BX_DECLARE_COMMAND(pipeline);
+    command.set_stages_argument({ "foobar -i 0" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR((format(BX_PIPELINE_STAGE_INVALID) % "foobar -i 0").str() + "\n");
+}
+
+BOOST_AUTO_TEST_CASE(pipeline__invoke__nested_pipeline__failure_error)
+{
+    BX_DECLARE_COMMAND(pipeline);
+    command.set_stages_argument({ "pipeline seed" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR((format(BX_PIPELINE_STAGE_INVALID) % "pipeline seed").str() + "\n");
+}
+
+BOOST_AUTO_TEST_CASE(pipeline__invoke__two_stages__okay_output)
+{
+    BX_DECLARE_COMMAND(pipeline);
+    command.set_count_option(1);
+    command.set_stages_argument({ "ec-to-public " BX_PIPELINE_PRIVATE_KEY, "ec-to-address" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("1EKJFK8kBmasFRYY3Ay9QjpJLm4vemJtC1\n");
+}
+
+BOOST_AUTO_TEST_CASE(pipeline__invoke__count_3__okay_ordered_output)
+{
+    BX_DECLARE_COMMAND(pipeline);
+    command.set_count_option(3);
+    command.set_stages_argument({ "ec-to-public " BX_PIPELINE_PRIVATE_KEY, "ec-to-address -v 111" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(
+        "mtqFYNDizo282Y29kjwXEf2dCkfdZZydbf\n"
+        "mtqFYNDizo282Y29kjwXEf2dCkfdZZydbf\n"
+        "mtqFYNDizo282Y29kjwXEf2dCkfdZZydbf\n");
+}
+
+BOOST_AUTO_TEST_CASE(pipeline__invoke__invalid_stage_input__failure)
+{
+    BX_DECLARE_COMMAND(pipeline);
+    command.set_count_option(1);
+    command.set_stages_argument({ "ec-to-address" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+}
+
+BOOST_AUTO_TEST_CASE(pipeline__invoke__typed_stages__okay_output)
+{
+    BX_DECLARE_COMMAND(pipeline);
+    command.set_count_option(1);
+    command.set_stages_argument({ "ec-to-wif " BX_PIPELINE_PRIVATE_KEY, "wif-to-public", "ec-to-address" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("1EKJFK8kBmasFRYY3Ay9QjpJLm4vemJtC1\n");
+}
+
+BOOST_AUTO_TEST_CASE(pipeline__invoke__input_lines__okay_output)
+{
+    BX_DECLARE_COMMAND(pipeline);
+    std::istringstream input(
+        BX_PIPELINE_PRIVATE_KEY "\n"
+        BX_PIPELINE_PRIVATE_KEY "\n");
+    command.set_input(input);
+    command.set_file_option({ "-" });
+    command.set_stages_argument({ "ec-to-public", "ec-to-address" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(
+        "1EKJFK8kBmasFRYY3Ay9QjpJLm4vemJtC1\n"
+        "1EKJFK8kBmasFRYY3Ay9QjpJLm4vemJtC1\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
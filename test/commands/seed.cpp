@@ -17,6 +17,9 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <thread>
+#include <vector>
 #include "command.hpp"
 
 BX_USING_NAMESPACES()
@@ -69,5 +72,45 @@ BOOST_AUTO_TEST_CASE(seed__invoke__not_byte_aligned__failure_error)
     BX_REQUIRE_ERROR(BX_SEED_BIT_LENGTH_UNSUPPORTED "\n");
 }
 
+BOOST_AUTO_TEST_CASE(seed__invoke__count_3000__okay_output)
+{
+    BX_DECLARE_COMMAND(seed);
+    command.set_bit_length_option(128);
+    command.set_count_option(3000);
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BOOST_REQUIRE(output.str().size() == 3000 * BX_SEED_BITS_TO_TERMINATED_BASE16(128));
+}
+
+BOOST_AUTO_TEST_CASE(seed__invoke__count_too_short__failure_error)
+{
+    BX_DECLARE_COMMAND(seed);
+    command.set_bit_length_option(64);
+    command.set_count_option(2);
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_SEED_BIT_LENGTH_UNSUPPORTED "\n");
+}
+
+// Threads started at once share the clock, which must not determine seeds.
+BOOST_AUTO_TEST_CASE(seed__new_seed__concurrent__distinct)
+{
+    const size_t threads = 8;
+    std::vector<data_chunk> seeds(threads);
+    std::vector<std::thread> pool;
+
+    for (size_t index = 0; index < threads; ++index)
+        pool.emplace_back([&seeds, index]()
+        {
+            seeds[index] = new_seed(128);
+        });
+
+    for (auto& thread: pool)
+        thread.join();
+
+    std::sort(seeds.begin(), seeds.end());
+    BOOST_REQUIRE_EQUAL(seeds.front().size(), 16u);
+    BOOST_REQUIRE(std::adjacent_find(seeds.begin(), seeds.end()) ==
+        seeds.end());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
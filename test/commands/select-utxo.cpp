@@ -0,0 +1,60 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(network)
+BOOST_AUTO_TEST_SUITE(select_utxo__invoke)
+
+// This amount may change at any time, making these particular tests fragile.
+
+// Vector: github.com/spesmilo/sx/blob/master/README.md
+#define BX_SELECT_UTXO_DEMO2_KEY "0550bf9055a9a10e453f7ee6cf584ab61307f64a62aa0b3dba11068cf4ac7efe" // 13Ft7SkreJY9D823NPm4t6D1cBqLYTJtAe
+#define BX_SELECT_UTXO_DEMO2_POINT "b7354b8b9cc9a856aedaa349cffa289ae9917771f4e06b2386636b3c073df1b5:0\n"
+
+BOOST_AUTO_TEST_CASE(select_utxo__invoke__mainnet_sx_demo2__okay_output)
+{
+    BX_DECLARE_CLIENT_COMMAND(select_utxo);
+    command.set_satoshi_argument(50000);
+    command.set_keys_argument({ { BX_SELECT_UTXO_DEMO2_KEY } });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(BX_SELECT_UTXO_DEMO2_POINT);
+}
+
+BOOST_AUTO_TEST_CASE(select_utxo__invoke__mainnet_sx_demo2_excessive_amount__failure_error)
+{
+    BX_DECLARE_CLIENT_COMMAND(select_utxo);
+    command.set_satoshi_argument(90000);
+    command.set_keys_argument({ { BX_SELECT_UTXO_DEMO2_KEY } });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR((format(BX_SELECT_UTXO_INSUFFICIENT) % 90000).str() + "\n");
+}
+
+BOOST_AUTO_TEST_CASE(select_utxo__invoke__zero_satoshi__failure_error)
+{
+    BX_DECLARE_CLIENT_COMMAND(select_utxo);
+    command.set_satoshi_argument(0);
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_SELECT_UTXO_SATOSHI_REQUIRED "\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
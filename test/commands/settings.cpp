@@ -36,14 +36,21 @@ BOOST_AUTO_TEST_SUITE(settings__invoke)
 "        error_file \"\"\n" \
 "        hosts_file \"\"\n" \
 "        identifier 0\n" \
+"        log_severity info\n" \
 "        seeds mainnet1.libbitcoin.net:8333,mainnet2.libbitcoin.net:8333,mainnet3.libbitcoin.net:8333,mainnet4.libbitcoin.net:8333\n" \
 "    }\n" \
 "    server\n" \
 "    {\n" \
+"        agent \"\"\n" \
 "        block_url localhost\n" \
 "        client_private_key 0000000000000000000000000000000000000000\n" \
 "        connect_retries 0\n" \
 "        connect_timeout_seconds 0\n" \
+"        headers_file \"\"\n" \
+"        hedge_percentile 0\n" \
+"        hedge_server_public_key 0000000000000000000000000000000000000000\n" \
+"        hedge_url localhost\n" \
+"        request_timeout_milliseconds 0\n" \
 "        server_public_key 0000000000000000000000000000000000000000\n" \
 "        socks_proxy [::]\n" \
 "        transaction_url localhost\n" \
@@ -73,14 +80,21 @@ BOOST_AUTO_TEST_SUITE(settings__invoke)
 "        error_file error.log\n" \
 "        hosts_file my.hosts\n" \
 "        identifier 10\n" \
+"        log_severity warning\n" \
 "        seeds seed1.libbitcoin.org:8333,seed2.libbitcoin.org:8333\n" \
 "    }\n" \
 "    server\n" \
 "    {\n" \
+"        agent bx.agent\n" \
 "        block_url https://mainnet.obelisk.net:43\n" \
 "        client_private_key \"JTKVSB%%)wK0E.X)V>+}o?pNmC{O&4W4b!Ni{Lh6\"\n" \
 "        connect_retries 21\n" \
 "        connect_timeout_seconds 22\n" \
+"        headers_file bx.headers\n" \
+"        hedge_percentile 90\n" \
+"        hedge_server_public_key \"CrWu}il)+MbqD60BV)v/xt&Xtwj*$[Q}Q{$9}hom\"\n" \
+"        hedge_url https://mainnet.obelisk.net:45\n" \
+"        request_timeout_milliseconds 2500\n" \
 "        server_public_key \"CrWu}il)+MbqD60BV)v/xt&Xtwj*$[Q}Q{$9}hom\"\n" \
 "        socks_proxy 127.0.0.42:4242\n" \
 "        transaction_url https://mainnet.obelisk.net:44\n" \
@@ -122,6 +136,7 @@ BOOST_AUTO_TEST_CASE(settings__invoke__test_values__okay_output)
     command.set_network_hosts_file_setting("my.hosts");
     command.set_network_debug_file_setting("debug.log");
     command.set_network_error_file_setting("error.log");
+    command.set_network_log_severity_setting({ "warning" });
     command.set_network_seeds_setting({ { "seed1.libbitcoin.org:8333" }, { "seed2.libbitcoin.org:8333" } });
     command.set_server_url_setting({ "https://mainnet.obelisk.net:42" });
     command.set_server_block_url_setting({ "https://mainnet.obelisk.net:43" });
@@ -131,6 +146,12 @@ BOOST_AUTO_TEST_CASE(settings__invoke__test_values__okay_output)
     command.set_server_connect_timeout_seconds_setting(22);
     command.set_server_server_public_key_setting({ "CrWu}il)+MbqD60BV)v/xt&Xtwj*$[Q}Q{$9}hom" });
     command.set_server_client_private_key_setting({ "JTKVSB%%)wK0E.X)V>+}o?pNmC{O&4W4b!Ni{Lh6" });
+    command.set_server_agent_setting("bx.agent");
+    command.set_server_hedge_url_setting({ "https://mainnet.obelisk.net:45" });
+    command.set_server_hedge_server_public_key_setting({ "CrWu}il)+MbqD60BV)v/xt&Xtwj*$[Q}Q{$9}hom" });
+    command.set_server_hedge_percentile_setting(90);
+    command.set_server_request_timeout_milliseconds_setting(2500);
+    command.set_server_headers_file_setting("bx.headers");
     BX_REQUIRE_OKAY(command.invoke(output, error));
     BX_REQUIRE_OUTPUT(BX_SETTINGS_TEST_VALUES);
 }
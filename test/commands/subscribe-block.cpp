@@ -17,7 +17,14 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include "command.hpp"
+#include "../stub_server.hpp"
 
 BX_USING_NAMESPACES()
 
@@ -41,3 +48,284 @@ BOOST_AUTO_TEST_CASE(subscribe_block__invoke__testnet_one_second_duration__okay)
 
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(subscribe_block__follow)
+
+static const auto followed_hash = bitcoin_short_hash(data_chunk{ 42 });
+static const wallet::payment_address followed(followed_hash, 0x00);
+
+static chain::transaction pay(const chain::output_point& spend,
+    uint64_t value)
+{
+    chain::transaction tx;
+    tx.set_version(1);
+    tx.set_inputs({ chain::input(spend, chain::script{}, max_uint32) });
+    tx.set_outputs({ chain::output(value, chain::script(
+        chain::script::to_pay_key_hash_pattern(followed_hash))) });
+    return tx;
+}
+
+static chain::block make_block(const hash_digest& parent, uint32_t nonce,
+    const chain::transaction::list& transactions)
+{
+    return chain::block(chain::header(1, parent, null_hash, 0, 0, nonce),
+        transactions);
+}
+
+BOOST_AUTO_TEST_CASE(subscribe_block__follow__pay_spend_reorganize__events)
+{
+    std::vector<chain_follower::event> events;
+    chain_follower follower(10, { followed }, 0x00, 0x05,
+        [&events](const chain_follower::event& event)
+        {
+            events.push_back(event);
+        });
+
+    const auto base = bitcoin_hash(data_chunk{ 0 });
+    follower.start(100, base);
+
+    const auto paid = pay({ null_hash, 0 }, 1000);
+    const auto block1 = make_block(base, 1, { paid });
+    BOOST_REQUIRE(follower.connect(block1));
+    BOOST_REQUIRE_EQUAL(follower.top_height(), 101u);
+    BOOST_REQUIRE_EQUAL(follower.unspent(), 1u);
+    BOOST_REQUIRE_EQUAL(events.size(), 1u);
+    BOOST_REQUIRE(events.back().add);
+    BOOST_REQUIRE_EQUAL(events.back().height, 101u);
+    BOOST_REQUIRE_EQUAL(events.back().output.value, 1000u);
+    BOOST_REQUIRE(events.back().output.point.hash() == paid.hash());
+    BOOST_REQUIRE(events.back().output.address == followed);
+
+    // The spend pays another followed output.
+    const auto spend = pay({ paid.hash(), 0 }, 900);
+    const auto block2 = make_block(block1.hash(), 2, { spend });
+    BOOST_REQUIRE(follower.connect(block2));
+    BOOST_REQUIRE_EQUAL(follower.unspent(), 1u);
+    BOOST_REQUIRE_EQUAL(events.size(), 3u);
+    BOOST_REQUIRE(!events[1].add);
+    BOOST_REQUIRE(events[1].output.point.hash() == paid.hash());
+    BOOST_REQUIRE(events[2].add);
+    BOOST_REQUIRE(events[2].output.point.hash() == spend.hash());
+
+    // A competing block at height 102 reverses block2 in reverse order.
+    const auto block2b = make_block(block1.hash(), 3, {});
+    BOOST_REQUIRE(follower.connect(block2b));
+    BOOST_REQUIRE_EQUAL(follower.top_height(), 102u);
+    BOOST_REQUIRE(follower.top_hash() == block2b.hash());
+    BOOST_REQUIRE_EQUAL(follower.unspent(), 1u);
+    BOOST_REQUIRE_EQUAL(events.size(), 5u);
+    BOOST_REQUIRE(!events[3].add);
+    BOOST_REQUIRE(events[3].output.point.hash() == spend.hash());
+    BOOST_REQUIRE(events[4].add);
+    BOOST_REQUIRE(events[4].output.point.hash() == paid.hash());
+    BOOST_REQUIRE_EQUAL(events[4].height, 102u);
+}
+
+BOOST_AUTO_TEST_CASE(subscribe_block__follow__unknown_parent__false)
+{
+    chain_follower follower(10, { followed }, 0x00, 0x05,
+        [](const chain_follower::event&) {});
+
+    follower.start(0, bitcoin_hash(data_chunk{ 0 }));
+    const auto orphan = make_block(bitcoin_hash(data_chunk{ 1 }), 1, {});
+    BOOST_REQUIRE(!follower.connect(orphan));
+    BOOST_REQUIRE_EQUAL(follower.top_height(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(subscribe_block__follow__below_depth__false)
+{
+    chain_follower follower(1, { followed }, 0x00, 0x05,
+        [](const chain_follower::event&) {});
+
+    const auto base = bitcoin_hash(data_chunk{ 0 });
+    follower.start(0, base);
+    const auto block1 = make_block(base, 1, {});
+    const auto block2 = make_block(block1.hash(), 2, {});
+    BOOST_REQUIRE(follower.connect(block1));
+    BOOST_REQUIRE(follower.connect(block2));
+
+    // Only block1 and block2 are retained.
+    BOOST_REQUIRE(!follower.contains(base));
+    BOOST_REQUIRE(!follower.connect(make_block(base, 3, {})));
+    BOOST_REQUIRE(follower.disconnect());
+    BOOST_REQUIRE(!follower.disconnect());
+}
+
+// The blocks of a server chain, by height, served to the follower.
+struct served_chain
+{
+    std::mutex mutex;
+    uint32_t top;
+    std::map<uint32_t, chain::block> blocks;
+    data_chunk history;
+};
+
+// A history4 receive row, as [kind][hash][index][height][value].
+static data_chunk receive_row(const hash_digest& hash, uint32_t height,
+    uint64_t value)
+{
+    return build_chunk(
+    {
+        data_chunk{ 0 },
+        to_chunk(hash),
+        to_chunk(to_little_endian<uint32_t>(0)),
+        to_chunk(to_little_endian<uint32_t>(height)),
+        to_chunk(to_little_endian<uint64_t>(value))
+    });
+}
+
+static uint32_t requested_height(const data_stack& request)
+{
+    BOOST_REQUIRE_EQUAL(request.size(), 1u);
+    return from_little_endian<uint32_t>(request.front().begin(),
+        request.front().end());
+}
+
+static void script(stub_server& server, std::shared_ptr<served_chain> served)
+{
+    server.set_handler("blockchain.fetch_last_height",
+        [served](const data_stack&) -> data_chunk
+        {
+            std::lock_guard<std::mutex> lock(served->mutex);
+            return to_chunk(to_little_endian(served->top));
+        });
+    server.set_handler("blockchain.fetch_block_header",
+        [served](const data_stack& request) -> data_chunk
+        {
+            std::lock_guard<std::mutex> lock(served->mutex);
+            return served->blocks[requested_height(request)].header()
+                .to_data();
+        });
+    server.set_handler("blockchain.fetch_block",
+        [served](const data_stack& request) -> data_chunk
+        {
+            std::lock_guard<std::mutex> lock(served->mutex);
+            return served->blocks[requested_height(request)].to_data();
+        });
+    server.set_handler("blockchain.fetch_history4",
+        [served](const data_stack&) -> data_chunk
+        {
+            std::lock_guard<std::mutex> lock(served->mutex);
+            return served->history;
+        });
+}
+
+BOOST_AUTO_TEST_CASE(subscribe_block__follow__gap_and_reorganization__events)
+{
+    const auto served = std::make_shared<served_chain>();
+    const auto block100 = make_block(bitcoin_hash(data_chunk{ 0 }), 0, {});
+    served->top = 100;
+    served->blocks[100] = block100;
+
+    stub_server server;
+    script(server, served);
+    BOOST_REQUIRE(server.start());
+
+    BX_DECLARE_STUB_COMMAND(subscribe_block, server);
+    command.set_follow_option(true);
+    command.set_addresses_option({ followed });
+    command.set_duration_option(3);
+
+    auto result = console_result::failure;
+    std::thread follow([&]()
+    {
+        result = command.invoke(output, error);
+    });
+
+    // Blocks 101 and 102 are missed, and fetched when 103 is received.
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    const auto paid = pay({ null_hash, 0 }, 1000);
+    const auto block101 = make_block(block100.hash(), 1, { paid });
+    const auto block102 = make_block(block101.hash(), 2, {});
+    const auto block103 = make_block(block102.hash(), 3, {});
+    {
+        std::lock_guard<std::mutex> lock(served->mutex);
+        served->blocks[101] = block101;
+        served->blocks[102] = block102;
+        served->blocks[103] = block103;
+        served->top = 103;
+    }
+
+    server.publish_block(103, block103);
+
+    // Blocks 102 and 103 are replaced, the new 102 spending the payment.
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    const auto spend = pay({ paid.hash(), 0 }, 900);
+    const auto block102b = make_block(block101.hash(), 4, { spend });
+    const auto block103b = make_block(block102b.hash(), 5, {});
+    const auto block104b = make_block(block103b.hash(), 6, {});
+    {
+        std::lock_guard<std::mutex> lock(served->mutex);
+        served->blocks[102] = block102b;
+        served->blocks[103] = block103b;
+        served->blocks[104] = block104b;
+        served->top = 104;
+    }
+
+    server.publish_block(104, block104b);
+    follow.join();
+
+    const auto line = [](const char* message, size_t height,
+        const chain::transaction& tx, uint64_t value)
+    {
+        return (format(message) % height % encode_hash(tx.hash()) % 0 %
+            value % followed).str() + "\n";
+    };
+
+    BX_REQUIRE_OKAY(result);
+    BX_REQUIRE_OUTPUT(
+        line(BX_SUBSCRIBE_BLOCK_ADDED, 101, paid, 1000) +
+        line(BX_SUBSCRIBE_BLOCK_REMOVED, 102, paid, 1000) +
+        line(BX_SUBSCRIBE_BLOCK_ADDED, 102, spend, 900));
+    BOOST_REQUIRE_EQUAL(server.requests("blockchain.fetch_block"), 6u);
+}
+
+BOOST_AUTO_TEST_CASE(subscribe_block__follow__spend_of_prior_output__removed)
+{
+    // The payment is confirmed at 90, before following starts at 100.
+    const auto paid = pay({ null_hash, 0 }, 1000);
+    const auto served = std::make_shared<served_chain>();
+    const auto block100 = make_block(bitcoin_hash(data_chunk{ 0 }), 0, {});
+    served->top = 100;
+    served->blocks[100] = block100;
+    served->history = receive_row(paid.hash(), 90, 1000);
+
+    stub_server server;
+    script(server, served);
+    BOOST_REQUIRE(server.start());
+
+    BX_DECLARE_STUB_COMMAND(subscribe_block, server);
+    command.set_follow_option(true);
+    command.set_addresses_option({ followed });
+    command.set_duration_option(2);
+
+    auto result = console_result::failure;
+    std::thread follow([&]()
+    {
+        result = command.invoke(output, error);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    chain::transaction spend;
+    spend.set_version(1);
+    spend.set_inputs({ chain::input({ paid.hash(), 0 }, chain::script{},
+        max_uint32) });
+    const auto block101 = make_block(block100.hash(), 1, { spend });
+    {
+        std::lock_guard<std::mutex> lock(served->mutex);
+        served->blocks[101] = block101;
+        served->top = 101;
+    }
+
+    server.publish_block(101, block101);
+    follow.join();
+
+    BX_REQUIRE_OKAY(result);
+    BX_REQUIRE_OUTPUT((format(BX_SUBSCRIBE_BLOCK_REMOVED) % 101 %
+        encode_hash(paid.hash()) % 0 % 1000 % followed).str() + "\n");
+    BOOST_REQUIRE_EQUAL(server.requests("blockchain.fetch_history4"), 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
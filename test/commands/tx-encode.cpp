@@ -19,6 +19,8 @@
 
 #include "command.hpp"
 
+#include <boost/filesystem.hpp>
+
 BX_USING_NAMESPACES()
 
 BOOST_AUTO_TEST_SUITE(offline)
@@ -71,5 +73,119 @@ BOOST_AUTO_TEST_CASE(tx_encode__invoke__example3__okay_output)
     BX_REQUIRE_OUTPUT("0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee09701000000000700000001f4010000000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000" "\n");
 }
 
+// A records file in the temporary directory, removed when destroyed.
+class records_file
+{
+public:
+    records_file(const std::string& records)
+      : path_(boost::filesystem::temp_directory_path() /
+            boost::filesystem::unique_path("bx-tx-encode-%%%%-%%%%.csv"))
+    {
+        ofstream file(path_.string());
+        file << records;
+    }
+
+    ~records_file()
+    {
+        boost::system::error_code ignored;
+        boost::filesystem::remove(path_, ignored);
+    }
+
+    const boost::filesystem::path& path() const
+    {
+        return path_;
+    }
+
+private:
+    const boost::filesystem::path path_;
+};
+
+BOOST_AUTO_TEST_CASE(tx_encode__invoke__example1_file__expected_output)
+{
+    BX_DECLARE_COMMAND(tx_encode);
+    const records_file records(
+        "# payout\n"
+        "input,97e06e49dfdd26c5a904670971ccf4c7fe7d9da53cb379bf9b442fc9427080b3:0\n"
+        "1966U1pjj15tLxPXZ19U48c99EJDkdXeqb, 45000\n");
+    command.set_version_option(1);
+    command.set_script_version_option(5);
+    command.set_file_option(records.path());
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970000000000ffffffff01c8af0000000000001976a91458b7a60f11a904feef35a639b6048de8dd4d9f1c88ac00000000" "\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_encode__invoke__invalid_record__invalid_record_error)
+{
+    BX_DECLARE_COMMAND(tx_encode);
+    const records_file records(
+        "output,1966U1pjj15tLxPXZ19U48c99EJDkdXeqb,45000\n"
+        "1966U1pjj15tLxPXZ19U48c99EJDkdXeqb,-1\n");
+    command.set_script_version_option(5);
+    command.set_file_option(records.path());
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR((format(BX_TX_ENCODE_INVALID_RECORD) % 2).str() + "\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_encode__invoke__split_unvalued_input__split_requirements_error)
+{
+    BX_DECLARE_COMMAND(tx_encode);
+    command.set_script_version_option(5);
+    command.set_max_weight_option(4000);
+    command.set_change_option({ "13Ft7SkreJY9D823NPm4t6D1cBqLYTJtAe" });
+    command.set_inputs_option({ { "97e06e49dfdd26c5a904670971ccf4c7fe7d9da53cb379bf9b442fc9427080b3:0" } });
+    command.set_outputs_option({ { "1966U1pjj15tLxPXZ19U48c99EJDkdXeqb:45000" } });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_TX_ENCODE_SPLIT_REQUIREMENTS "\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_encode__invoke__split_with_change__expected_output)
+{
+    BX_DECLARE_COMMAND(tx_encode);
+    const records_file records(
+        "input,97e06e49dfdd26c5a904670971ccf4c7fe7d9da53cb379bf9b442fc9427080b3:0,100000\n"
+        "1966U1pjj15tLxPXZ19U48c99EJDkdXeqb,45000\n");
+    command.set_version_option(1);
+    command.set_script_version_option(5);
+    command.set_max_weight_option(4000);
+    command.set_change_option({ "13Ft7SkreJY9D823NPm4t6D1cBqLYTJtAe" });
+    command.set_file_option(records.path());
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970000000000ffffffff02c8af0000000000001976a91458b7a60f11a904feef35a639b6048de8dd4d9f1c88acf6d50000000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000" "\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_encode__invoke__split_two_transactions__expected_output)
+{
+    BX_DECLARE_COMMAND(tx_encode);
+    const records_file records(
+        "input,97e06e49dfdd26c5a904670971ccf4c7fe7d9da53cb379bf9b442fc9427080b3:0,100000\n"
+        "input,97e06e49dfdd26c5a904670971ccf4c7fe7d9da53cb379bf9b442fc9427080b3:1,100000\n"
+        "1966U1pjj15tLxPXZ19U48c99EJDkdXeqb,45000\n"
+        "1966U1pjj15tLxPXZ19U48c99EJDkdXeqb,45000\n");
+    command.set_version_option(1);
+    command.set_script_version_option(5);
+    command.set_max_weight_option(1000);
+    command.set_change_option({ "13Ft7SkreJY9D823NPm4t6D1cBqLYTJtAe" });
+    command.set_file_option(records.path());
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(
+        "0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970000000000ffffffff02c8af0000000000001976a91458b7a60f11a904feef35a639b6048de8dd4d9f1c88acf6d50000000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000" "\n"
+        "0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970100000000ffffffff02c8af0000000000001976a91458b7a60f11a904feef35a639b6048de8dd4d9f1c88acf6d50000000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000" "\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_encode__invoke__split_unused_input__split_unused_error)
+{
+    BX_DECLARE_COMMAND(tx_encode);
+    const records_file records(
+        "input,97e06e49dfdd26c5a904670971ccf4c7fe7d9da53cb379bf9b442fc9427080b3:0,100000\n"
+        "input,97e06e49dfdd26c5a904670971ccf4c7fe7d9da53cb379bf9b442fc9427080b3:1,100000\n"
+        "1966U1pjj15tLxPXZ19U48c99EJDkdXeqb,45000\n");
+    command.set_script_version_option(5);
+    command.set_max_weight_option(4000);
+    command.set_change_option({ "13Ft7SkreJY9D823NPm4t6D1cBqLYTJtAe" });
+    command.set_file_option(records.path());
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR((format(BX_TX_ENCODE_SPLIT_UNUSED) % 2).str() + "\n");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
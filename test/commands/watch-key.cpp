@@ -18,6 +18,15 @@
  */
 
 #include "command.hpp"
+#include "../stub_server.hpp"
+
+#include <fstream>
+#include <thread>
+#include <boost/filesystem.hpp>
+
+#ifndef _MSC_VER
+#include <sys/stat.h>
+#endif
 
 BX_USING_NAMESPACES()
 
@@ -28,7 +37,7 @@ BOOST_AUTO_TEST_CASE(watch_key__invoke__one_second_duration__okay)
 {
     BX_DECLARE_CLIENT_COMMAND(watch_key);
     command.set_duration_option(1);
-    command.set_hash_argument({ BX_FIRST_KEY });
+    command.set_keys_argument({ { BX_FIRST_KEY } });
     // Timeout is returned when duration is elapsed.
     BX_REQUIRE_FAILURE(command.invoke(output, error));
 }
@@ -37,10 +46,116 @@ BOOST_AUTO_TEST_CASE(watch_key__invoke__testnet_one_second_duration__okay)
 {
     BX_DECLARE_CLIENT_TESTNET_COMMAND(watch_key);
     command.set_duration_option(1);
-    command.set_hash_argument({ BX_FIRST_TESTNET_KEY });
+    command.set_keys_argument({ { BX_FIRST_TESTNET_KEY } });
+    // Timeout is returned when duration is elapsed.
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+}
+
+BOOST_AUTO_TEST_CASE(watch_key__invoke__two_keys_one_second_duration__okay)
+{
+    BX_DECLARE_CLIENT_COMMAND(watch_key);
+    command.set_duration_option(1);
+    command.set_keys_argument(
+    {
+        { BX_FIRST_KEY },
+        { BX_FIRST_TESTNET_KEY }
+    });
     // Timeout is returned when duration is elapsed.
     BX_REQUIRE_FAILURE(command.invoke(output, error));
 }
 
+BOOST_AUTO_TEST_CASE(watch_key__invoke__missing_pipe__failure_error)
+{
+    BX_DECLARE_CLIENT_COMMAND(watch_key);
+    command.set_duration_option(1);
+    command.set_pipe_option("missing-watch-key-pipe");
+    command.set_keys_argument({ { BX_FIRST_KEY } });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR((format(BX_WATCH_KEY_PIPE_FAILURE) % "missing-watch-key-pipe").str() + "\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(watch_key__invoke)
+
+static size_t count(const std::string& text, const std::string& part)
+{
+    size_t found = 0;
+    for (auto at = text.find(part); at != std::string::npos;
+        at = text.find(part, at + part.size()))
+        ++found;
+
+    return found;
+}
+
+BOOST_AUTO_TEST_CASE(watch_key__invoke__stub_server_renewal__one_registration)
+{
+    stub_server server;
+    server.set_reply("subscribe.key", {});
+    server.set_reply("unsubscribe.key", {});
+    BOOST_REQUIRE(server.start());
+
+    const auto key = bitcoin_hash(data_chunk{ 42 });
+    BX_DECLARE_STUB_COMMAND(watch_key, server);
+    command.set_keys_argument({ key });
+    command.set_duration_option(3);
+    command.set_renew_option(1);
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+
+    // Each renewal releases the previous registration of the key.
+    const auto subscribed = server.requests("subscribe.key");
+    BOOST_REQUIRE_GE(subscribed, 2u);
+    BOOST_REQUIRE_EQUAL(server.requests("unsubscribe.key"), subscribed - 1);
+
+    // Renewal acknowledgements are not displayed.
+    const auto waiting = (format(BX_WATCH_KEY_WAITING) %
+        encode_hash(key)).str();
+    BOOST_REQUIRE_EQUAL(count(output.str(), waiting), 1u);
+    BOOST_REQUIRE_EQUAL(error.str(), "");
+}
+
+#ifndef _MSC_VER
+BOOST_AUTO_TEST_CASE(watch_key__invoke__stub_server_pipe__add_remove)
+{
+    stub_server server;
+    server.set_reply("subscribe.key", {});
+    server.set_reply("unsubscribe.key", {});
+    BOOST_REQUIRE(server.start());
+
+    const auto pipe = boost::filesystem::temp_directory_path() /
+        boost::filesystem::unique_path("bx-watch-key-%%%%-%%%%.pipe");
+    BOOST_REQUIRE_EQUAL(mkfifo(pipe.string().c_str(), 0600), 0);
+
+    const auto key = encode_hash(bitcoin_hash(data_chunk{ 42 }));
+
+    // Opening the pipe for writing blocks until the command opens it.
+    std::thread writer([&pipe, &key]()
+    {
+        std::ofstream stream(pipe.string());
+        stream << "+" << key << "\n" << "bogus" << "\n" << "-" << key
+            << std::endl;
+    });
+
+    BX_DECLARE_STUB_COMMAND(watch_key, server);
+    command.set_pipe_option(pipe);
+    command.set_duration_option(2);
+    command.set_renew_option(0);
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    writer.join();
+    boost::filesystem::remove(pipe);
+
+    BOOST_REQUIRE_EQUAL(server.requests("subscribe.key"), 1u);
+    BOOST_REQUIRE_EQUAL(server.requests("unsubscribe.key"), 1u);
+    BOOST_REQUIRE_EQUAL(error.str(),
+        (format(BX_WATCH_KEY_INVALID_COMMAND) % "bogus").str() + "\n");
+
+    // The key may be acknowledged before its removal is read from the pipe.
+    const auto removed = (format(BX_WATCH_KEY_REMOVED) % key).str();
+    BOOST_REQUIRE_EQUAL(count(output.str(), removed), 1u);
+}
+#endif
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
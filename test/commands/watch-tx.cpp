@@ -21,14 +21,28 @@
 
 BX_USING_NAMESPACES()
 
-BOOST_AUTO_TEST_SUITE(stub)
+BOOST_AUTO_TEST_SUITE(network)
 BOOST_AUTO_TEST_SUITE(watch_tx__invoke)
 
-BOOST_AUTO_TEST_CASE(watch_tx__invoke__invoke__always__failure_error)
+#define BX_WATCH_TX_SECOND_TX_HASH \
+"0e3e2357e806b6cdb1f70b54c3a3a17b6714ee1f0e68bebb44a74b1efd512098"
+#define BX_WATCH_TX_SECOND_TX_INFO \
+"confirmation\n" \
+"{\n" \
+"    event confirmed\n" \
+"    hash 0e3e2357e806b6cdb1f70b54c3a3a17b6714ee1f0e68bebb44a74b1efd512098\n" \
+"    height 1\n" \
+"    index 0\n" \
+"}\n"
+
+BOOST_AUTO_TEST_CASE(watch_tx__invoke__mainnet_second_tx_zero_duration__okay_output)
 {
-    BX_DECLARE_COMMAND(watch_tx);
-    BX_REQUIRE_FAILURE(command.invoke(output, error));
-    BX_REQUIRE_ERROR(BX_WATCH_TX_NOT_IMPLEMENTED "\n");
+    BX_DECLARE_CLIENT_COMMAND(watch_tx);
+    command.set_duration_option(0);
+    command.set_format_option({ "info" });
+    command.set_hashes_argument({ { BX_WATCH_TX_SECOND_TX_HASH } });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(BX_WATCH_TX_SECOND_TX_INFO);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
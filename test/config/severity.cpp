@@ -0,0 +1,54 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <sstream>
+#include <boost/program_options.hpp>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer::config;
+using namespace bc::system;
+
+BOOST_AUTO_TEST_SUITE(config)
+BOOST_AUTO_TEST_SUITE(config__severity)
+
+BOOST_AUTO_TEST_CASE(severity__constructor__default__info)
+{
+    BOOST_REQUIRE(log::severity(severity()) == log::severity::info);
+}
+
+BOOST_AUTO_TEST_CASE(severity__constructor__warning__round_trips)
+{
+    const severity level("warning");
+    BOOST_REQUIRE(log::severity(level) == log::severity::warning);
+
+    std::stringstream stream;
+    stream << level;
+    BOOST_REQUIRE_EQUAL(stream.str(), "warning");
+}
+
+BOOST_AUTO_TEST_CASE(severity__constructor__bogus__throws_invalid_option_value)
+{
+    BOOST_REQUIRE_THROW(severity("bogus"),
+        boost::program_options::invalid_option_value);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
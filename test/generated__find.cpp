@@ -28,6 +28,11 @@ using namespace bc::explorer::commands;
 BOOST_AUTO_TEST_SUITE(generated)
 BOOST_AUTO_TEST_SUITE(generated__find)
 
+BOOST_AUTO_TEST_CASE(generated__find__address_batch__returns_object)
+{
+    BOOST_REQUIRE(find("address-batch") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__address_decode__returns_object)
 {
     BOOST_REQUIRE(find("address-decode") != nullptr);
@@ -48,6 +53,11 @@ BOOST_AUTO_TEST_CASE(generated__find__address_to_key__returns_object)
     BOOST_REQUIRE(find("address-to-key") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__agent__returns_object)
+{
+    BOOST_REQUIRE(find("agent") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__base16_decode__returns_object)
 {
     BOOST_REQUIRE(find("base16-decode") != nullptr);
@@ -118,6 +128,11 @@ BOOST_AUTO_TEST_CASE(generated__find__cert_public__returns_object)
     BOOST_REQUIRE(find("cert-public") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__compute_filters__returns_object)
+{
+    BOOST_REQUIRE(find("compute-filters") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__ec_add__returns_object)
 {
     BOOST_REQUIRE(find("ec-add") != nullptr);
@@ -218,6 +233,11 @@ BOOST_AUTO_TEST_CASE(generated__find__electrum_to_seed__returns_object)
     BOOST_REQUIRE(find("electrum-to-seed") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__export_blocks__returns_object)
+{
+    BOOST_REQUIRE(find("export-blocks") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__fetch_balance__returns_object)
 {
     BOOST_REQUIRE(find("fetch-balance") != nullptr);
@@ -238,6 +258,11 @@ BOOST_AUTO_TEST_CASE(generated__find__fetch_block_height__returns_object)
     BOOST_REQUIRE(find("fetch-block-height") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__fetch_block_txs__returns_object)
+{
+    BOOST_REQUIRE(find("fetch-block-txs") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__fetch_filter__returns_object)
 {
     BOOST_REQUIRE(find("fetch-filter") != nullptr);
@@ -288,6 +313,11 @@ BOOST_AUTO_TEST_CASE(generated__find__fetch_utxo__returns_object)
     BOOST_REQUIRE(find("fetch-utxo") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__fetch_wallet__returns_object)
+{
+    BOOST_REQUIRE(find("fetch-wallet") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__get_filter_checkpoint__returns_object)
 {
     BOOST_REQUIRE(find("get-filter-checkpoint") != nullptr);
@@ -338,6 +368,11 @@ BOOST_AUTO_TEST_CASE(generated__find__hd_to_wif__returns_object)
     BOOST_REQUIRE(find("hd-to-wif") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__header_sync__returns_object)
+{
+    BOOST_REQUIRE(find("header-sync") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__help__returns_object)
 {
     BOOST_REQUIRE(find("help") != nullptr);
@@ -368,6 +403,21 @@ BOOST_AUTO_TEST_CASE(generated__find__match_neutrino_script__returns_object)
     BOOST_REQUIRE(find("match-neutrino-script") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__merkle_branch__returns_object)
+{
+    BOOST_REQUIRE(find("merkle-branch") != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(generated__find__merkle_verify__returns_object)
+{
+    BOOST_REQUIRE(find("merkle-verify") != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(generated__find__message_batch__returns_object)
+{
+    BOOST_REQUIRE(find("message-batch") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__message_sign__returns_object)
 {
     BOOST_REQUIRE(find("message-sign") != nullptr);
@@ -398,6 +448,11 @@ BOOST_AUTO_TEST_CASE(generated__find__mnemonic_to_seed__returns_object)
     BOOST_REQUIRE(find("mnemonic-to-seed") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__pipeline__returns_object)
+{
+    BOOST_REQUIRE(find("pipeline") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__put_tx__returns_object)
 {
     BOOST_REQUIRE(find("put-tx") != nullptr);
@@ -443,6 +498,11 @@ BOOST_AUTO_TEST_CASE(generated__find__seed__returns_object)
     BOOST_REQUIRE(find("seed") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__select_utxo__returns_object)
+{
+    BOOST_REQUIRE(find("select-utxo") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__send_tx__returns_object)
 {
     BOOST_REQUIRE(find("send-tx") != nullptr);
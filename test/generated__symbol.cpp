@@ -28,6 +28,11 @@ using namespace bc::explorer::commands;
 BOOST_AUTO_TEST_SUITE(generated)
 BOOST_AUTO_TEST_SUITE(generated__symbol)
 
+BOOST_AUTO_TEST_CASE(generated__symbol__address_batch__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(address_batch::symbol(), "address-batch");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__address_decode__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(address_decode::symbol(), "address-decode");
@@ -48,6 +53,11 @@ BOOST_AUTO_TEST_CASE(generated__symbol__address_to_key__returns_expected_value)
     BOOST_REQUIRE_EQUAL(address_to_key::symbol(), "address-to-key");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__agent__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(agent::symbol(), "agent");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__base16_decode__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(base16_decode::symbol(), "base16-decode");
@@ -118,6 +128,11 @@ BOOST_AUTO_TEST_CASE(generated__symbol__cert_public__returns_expected_value)
     BOOST_REQUIRE_EQUAL(cert_public::symbol(), "cert-public");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__compute_filters__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(compute_filters::symbol(), "compute-filters");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__ec_add__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(ec_add::symbol(), "ec-add");
@@ -218,6 +233,11 @@ BOOST_AUTO_TEST_CASE(generated__symbol__electrum_to_seed__returns_expected_value
     BOOST_REQUIRE_EQUAL(electrum_to_seed::symbol(), "electrum-to-seed");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__export_blocks__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(export_blocks::symbol(), "export-blocks");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__fetch_balance__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(fetch_balance::symbol(), "fetch-balance");
@@ -238,6 +258,11 @@ BOOST_AUTO_TEST_CASE(generated__symbol__fetch_block_height__returns_expected_val
     BOOST_REQUIRE_EQUAL(fetch_block_height::symbol(), "fetch-block-height");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__fetch_block_txs__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(fetch_block_txs::symbol(), "fetch-block-txs");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__fetch_filter__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(fetch_filter::symbol(), "fetch-filter");
@@ -288,6 +313,11 @@ BOOST_AUTO_TEST_CASE(generated__symbol__fetch_utxo__returns_expected_value)
     BOOST_REQUIRE_EQUAL(fetch_utxo::symbol(), "fetch-utxo");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__fetch_wallet__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(fetch_wallet::symbol(), "fetch-wallet");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__get_filter_checkpoint__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(get_filter_checkpoint::symbol(), "get-filter-checkpoint");
@@ -338,6 +368,11 @@ BOOST_AUTO_TEST_CASE(generated__symbol__hd_to_wif__returns_expected_value)
     BOOST_REQUIRE_EQUAL(hd_to_wif::symbol(), "hd-to-wif");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__header_sync__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(header_sync::symbol(), "header-sync");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__help__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(help::symbol(), "help");
@@ -368,6 +403,21 @@ BOOST_AUTO_TEST_CASE(generated__symbol__match_neutrino_script__returns_expected_
     BOOST_REQUIRE_EQUAL(match_neutrino_script::symbol(), "match-neutrino-script");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__merkle_branch__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(merkle_branch::symbol(), "merkle-branch");
+}
+
+BOOST_AUTO_TEST_CASE(generated__symbol__merkle_verify__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(merkle_verify::symbol(), "merkle-verify");
+}
+
+BOOST_AUTO_TEST_CASE(generated__symbol__message_batch__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(message_batch::symbol(), "message-batch");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__message_sign__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(message_sign::symbol(), "message-sign");
@@ -398,6 +448,11 @@ BOOST_AUTO_TEST_CASE(generated__symbol__mnemonic_to_seed__returns_expected_value
     BOOST_REQUIRE_EQUAL(mnemonic_to_seed::symbol(), "mnemonic-to-seed");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__pipeline__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(pipeline::symbol(), "pipeline");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__put_tx__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(put_tx::symbol(), "put-tx");
@@ -443,6 +498,11 @@ BOOST_AUTO_TEST_CASE(generated__symbol__seed__returns_expected_value)
     BOOST_REQUIRE_EQUAL(seed::symbol(), "seed");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__select_utxo__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(select_utxo::symbol(), "select-utxo");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__send_tx__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(send_tx::symbol(), "send-tx");
@@ -0,0 +1,680 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#ifndef _MSC_VER
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+#include "commands/command.hpp"
+#include "stub_peer.hpp"
+#include "stub_server.hpp"
+
+BX_USING_NAMESPACES()
+
+using namespace std::chrono;
+
+#define LOAD_GENESIS_HEADER \
+"0100000000000000000000000000000000000000000000000000000000000000000000003ba3edfd7a7b12b27ac72c3e67768f617fc81bc3888a51323a9fb8aa4b1e5e4a29ab5f49ffff001d1dac2b7c"
+
+static data_chunk base16(const std::string& text)
+{
+    data_chunk data;
+    BOOST_REQUIRE(decode_base16(data, text));
+    return data;
+}
+
+static data_chunk height_payload(uint32_t height)
+{
+    return to_chunk(to_little_endian(height));
+}
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(stub_server__invoke)
+
+BOOST_AUTO_TEST_CASE(stub_server__fetch_height__reply__okay_output)
+{
+    stub_server server;
+    server.set_reply("blockchain.fetch_last_height", height_payload(42));
+    BOOST_REQUIRE(server.start());
+
+    BX_DECLARE_STUB_COMMAND(fetch_height, server);
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("42\n");
+    BOOST_REQUIRE_EQUAL(server.requests("blockchain.fetch_last_height"), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(stub_server__fetch_height__unscripted__failure_error)
+{
+    stub_server server;
+    BOOST_REQUIRE(server.start());
+
+    BX_DECLARE_STUB_COMMAND(fetch_height, server);
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_ERROR_MESSAGE(not_found) + "\n");
+}
+
+BOOST_AUTO_TEST_CASE(stub_server__fetch_height__error_rate_100__failure_error)
+{
+    stub_server server;
+    server.set_reply("blockchain.fetch_last_height", height_payload(42));
+    server.set_error_rate(100, error::service_stopped);
+    BOOST_REQUIRE(server.start());
+
+    BX_DECLARE_STUB_COMMAND(fetch_height, server);
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_ERROR_MESSAGE(service_stopped) + "\n");
+}
+
+BOOST_AUTO_TEST_CASE(stub_server__fetch_height__latency__delayed)
+{
+    stub_server server;
+    server.set_reply("blockchain.fetch_last_height", height_payload(42));
+    server.set_latency(50, 0);
+    BOOST_REQUIRE(server.start());
+
+    BX_DECLARE_STUB_COMMAND(fetch_height, server);
+    const auto start = steady_clock::now();
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BOOST_REQUIRE(steady_clock::now() - start >= milliseconds(50));
+}
+
+BOOST_AUTO_TEST_CASE(stub_server__fetch_header__handler__okay)
+{
+    stub_server server;
+    server.set_handler("blockchain.fetch_block_header",
+        [](const data_stack& request) -> data_chunk
+        {
+            BOOST_REQUIRE_EQUAL(request.size(), 1u);
+            return base16(LOAD_GENESIS_HEADER);
+        });
+
+    BOOST_REQUIRE(server.start());
+
+    BX_DECLARE_STUB_COMMAND(fetch_header, server);
+    command.set_format_option({ "json" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    const auto text = output.str();
+    BOOST_REQUIRE(text.find(BX_GENESIS_BLOCK_HASH) != std::string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(stub_peer__invoke)
+
+#define STUB_PEER_HOST "127.0.0.1"
+
+BOOST_AUTO_TEST_CASE(stub_peer__get_filter_checkpoint__okay)
+{
+    // Send p2p log output to /dev/null.
+    log::initialize();
+
+    stub_peer peer;
+    peer.set_chain(2001, 32);
+    BOOST_REQUIRE(peer.start());
+
+    BX_DECLARE_STUB_PEER_COMMAND(get_filter_checkpoint, peer);
+    command.set_host_option(STUB_PEER_HOST);
+    command.set_port_option(peer.port());
+    command.set_hash_argument(peer.hash(2000));
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BOOST_REQUIRE(!output.str().empty());
+}
+
+BOOST_AUTO_TEST_CASE(stub_peer__get_filter_headers__okay)
+{
+    log::initialize();
+
+    stub_peer peer;
+    peer.set_chain(100, 32);
+    BOOST_REQUIRE(peer.start());
+
+    BX_DECLARE_STUB_PEER_COMMAND(get_filter_headers, peer);
+    command.set_host_option(STUB_PEER_HOST);
+    command.set_port_option(peer.port());
+    command.set_height_argument(10);
+    command.set_hash_argument(peer.hash(20));
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BOOST_REQUIRE(!output.str().empty());
+}
+
+BOOST_AUTO_TEST_CASE(stub_peer__get_filters__okay)
+{
+    log::initialize();
+
+    stub_peer peer;
+    peer.set_chain(100, 32);
+    BOOST_REQUIRE(peer.start());
+
+    BX_DECLARE_STUB_PEER_COMMAND(get_filters, peer);
+    command.set_host_option(STUB_PEER_HOST);
+    command.set_port_option(peer.port());
+    command.set_height_argument(0);
+    command.set_hash_argument(peer.hash(99));
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BOOST_REQUIRE(!output.str().empty());
+}
+
+BOOST_AUTO_TEST_CASE(stub_peer__get_filters__no_compact_filters__failure_error)
+{
+    log::initialize();
+
+    stub_peer peer;
+    peer.set_compact_filters(false);
+    BOOST_REQUIRE(peer.start());
+
+    BX_DECLARE_STUB_PEER_COMMAND(get_filters, peer);
+    command.set_host_option(STUB_PEER_HOST);
+    command.set_port_option(peer.port());
+    command.set_hash_argument(peer.hash(0));
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    const auto text = error.str();
+    BOOST_REQUIRE(text.find(BX_BIP157_UNSUPPORTED) != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(stub_peer__put_tx__okay_accepted)
+{
+    log::initialize();
+
+    stub_peer peer;
+    BOOST_REQUIRE(peer.start());
+
+    BX_DECLARE_STUB_PEER_COMMAND(put_tx, peer);
+    command.set_host_option(STUB_PEER_HOST);
+    command.set_port_option(peer.port());
+    command.set_transaction_argument({ BX_SATOSHIS_WORDS_TX_BASE16 });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(BX_SEND_TX_NODE_OUTPUT "\n");
+
+    // The command completes on send, so the peer may not yet have it.
+    for (auto wait = 0; wait < 100 && peer.transactions().empty(); ++wait)
+        std::this_thread::sleep_for(milliseconds(10));
+
+    const auto transactions = peer.transactions();
+    BOOST_REQUIRE_EQUAL(transactions.size(), 1u);
+    BOOST_REQUIRE_EQUAL(encode_hash(transactions.front().hash()),
+        BX_SATOSHIS_WORDS_TX_HASH);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+// Run with: --run_test=benchmark
+BOOST_AUTO_TEST_SUITE(benchmark, *boost::unit_test::disabled())
+BOOST_AUTO_TEST_SUITE(benchmark__load)
+
+static const size_t load_threads = 8;
+static const size_t load_iterations = 100;
+
+// Invoke concurrently and report throughput and latency percentiles.
+static void measure_load(const std::string& name,
+    const std::function<bool()>& invoke)
+{
+    std::mutex mutex;
+    std::vector<uint32_t> latencies;
+    size_t failures = 0;
+
+    const auto start = steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for (size_t thread = 0; thread < load_threads; ++thread)
+    {
+        threads.emplace_back([&]()
+        {
+            for (size_t iteration = 0; iteration < load_iterations; ++iteration)
+            {
+                const auto begin = steady_clock::now();
+                const auto okay = invoke();
+                const auto latency = duration_cast<microseconds>(
+                    steady_clock::now() - begin).count();
+
+                std::lock_guard<std::mutex> lock(mutex);
+                latencies.push_back(static_cast<uint32_t>(latency));
+                failures += okay ? 0 : 1;
+            }
+        });
+    }
+
+    for (auto& thread: threads)
+        thread.join();
+
+    const auto elapsed = duration_cast<milliseconds>(
+        steady_clock::now() - start).count();
+
+    std::sort(latencies.begin(), latencies.end());
+    const auto percentile = [&](size_t percent)
+    {
+        return latencies[(latencies.size() - 1) * percent / 100];
+    };
+
+    BOOST_TEST_MESSAGE(name << ": " <<
+        latencies.size() * 1000 / std::max<int64_t>(elapsed, 1) <<
+        " per second, p50/p90/p99 " << percentile(50) << "/" <<
+        percentile(90) << "/" << percentile(99) << " us, " << failures <<
+        " failures");
+}
+
+// Run a subscription for its duration and report notification throughput.
+static void measure_subscription(const std::string& name,
+    const std::function<size_t()>& invoke)
+{
+    const auto start = steady_clock::now();
+    const auto notifications = invoke();
+    const auto elapsed = duration_cast<milliseconds>(
+        steady_clock::now() - start).count();
+
+    BOOST_TEST_MESSAGE(name << ": " << notifications << " notifications in "
+        << elapsed << " ms");
+}
+
+template <typename Command>
+static void load(stub_server& server, const std::string& name,
+    const std::function<void(Command&)>& setup)
+{
+    measure_load(name, [&]() -> bool
+    {
+        BX_DECLARE_STUB_COMMAND(Command, server);
+        setup(command);
+        return command.invoke(output, error) == console_result::okay;
+    });
+}
+
+// The generator point, which the spend fixture reveals.
+#define LOAD_REVEALED_POINT \
+"0279be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798"
+
+static const uint32_t load_level = message::version::level::maximum;
+
+// A spend of a p2pkh output, ending in the push of the point.
+static chain::transaction revealing_spend()
+{
+    const chain::script script(chain::operation::list
+    {
+        chain::operation(data_chunk(71, 0x42)),
+        chain::operation(base16(LOAD_REVEALED_POINT))
+    });
+
+    chain::transaction tx;
+    tx.set_version(1);
+    tx.set_inputs({ chain::input({ null_hash, 0 }, script, 0) });
+    return tx;
+}
+
+// The payments key of the p2pkh output spent by the fixture.
+static hash_digest revealed_key()
+{
+    const wallet::ec_public point(LOAD_REVEALED_POINT);
+    const wallet::payment_address address(point, 0x00);
+    return sha256_hash(address.output_script().to_data(false));
+}
+
+// Whether the first frame of the request begins with the hash.
+static bool requested(const data_stack& request, const hash_digest& hash)
+{
+    return !request.empty() && request.front().size() >= hash.size() &&
+        std::equal(hash.begin(), hash.end(), request.front().begin());
+}
+
+// Fixtures for the server queries used by bx. Other queries fail fast.
+static void script(stub_server& server)
+{
+    const auto header = base16(LOAD_GENESIS_HEADER);
+    const auto tx = base16(BX_SATOSHIS_WORDS_TX_BASE16);
+    const auto block = build_chunk({ header, data_chunk{ 1 }, tx });
+    hash_digest txid;
+    BOOST_REQUIRE(decode_hash(txid, BX_SATOSHIS_WORDS_TX_HASH));
+    hash_digest genesis;
+    BOOST_REQUIRE(decode_hash(genesis, BX_GENESIS_BLOCK_HASH));
+
+    server.set_reply("blockchain.fetch_last_height", height_payload(42));
+    server.set_reply("blockchain.fetch_block_height", height_payload(0));
+    server.set_reply("blockchain.fetch_block_header", header);
+    server.set_reply("blockchain.fetch_block", block);
+    server.set_reply("blockchain.fetch_block_transaction_hashes",
+        to_chunk(txid));
+    server.set_reply("blockchain.fetch_transaction_index",
+        build_chunk({ height_payload(0), height_payload(0) }));
+    server.set_reply("blockchain.fetch_unspent_outputs", {});
+    server.set_reply("blockchain.fetch_compact_filter",
+        message::compact_filter(neutrino_filter_type, genesis,
+            data_chunk(32, 0x42)).to_data(load_level));
+    server.set_reply("blockchain.fetch_compact_filter_headers",
+        message::compact_filter_headers(neutrino_filter_type, genesis,
+            null_hash, { bitcoin_hash(data_chunk(32, 0x42)) }).to_data(
+                load_level));
+    server.set_reply("blockchain.fetch_compact_filter_checkpoint",
+        message::compact_filter_checkpoint(neutrino_filter_type, genesis,
+            hash_list(10, null_hash)).to_data(load_level));
+
+    // Only the revealed key has history, a spend of the revealing fixture.
+    const auto spend = revealing_spend();
+    const auto key = revealed_key();
+    const auto row = build_chunk(
+    {
+        data_chunk{ 1 },
+        to_chunk(spend.hash()),
+        to_chunk(to_little_endian<uint32_t>(0)),
+        to_chunk(to_little_endian<uint32_t>(42)),
+        to_chunk(to_little_endian<uint64_t>(0))
+    });
+
+    server.set_handler("blockchain.fetch_history4",
+        [=](const data_stack& request) -> data_chunk
+        {
+            return requested(request, key) ? row : data_chunk{};
+        });
+    server.set_handler("transaction_pool.fetch_transaction2",
+        [=](const data_stack& request) -> data_chunk
+        {
+            return requested(request, spend.hash()) ? spend.to_data() : tx;
+        });
+    server.set_reply("transaction_pool.broadcast", {});
+    server.set_reply("transaction_pool.validate2", {});
+    server.set_reply("subscribe.key", {});
+    server.set_reply("unsubscribe.key", {});
+}
+
+BOOST_AUTO_TEST_CASE(benchmark__load__queries)
+{
+    stub_server server;
+    script(server);
+    server.set_latency(1, 4);
+    server.set_error_rate(1, error::channel_timeout);
+    BOOST_REQUIRE(server.start());
+
+    const hash_digest key = bitcoin_hash(data_chunk{ 42 });
+    const system::config::transaction tx(BX_SATOSHIS_WORDS_TX_BASE16);
+
+    load<fetch_height>(server, "fetch-height", [](fetch_height&) {});
+    load<fetch_header>(server, "fetch-header", [](fetch_header&) {});
+    load<fetch_block>(server, "fetch-block", [](fetch_block&) {});
+    load<fetch_block_hashes>(server, "fetch-block-hashes",
+        [](fetch_block_hashes&) {});
+    load<fetch_block_height>(server, "fetch-block-height",
+        [](fetch_block_height& command)
+        {
+            command.set_hash_argument({ BX_GENESIS_BLOCK_HASH });
+        });
+    load<fetch_balance>(server, "fetch-balance", [&](fetch_balance& command)
+    {
+        command.set_hash_argument(key);
+    });
+    load<fetch_history>(server, "fetch-history", [&](fetch_history& command)
+    {
+        command.set_hash_argument(key);
+    });
+    load<fetch_tx>(server, "fetch-tx", [](fetch_tx& command)
+    {
+        command.set_hash_argument({ BX_SATOSHIS_WORDS_TX_HASH });
+    });
+    load<fetch_tx_index>(server, "fetch-tx-index", [](fetch_tx_index& command)
+    {
+        command.set_hash_argument({ BX_SATOSHIS_WORDS_TX_HASH });
+    });
+    load<fetch_utxo>(server, "fetch-utxo", [&](fetch_utxo& command)
+    {
+        command.set_hash_argument(key);
+        command.set_satoshi_argument(1);
+    });
+    load<send_tx>(server, "send-tx", [&](send_tx& command)
+    {
+        command.set_transaction_argument(tx);
+    });
+    load<validate_tx>(server, "validate-tx", [&](validate_tx& command)
+    {
+        command.set_transaction_argument(tx);
+    });
+    load<fetch_filter>(server, "fetch-filter", [](fetch_filter& command)
+    {
+        command.set_hash_option({ BX_GENESIS_BLOCK_HASH });
+    });
+    load<fetch_filter_headers>(server, "fetch-filter-headers",
+        [](fetch_filter_headers& command)
+        {
+            command.set_start_height_argument(0);
+            command.set_stop_hash_option({ BX_GENESIS_BLOCK_HASH });
+        });
+    load<fetch_filter_checkpoint>(server, "fetch-filter-checkpoint",
+        [](fetch_filter_checkpoint& command)
+        {
+            command.set_hash_argument({ BX_GENESIS_BLOCK_HASH });
+        });
+    load<fetch_public_key>(server, "fetch-public-key",
+        [](fetch_public_key& command)
+        {
+            command.set_keys_argument({ { encode_hash(revealed_key()) } });
+        });
+}
+
+BOOST_AUTO_TEST_CASE(benchmark__load__subscriptions)
+{
+    stub_server server;
+    script(server);
+    BOOST_REQUIRE(server.start());
+
+    const auto block = chain::block::factory(build_chunk({
+        base16(LOAD_GENESIS_HEADER), data_chunk{ 1 },
+        base16(BX_SATOSHIS_WORDS_TX_BASE16) }));
+
+    std::atomic<bool> publishing(true);
+    std::thread publisher([&]()
+    {
+        for (uint32_t height = 0; publishing; ++height)
+        {
+            server.publish_block(height, block);
+            server.publish_transaction(block.transactions().front());
+            std::this_thread::sleep_for(milliseconds(1));
+        }
+    });
+
+    measure_subscription("subscribe-block", [&]() -> size_t
+    {
+        BX_DECLARE_STUB_COMMAND(subscribe_block, server);
+        command.set_duration_option(2);
+        command.invoke(output, error);
+        return static_cast<size_t>(std::count(
+            std::istreambuf_iterator<char>(output),
+            std::istreambuf_iterator<char>(), '{'));
+    });
+
+    measure_subscription("subscribe-tx", [&]() -> size_t
+    {
+        BX_DECLARE_STUB_COMMAND(subscribe_tx, server);
+        command.set_duration_option(2);
+        command.invoke(output, error);
+        return static_cast<size_t>(std::count(
+            std::istreambuf_iterator<char>(output),
+            std::istreambuf_iterator<char>(), '{'));
+    });
+
+    measure_subscription("watch-key", [&]() -> size_t
+    {
+        BX_DECLARE_STUB_COMMAND(watch_key, server);
+        command.set_keys_argument({ bitcoin_hash(data_chunk{ 42 }) });
+        command.set_duration_option(2);
+        command.set_renew_option(1);
+        command.invoke(output, error);
+        return server.requests("subscribe.key");
+    });
+
+    publishing = false;
+    publisher.join();
+
+    // Each poll of a new tip queries the position of every watched hash.
+    std::atomic<uint32_t> tip(42);
+    server.set_handler("blockchain.fetch_last_height",
+        [&](const data_stack&) -> data_chunk
+        {
+            return height_payload(tip++);
+        });
+
+    measure_subscription("watch-tx", [&]() -> size_t
+    {
+        std::vector<system::config::hash256> hashes;
+        for (uint8_t index = 0; index < 100; ++index)
+            hashes.push_back(bitcoin_hash(data_chunk{ index }));
+
+        BX_DECLARE_STUB_COMMAND(watch_tx, server);
+        command.set_hashes_argument(hashes);
+        command.set_duration_option(2);
+        command.set_interval_option(1);
+        command.invoke(output, error);
+        return server.requests("blockchain.fetch_transaction_index");
+    });
+}
+
+
+static const size_t peer_iterations = 10;
+
+#ifndef _MSC_VER
+// The peak resident memory of an invocation in a child process, in kilobytes.
+// This includes the memory of the test process at the time of the fork.
+static long peak_memory(const std::function<bool()>& invoke)
+{
+    const auto pid = fork();
+    if (pid == 0)
+        _exit(invoke() ? 0 : 1);
+
+    int status;
+    rusage usage;
+    if (pid < 0 || wait4(pid, &status, 0, &usage) != pid)
+        return 0;
+
+    return usage.ru_maxrss;
+}
+#else
+static long peak_memory(const std::function<bool()>&)
+{
+    return 0;
+}
+#endif
+
+// Invoke sequentially and report the peer message rate, invocation latency
+// and the peak memory of a separate invocation.
+static void measure_peer(const std::string& name, const stub_peer& peer,
+    const std::function<bool()>& invoke)
+{
+    std::vector<uint32_t> latencies;
+    size_t failures = 0;
+
+    const auto messages = peer.messages();
+    const auto bytes = peer.bytes();
+    const auto start = steady_clock::now();
+
+    for (size_t iteration = 0; iteration < peer_iterations; ++iteration)
+    {
+        const auto begin = steady_clock::now();
+        failures += invoke() ? 0 : 1;
+        latencies.push_back(static_cast<uint32_t>(duration_cast<milliseconds>(
+            steady_clock::now() - begin).count()));
+    }
+
+    const auto elapsed = std::max<int64_t>(duration_cast<milliseconds>(
+        steady_clock::now() - start).count(), 1);
+
+    std::sort(latencies.begin(), latencies.end());
+
+    BOOST_TEST_MESSAGE(name << ": " <<
+        (peer.messages() - messages) * 1000 / elapsed << " messages and " <<
+        (peer.bytes() - bytes) * 1000 / elapsed << " bytes per second, " <<
+        "p50/p99 " << latencies[latencies.size() / 2] << "/" <<
+        latencies.back() << " ms, " << failures << " failures, " <<
+        peak_memory(invoke) << " KB peak");
+}
+
+BOOST_AUTO_TEST_CASE(benchmark__load__peer)
+{
+    // Send p2p log output to /dev/null.
+    log::initialize();
+
+    const system::config::transaction tx(BX_SATOSHIS_WORDS_TX_BASE16);
+
+    // Unthrottled, then over a 1 MB/s link.
+    for (const auto bandwidth: { size_t(0), size_t(1000000) })
+    {
+        stub_peer peer;
+        peer.set_chain(10001, 1024);
+        peer.set_bandwidth(bandwidth);
+        BOOST_REQUIRE(peer.start());
+
+        BOOST_TEST_MESSAGE("bandwidth: " << bandwidth << " bytes per second");
+
+        measure_peer("get-filters", peer, [&]() -> bool
+        {
+            BX_DECLARE_STUB_PEER_COMMAND(get_filters, peer);
+            command.set_host_option("127.0.0.1");
+            command.set_port_option(peer.port());
+            command.set_height_argument(0);
+            command.set_hash_argument(peer.hash(999));
+            return command.invoke(output, error) == console_result::okay;
+        });
+
+        measure_peer("get-filter-headers", peer, [&]() -> bool
+        {
+            BX_DECLARE_STUB_PEER_COMMAND(get_filter_headers, peer);
+            command.set_host_option("127.0.0.1");
+            command.set_port_option(peer.port());
+            command.set_height_argument(0);
+            command.set_hash_argument(peer.hash(1999));
+            return command.invoke(output, error) == console_result::okay;
+        });
+
+        measure_peer("get-filter-checkpoint", peer, [&]() -> bool
+        {
+            BX_DECLARE_STUB_PEER_COMMAND(get_filter_checkpoint, peer);
+            command.set_host_option("127.0.0.1");
+            command.set_port_option(peer.port());
+            command.set_hash_argument(peer.hash(10000));
+            return command.invoke(output, error) == console_result::okay;
+        });
+
+        measure_peer("put-tx", peer, [&]() -> bool
+        {
+            BX_DECLARE_STUB_PEER_COMMAND(put_tx, peer);
+            command.set_host_option("127.0.0.1");
+            command.set_port_option(peer.port());
+            command.set_transaction_argument(tx);
+            return command.invoke(output, error) == console_result::okay;
+        });
+
+        // The peer is obtained by seeding, and requests the announced batch.
+        measure_peer("broadcast-tx", peer, [&]() -> bool
+        {
+            BX_DECLARE_STUB_PEER_COMMAND(broadcast_tx, peer);
+            command.set_nodes_option(1);
+            command.set_duration_option(5);
+            command.set_transactions_argument({ tx, tx });
+            return command.invoke(output, error) == console_result::okay;
+        });
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
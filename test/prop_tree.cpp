@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cstddef>
+#include <vector>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer::config;
+using namespace bc::system;
+
+static client::history::list make_rows(size_t count)
+{
+    client::history::list rows(count);
+    for (size_t index = 0; index < count; ++index)
+    {
+        rows[index].output = { null_hash, static_cast<uint32_t>(index) };
+        rows[index].output_height = index;
+        rows[index].value = index;
+    }
+
+    return rows;
+}
+
+BOOST_AUTO_TEST_SUITE(config)
+BOOST_AUTO_TEST_SUITE(config__prop_tree)
+
+BOOST_AUTO_TEST_CASE(prop_tree__prop_value_list__info__named_elements)
+{
+    const std::vector<uint32_t> values{ 1, 2, 3 };
+    const auto list = prop_value_list("value", values, false);
+    BOOST_REQUIRE_EQUAL(list.size(), 3u);
+    BOOST_REQUIRE_EQUAL(list.front().first, "value");
+    BOOST_REQUIRE_EQUAL(list.back().second.get_value<uint32_t>(), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(prop_tree__prop_value_list__json__unnamed_elements)
+{
+    const std::vector<uint32_t> values{ 1, 2, 3 };
+    const auto list = prop_value_list("value", values, true);
+    BOOST_REQUIRE_EQUAL(list.size(), 3u);
+    BOOST_REQUIRE(list.front().first.empty());
+    BOOST_REQUIRE_EQUAL(list.front().second.get_value<uint32_t>(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(prop_tree__prop_tree__history_rows__moved_elements)
+{
+    const auto tree = prop_tree(make_rows(2), false);
+    const auto& transfers = tree.get_child("transfers");
+    BOOST_REQUIRE_EQUAL(transfers.size(), 2u);
+    BOOST_REQUIRE_EQUAL(transfers.front().first, "transfer");
+    BOOST_REQUIRE_EQUAL(transfers.back().second.get<size_t>("received.index"), 1u);
+    BOOST_REQUIRE_EQUAL(transfers.back().second.get<size_t>("value"), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(prop_tree__prop_tree__tx_outputs__json__unnamed_elements)
+{
+    const tx_output_type::list outputs{ { 42, {} }, { 24, {} } };
+    const auto tree = prop_tree(outputs, true);
+    const auto& list = tree.get_child("outputs");
+    BOOST_REQUIRE_EQUAL(list.size(), 2u);
+    BOOST_REQUIRE(list.front().first.empty());
+    BOOST_REQUIRE_EQUAL(list.back().second.get<uint64_t>("value"), 24u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,544 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "stub_peer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <boost/asio.hpp>
+#include <boost/filesystem.hpp>
+#include <bitcoin/explorer.hpp>
+#include <bitcoin/network.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+using namespace bc::system;
+using namespace boost::asio::ip;
+using namespace std::chrono;
+
+#define STUB_PEER_GENESIS_HEADER \
+"0100000000000000000000000000000000000000000000000000000000000000000000003ba3edfd7a7b12b27ac72c3e67768f617fc81bc3888a51323a9fb8aa4b1e5e4a29ab5f49ffff001d1dac2b7c"
+
+// Messages are parsed and serialized at the latest protocol level.
+static const uint32_t level = message::version::level::maximum;
+
+// The limit of a headers response, as with a full node.
+static const size_t maximum_headers = 2000;
+
+// BIP157 filter header checkpoints are spaced at this block interval.
+static const size_t checkpoint_interval = 1000;
+
+// Larger messages are taken as a protocol failure.
+static const size_t maximum_payload = 32 * 1024 * 1024;
+
+static const std::string user_agent = "/bx-stub-peer/";
+
+static uint32_t magic()
+{
+    static const auto identifier = network::settings(
+        system::config::settings::mainnet).identifier;
+    return identifier;
+}
+
+static data_chunk frame(const std::string& command, const data_chunk& payload)
+{
+    const message::heading heading(magic(), command,
+        static_cast<uint32_t>(payload.size()), bitcoin_checksum(payload));
+
+    return build_chunk({ heading.to_data(), payload });
+}
+
+template <typename Message>
+static bool parse(Message& out, const data_chunk& payload)
+{
+    return out.from_data(level, payload);
+}
+
+stub_peer::stub_peer()
+  : hosts_file_(boost::filesystem::temp_directory_path() /
+        boost::filesystem::unique_path("bx-stub-%%%%-%%%%.hosts")),
+    stopped_(true),
+    port_(0),
+    messages_(0),
+    bytes_(0),
+    compact_filters_(true),
+    lying_(false),
+    requests_(1),
+    bandwidth_(0)
+{
+    set_chain(1, 32);
+}
+
+stub_peer::~stub_peer()
+{
+    stop();
+}
+
+// Headers are linked but are not valid proof of work, which the p2p commands
+// do not check. Filters are arbitrary data, distinct for each block.
+void stub_peer::set_chain(size_t count, size_t filter_size)
+{
+    data_chunk data;
+    chain::header genesis;
+    decode_base16(data, STUB_PEER_GENESIS_HEADER);
+    genesis.from_data(data);
+
+    headers_.clear();
+    hashes_.clear();
+    filters_.clear();
+    filter_headers_.clear();
+    heights_.clear();
+
+    auto filter_header = null_hash;
+    for (size_t height = 0; height < std::max(count, size_t(1)); ++height)
+    {
+        const auto index = static_cast<uint32_t>(height);
+        const auto header = height == 0 ? genesis : chain::header(
+            genesis.version(), hashes_.back(),
+            bitcoin_hash(to_chunk(to_little_endian(index))),
+            genesis.timestamp() + index * 600, genesis.bits(), index);
+
+        data_chunk filter(filter_size);
+        for (size_t offset = 0; offset < filter_size; ++offset)
+            filter[offset] = static_cast<uint8_t>(height + offset);
+
+        filter_header = bitcoin_hash(build_chunk(
+            { bitcoin_hash(filter), filter_header }));
+
+        heights_[header.hash()] = height;
+        headers_.push_back(header);
+        hashes_.push_back(header.hash());
+        filters_.push_back(filter);
+        filter_headers_.push_back(filter_header);
+    }
+}
+
+void stub_peer::set_compact_filters(bool value)
+{
+    compact_filters_ = value;
+}
+
+void stub_peer::set_lying(bool value)
+{
+    lying_ = value;
+}
+
+void stub_peer::set_requests(size_t count)
+{
+    requests_ = count;
+}
+
+void stub_peer::set_bandwidth(size_t bytes_per_second)
+{
+    bandwidth_ = bytes_per_second;
+}
+
+bool stub_peer::start()
+{
+    if (!stopped_)
+        return false;
+
+    stopped_ = false;
+    std::promise<bool> started;
+    auto result = started.get_future();
+    thread_ = std::thread(&stub_peer::accept, this, std::ref(started));
+
+    if (result.get())
+        return true;
+
+    thread_.join();
+    stopped_ = true;
+    return false;
+}
+
+void stub_peer::stop()
+{
+    if (stopped_.exchange(true))
+        return;
+
+    // The acceptor is blocked, so release it with a connection.
+    boost::system::error_code ec;
+    tcp::socket wake(service_);
+    wake.connect(tcp::endpoint(address_v4::loopback(), port_), ec);
+    thread_.join();
+
+    std::vector<std::thread> sessions;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& socket: sockets_)
+            socket->shutdown(tcp::socket::shutdown_both, ec);
+
+        sessions.swap(sessions_);
+    }
+
+    for (auto& session: sessions)
+        session.join();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    sockets_.clear();
+    boost::filesystem::remove(hosts_file_, ec);
+}
+
+uint16_t stub_peer::port() const
+{
+    return port_;
+}
+
+void stub_peer::configure(command& command) const
+{
+    command.set_network_seeds_setting(
+    {
+        system::config::endpoint("127.0.0.1", port_)
+    });
+
+    command.set_network_hosts_file_setting(hosts_file_);
+    command.set_network_connect_retries_setting(0);
+    command.set_network_connect_timeout_seconds_setting(5);
+    command.set_network_channel_handshake_seconds_setting(5);
+}
+
+hash_digest stub_peer::hash(size_t height) const
+{
+    return hashes_.at(height);
+}
+
+data_chunk stub_peer::filter(size_t height) const
+{
+    return filters_.at(height);
+}
+
+hash_digest stub_peer::filter_header(size_t height) const
+{
+    return filter_headers_.at(height);
+}
+
+size_t stub_peer::messages() const
+{
+    return messages_;
+}
+
+size_t stub_peer::bytes() const
+{
+    return bytes_;
+}
+
+chain::transaction::list stub_peer::transactions() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return transactions_;
+}
+
+// private
+//-----------------------------------------------------------------------------
+
+void stub_peer::accept(std::promise<bool>& started)
+{
+    boost::system::error_code ec;
+    tcp::acceptor acceptor(service_);
+    const tcp::endpoint local(address_v4::loopback(), 0);
+
+    acceptor.open(local.protocol(), ec);
+    if (!ec)
+        acceptor.bind(local, ec);
+    if (!ec)
+        acceptor.listen(boost::asio::socket_base::max_connections, ec);
+
+    if (ec)
+    {
+        started.set_value(false);
+        return;
+    }
+
+    port_ = acceptor.local_endpoint().port();
+    started.set_value(true);
+
+    while (!stopped_)
+    {
+        const auto socket = std::make_shared<tcp::socket>(service_);
+        acceptor.accept(*socket, ec);
+
+        if (ec || stopped_)
+            break;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        sockets_.push_back(socket);
+        sessions_.emplace_back(&stub_peer::serve, this, socket);
+    }
+}
+
+void stub_peer::serve(socket_ptr socket)
+{
+    boost::system::error_code ec;
+    data_chunk header(message::heading::maximum_size());
+
+    while (!stopped_)
+    {
+        boost::asio::read(*socket, boost::asio::buffer(header), ec);
+        if (ec)
+            break;
+
+        const auto heading = message::heading::factory(header);
+        if (!heading.is_valid() || heading.magic() != magic() ||
+            heading.payload_size() > maximum_payload)
+            break;
+
+        data_chunk payload(heading.payload_size());
+        boost::asio::read(*socket, boost::asio::buffer(payload), ec);
+        if (ec)
+            break;
+
+        ++messages_;
+        if (!handle(*socket, heading.command(), payload))
+            break;
+    }
+
+    socket->close(ec);
+}
+
+template <typename Message>
+bool stub_peer::send(tcp::socket& socket, const Message& message)
+{
+    return send(socket, frame(Message::command, message.to_data(level)));
+}
+
+bool stub_peer::handle(tcp::socket& socket, const std::string& command,
+    const data_chunk& payload)
+{
+    const auto top = hashes_.size() - 1;
+
+    if (command == message::version::command)
+    {
+        static std::mt19937_64 twister(std::random_device{}());
+        const uint64_t filters = compact_filters_ ?
+            message::version::service::node_compact_filters : 0;
+
+        message::version version;
+        version.set_value(level);
+        version.set_services(message::version::service::node_network |
+            filters);
+        version.set_timestamp(static_cast<uint64_t>(std::time(nullptr)));
+        version.set_address_receiver(message::network_address());
+        version.set_address_sender(message::network_address());
+        version.set_nonce(twister());
+        version.set_user_agent(user_agent);
+        version.set_start_height(static_cast<uint32_t>(top));
+        version.set_relay(true);
+
+        return send(socket, version) && send(socket, message::verack());
+    }
+
+    if (command == message::ping::command)
+    {
+        message::ping ping;
+        return !parse(ping, payload) ||
+            send(socket, message::pong(ping.nonce()));
+    }
+
+    // Seeding obtains this peer as the only address.
+    if (command == message::get_address::command)
+    {
+        auto address = system::config::authority("127.0.0.1", port_)
+            .to_network_address();
+        address.set_timestamp(static_cast<uint32_t>(std::time(nullptr)));
+        address.set_services(message::version::service::node_network);
+        return send(socket, message::address({ address }));
+    }
+
+    // Headers follow the first known locator hash, or genesis if none.
+    if (command == message::get_headers::command)
+    {
+        message::get_headers request;
+        if (!parse(request, payload))
+            return false;
+
+        size_t start = 0;
+        for (const auto& hash: request.start_hashes())
+        {
+            const auto it = heights_.find(hash);
+            if (it != heights_.end())
+            {
+                start = it->second + 1;
+                break;
+            }
+        }
+
+        const auto stop = std::min(height(request.stop_hash()), top);
+        const auto end = std::min(stop + 1, start + maximum_headers);
+        const auto count = end > start ? end - start : 0;
+
+        // Each header is followed by an empty transaction count.
+        data_chunk response;
+        data_sink stream(response);
+        ostream_writer sink(stream);
+        sink.write_variable_little_endian(count);
+
+        for (auto index = start; index < start + count; ++index)
+        {
+            headers_[index].to_data(sink);
+            sink.write_variable_little_endian(0);
+        }
+
+        stream.flush();
+        return send(socket, frame(message::headers::command, response));
+    }
+
+    if (command == message::get_compact_filter_checkpoint::command)
+    {
+        message::get_compact_filter_checkpoint request;
+        if (!parse(request, payload))
+            return false;
+
+        const auto stop = height(request.stop_hash());
+        if (stop > top)
+            return true;
+
+        hash_list checkpoints;
+        for (auto index = checkpoint_interval; index <= stop;
+            index += checkpoint_interval)
+            checkpoints.push_back(filter_headers_[index]);
+
+        return send(socket, message::compact_filter_checkpoint(
+            request.filter_type(), request.stop_hash(), checkpoints));
+    }
+
+    if (command == message::get_compact_filter_headers::command)
+    {
+        message::get_compact_filter_headers request;
+        if (!parse(request, payload))
+            return false;
+
+        const size_t start = request.start_height();
+        const auto stop = height(request.stop_hash());
+        if (stop > top || start > stop)
+            return true;
+
+        hash_list filter_hashes;
+        for (auto index = start; index <= stop; ++index)
+            filter_hashes.push_back(bitcoin_hash(served_filter(index)));
+
+        // The headers of a lying peer commit to its altered filters.
+        auto previous = start == 0 || lying_ ? null_hash :
+            filter_headers_[start - 1];
+
+        for (size_t index = 0; lying_ && index < start; ++index)
+            previous = bitcoin_hash(build_chunk(
+                { bitcoin_hash(served_filter(index)), previous }));
+
+        return send(socket, message::compact_filter_headers(
+            request.filter_type(), request.stop_hash(), previous,
+            filter_hashes));
+    }
+
+    if (command == message::get_compact_filters::command)
+    {
+        message::get_compact_filters request;
+        if (!parse(request, payload))
+            return false;
+
+        const size_t start = request.start_height();
+        const auto stop = height(request.stop_hash());
+        if (stop > top || start > stop)
+            return true;
+
+        for (auto index = start; index <= stop; ++index)
+            if (!send(socket, message::compact_filter(request.filter_type(),
+                hashes_[index], served_filter(index))))
+                return false;
+
+        return true;
+    }
+
+    // Announced transactions are requested, repeatedly if so configured.
+    if (command == message::inventory::command)
+    {
+        message::inventory request;
+        if (!parse(request, payload))
+            return false;
+
+        message::inventory_vector::list inventories;
+        for (const auto& inventory: request.inventories())
+            if (inventory.type() ==
+                message::inventory_vector::type_id::transaction)
+                inventories.push_back(inventory);
+
+        for (size_t count = 0; !inventories.empty() && count < requests_;
+            ++count)
+            if (!send(socket, message::get_data(inventories)))
+                return false;
+
+        return true;
+    }
+
+    if (command == message::transaction::command)
+    {
+        message::transaction tx;
+        if (!parse(tx, payload))
+            return false;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        transactions_.push_back(tx);
+        return true;
+    }
+
+    // Other messages, such as verack and address, are ignored.
+    return true;
+}
+
+bool stub_peer::send(tcp::socket& socket, const data_chunk& message)
+{
+    boost::system::error_code ec;
+    boost::asio::write(socket, boost::asio::buffer(message), ec);
+    if (ec)
+        return false;
+
+    ++messages_;
+    bytes_ += message.size();
+
+    // Throttle by holding the connection for the time of the transfer.
+    if (bandwidth_ > 0)
+        std::this_thread::sleep_for(microseconds(
+            message.size() * 1000000 / bandwidth_));
+
+    return true;
+}
+
+// An unknown hash has a height above the top.
+size_t stub_peer::height(const hash_digest& hash) const
+{
+    const auto it = heights_.find(hash);
+    return it == heights_.end() ? hashes_.size() : it->second;
+}
+
+data_chunk stub_peer::served_filter(size_t height) const
+{
+    auto filter = filters_[height];
+    if (lying_ && !filter.empty())
+        filter.front() ^= 0xff;
+
+    return filter;
+}
@@ -0,0 +1,163 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_STUB_PEER_HPP
+#define BX_STUB_PEER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <boost/asio.hpp>
+#include <boost/filesystem.hpp>
+#include <bitcoin/explorer.hpp>
+
+/**
+ * A stand-in BIP157 peer for testing and load testing the p2p commands
+ * without a network. The peer completes the version handshake, advertises
+ * compact filters and serves headers, filters, filter headers and filter
+ * checkpoints from a synthesized chain. Transactions sent to the peer are
+ * accepted and retained. Writes may be throttled to a bandwidth limit.
+ */
+class stub_peer
+{
+public:
+    stub_peer();
+
+    /**
+     * Stop the peer if it is running.
+     */
+    ~stub_peer();
+
+    /**
+     * Synthesize a linked chain of this many blocks from the mainnet genesis
+     * header, with a filter of the given size for each block.
+     */
+    void set_chain(size_t count, size_t filter_size);
+
+    /**
+     * Advertise compact filter service (default true).
+     */
+    void set_compact_filters(bool value);
+
+    /**
+     * Serve altered filters, with filter headers that commit to them, but
+     * correct filter header checkpoints (default false).
+     */
+    void set_lying(bool value);
+
+    /**
+     * Request each announced transaction this many times (default one).
+     */
+    void set_requests(size_t count);
+
+    /**
+     * Limit writes to the given bytes per second, zero is unlimited.
+     */
+    void set_bandwidth(size_t bytes_per_second);
+
+    /**
+     * Listen for connections on a loopback port.
+     */
+    bool start();
+
+    /**
+     * Stop listening and close all connections.
+     */
+    void stop();
+
+    /**
+     * The port on which the peer is listening.
+     */
+    uint16_t port() const;
+
+    /**
+     * Set the network settings of the command to use only this peer.
+     */
+    void configure(bc::explorer::command& command) const;
+
+    /**
+     * The block hash, filter and filter header at the height.
+     */
+    bc::system::hash_digest hash(size_t height) const;
+    bc::system::data_chunk filter(size_t height) const;
+    bc::system::hash_digest filter_header(size_t height) const;
+
+    /**
+     * The number of messages sent and received and bytes sent.
+     */
+    size_t messages() const;
+    size_t bytes() const;
+
+    /**
+     * The transactions accepted from connections.
+     */
+    bc::system::chain::transaction::list transactions() const;
+
+private:
+    typedef std::shared_ptr<boost::asio::ip::tcp::socket> socket_ptr;
+
+    void accept(std::promise<bool>& started);
+    void serve(socket_ptr socket);
+    bool handle(boost::asio::ip::tcp::socket& socket,
+        const std::string& command, const bc::system::data_chunk& payload);
+    bool send(boost::asio::ip::tcp::socket& socket,
+        const bc::system::data_chunk& message);
+
+    template <typename Message>
+    bool send(boost::asio::ip::tcp::socket& socket, const Message& message);
+
+    size_t height(const bc::system::hash_digest& hash) const;
+    bc::system::data_chunk served_filter(size_t height) const;
+
+    const boost::filesystem::path hosts_file_;
+    std::atomic<bool> stopped_;
+    std::atomic<uint16_t> port_;
+    std::atomic<size_t> messages_;
+    std::atomic<size_t> bytes_;
+    std::thread thread_;
+    boost::asio::io_service service_;
+
+    // The chain is immutable while the peer is running.
+    bool compact_filters_;
+    bool lying_;
+    size_t requests_;
+    size_t bandwidth_;
+    bc::system::chain::header::list headers_;
+    bc::system::hash_list hashes_;
+    bc::system::data_stack filters_;
+    bc::system::hash_list filter_headers_;
+    std::map<bc::system::hash_digest, size_t> heights_;
+
+    // These are protected by the mutex.
+    mutable std::mutex mutex_;
+    std::vector<socket_ptr> sockets_;
+    std::vector<std::thread> sessions_;
+    bc::system::chain::transaction::list transactions_;
+};
+
+#define BX_DECLARE_STUB_PEER_COMMAND(extension, peer) \
+    BX_DECLARE_PEER_COMMAND(extension); \
+    peer.configure(command)
+
+#endif
@@ -0,0 +1,348 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "stub_server.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <map>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+using namespace bc::protocol;
+using namespace bc::system;
+using namespace std::chrono;
+
+// The server wakes at this interval to send due replies and notifications.
+static const int32_t poll_milliseconds = 1;
+
+// A reply held until its delay has elapsed.
+struct scheduled_reply
+{
+    data_chunk route;
+    std::string command;
+    data_chunk id;
+    code ec;
+    data_chunk payload;
+};
+
+typedef std::multimap<steady_clock::time_point, scheduled_reply> schedule;
+
+// A subscriber is notified by the route and id of its subscription.
+typedef std::multimap<std::string, std::pair<data_chunk, data_chunk>>
+    subscribers;
+
+static const std::string subscribe_prefix = "subscribe.";
+
+static boost::filesystem::path make_socket()
+{
+    using namespace boost::filesystem;
+    return temp_directory_path() / unique_path("bx-stub-%%%%-%%%%.server");
+}
+
+stub_server::stub_server()
+  : socket_(make_socket()),
+    stopped_(true),
+    latency_(0),
+    jitter_(0),
+    error_rate_(0),
+    error_(error::operation_failed)
+{
+}
+
+stub_server::~stub_server()
+{
+    stop();
+}
+
+void stub_server::set_reply(const std::string& command,
+    const data_chunk& payload)
+{
+    set_handler(command, [payload](const data_stack&) { return payload; });
+}
+
+void stub_server::set_handler(const std::string& command, handler reply)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    fixtures_[command] = { error::success, reply };
+}
+
+void stub_server::set_error(const std::string& command, const code& ec)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    fixtures_[command] = { ec, nullptr };
+}
+
+void stub_server::set_latency(uint32_t milliseconds,
+    uint32_t jitter_milliseconds)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    latency_ = milliseconds;
+    jitter_ = jitter_milliseconds;
+}
+
+void stub_server::set_delay(const std::string& command, delayer delay)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    delays_[command] = delay;
+}
+
+void stub_server::set_error_rate(uint16_t percent, const code& ec)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    error_rate_ = percent;
+    error_ = ec;
+}
+
+bool stub_server::start()
+{
+    std::promise<bool> started;
+    auto result = started.get_future();
+
+    stopped_ = false;
+    thread_ = std::thread([this, &started]()
+    {
+        run(started);
+    });
+
+    if (result.get())
+        return true;
+
+    stop();
+    return false;
+}
+
+void stub_server::stop()
+{
+    stopped_ = true;
+
+    if (!thread_.joinable())
+        return;
+
+    thread_.join();
+
+    boost::system::error_code ignored;
+    boost::filesystem::remove(get_agent_endpoint(socket_, "").host(),
+        ignored);
+    boost::filesystem::remove(get_agent_endpoint(socket_, "block").host(),
+        ignored);
+    boost::filesystem::remove(
+        get_agent_endpoint(socket_, "transaction").host(), ignored);
+}
+
+void stub_server::configure(command& command) const
+{
+    command.set_server_url_setting(get_agent_endpoint(socket_, ""));
+    command.set_server_block_url_setting(get_agent_endpoint(socket_,
+        "block"));
+    command.set_server_transaction_url_setting(get_agent_endpoint(socket_,
+        "transaction"));
+    command.set_server_connect_retries_setting(0);
+    command.set_server_connect_timeout_seconds_setting(5);
+}
+
+void stub_server::publish_block(uint32_t height, const chain::block& block)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    blocks_.emplace_back(height, block.to_data());
+}
+
+void stub_server::publish_transaction(const chain::transaction& tx)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    transactions_.push_back(tx.to_data());
+}
+
+void stub_server::notify(const std::string& command,
+    const data_chunk& payload)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    notifications_.emplace_back(command, payload);
+}
+
+size_t stub_server::requests(const std::string& command) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto count = requests_.find(command);
+    return count == requests_.end() ? 0 : count->second;
+}
+
+// The started promise is not referenced once it has been set.
+void stub_server::run(std::promise<bool>& started)
+{
+    zmq::context context;
+    zmq::socket query(context, zmq::socket::role::router);
+    zmq::socket block(context, zmq::socket::role::publisher);
+    zmq::socket transaction(context, zmq::socket::role::publisher);
+
+    if (query.bind(get_agent_endpoint(socket_, "")) != error::success ||
+        block.bind(get_agent_endpoint(socket_, "block")) != error::success ||
+        transaction.bind(get_agent_endpoint(socket_, "transaction")) !=
+            error::success)
+    {
+        started.set_value(false);
+        return;
+    }
+
+    started.set_value(true);
+
+    zmq::poller poller;
+    poller.add(query);
+
+    std::mt19937 twister(std::random_device{}());
+    schedule pending;
+    subscribers subscribed;
+    uint16_t block_sequence = 0;
+    uint16_t transaction_sequence = 0;
+
+    // Requests are [route][command][id][payload...].
+    const auto receive = [&]()
+    {
+        zmq::message request;
+        if (query.receive(request) != error::success || request.size() < 3)
+            return;
+
+        scheduled_reply reply;
+        reply.route = request.dequeue_data();
+        const auto command = request.dequeue_data();
+        reply.command.assign(command.begin(), command.end());
+        reply.id = request.dequeue_data();
+
+        data_stack payload;
+        while (!request.empty())
+            payload.push_back(request.dequeue_data());
+
+        if (reply.command.compare(0, subscribe_prefix.size(),
+            subscribe_prefix) == 0)
+            subscribed.emplace(reply.command,
+                std::make_pair(reply.route, reply.id));
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++requests_[reply.command];
+
+        const auto fixture = fixtures_.find(reply.command);
+        std::uniform_int_distribution<uint32_t> percent(0, 99);
+        std::uniform_int_distribution<uint32_t> jitter(0, jitter_);
+
+        if (percent(twister) < error_rate_)
+            reply.ec = error_;
+        else if (fixture == fixtures_.end())
+            reply.ec = error::not_found;
+        else if (fixture->second.ec)
+            reply.ec = fixture->second.ec;
+        else
+            reply.payload = fixture->second.reply(payload);
+
+        const auto scripted = delays_.find(reply.command);
+        const auto delay = milliseconds(latency_ + jitter(twister) +
+            (scripted == delays_.end() ? 0 : scripted->second(payload)));
+        pending.emplace(steady_clock::now() + delay, std::move(reply));
+    };
+
+    // Replies are [route][command][id][code][payload].
+    const auto send_due = [&]()
+    {
+        const auto now = steady_clock::now();
+
+        while (!pending.empty() && pending.begin()->first <= now)
+        {
+            const auto& reply = pending.begin()->second;
+            const auto ec = static_cast<uint32_t>(reply.ec.value());
+
+            zmq::message message;
+            message.enqueue(reply.route);
+            message.enqueue(to_chunk(reply.command));
+            message.enqueue(reply.id);
+            message.enqueue(build_chunk({ to_little_endian(ec),
+                reply.payload }));
+
+            query.send(message);
+            pending.erase(pending.begin());
+        }
+    };
+
+    const auto publish = [&]()
+    {
+        std::vector<std::pair<uint32_t, data_chunk>> blocks;
+        data_stack transactions;
+        std::vector<std::pair<std::string, data_chunk>> notifications;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            blocks.swap(blocks_);
+            transactions.swap(transactions_);
+            notifications.swap(notifications_);
+        }
+
+        for (const auto& notification: notifications)
+        {
+            const auto range = subscribed.equal_range(notification.first);
+
+            for (auto subscriber = range.first; subscriber != range.second;
+                ++subscriber)
+            {
+                zmq::message message;
+                message.enqueue(subscriber->second.first);
+                message.enqueue(to_chunk(notification.first));
+                message.enqueue(subscriber->second.second);
+                message.enqueue(build_chunk({ to_little_endian(uint32_t(0)),
+                    notification.second }));
+                query.send(message);
+            }
+        }
+
+        for (const auto& notification: blocks)
+        {
+            zmq::message message;
+            message.enqueue_little_endian(block_sequence++);
+            message.enqueue_little_endian(notification.first);
+            message.enqueue(notification.second);
+            block.send(message);
+        }
+
+        for (const auto& notification: transactions)
+        {
+            zmq::message message;
+            message.enqueue_little_endian(transaction_sequence++);
+            message.enqueue(notification);
+            transaction.send(message);
+        }
+    };
+
+    while (!stopped_ && !poller.terminated())
+    {
+        if (poller.wait(poll_milliseconds).contains(query.id()))
+            receive();
+
+        send_due();
+        publish();
+    }
+
+    query.stop();
+    block.stop();
+    transaction.stop();
+}
@@ -0,0 +1,166 @@
+/**
+ * Copyright (c) 2011-2019 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_STUB_SERVER_HPP
+#define BX_STUB_SERVER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include <bitcoin/explorer.hpp>
+
+/**
+ * A stand-in libbitcoin server for testing and load testing network commands
+ * without a network. Queries are answered from fixtures by command name, and
+ * block and transaction notifications are published on request, as are
+ * notifications to the subscribers of "subscribe." commands. Replies are
+ * delayed by the configured latency and jitter, and fail at the configured
+ * error rate. Unscripted queries fail with error::not_found.
+ */
+class stub_server
+{
+public:
+    /**
+     * A scripted reply, from the request payload (excluding command and id).
+     */
+    typedef std::function<bc::system::data_chunk(
+        const bc::system::data_stack& request)> handler;
+
+    /**
+     * A scripted reply delay in milliseconds, from the request payload.
+     */
+    typedef std::function<uint32_t(
+        const bc::system::data_stack& request)> delayer;
+
+    stub_server();
+
+    /**
+     * Stop the server if it is running.
+     */
+    ~stub_server();
+
+    /**
+     * Reply to the command with a successful fixed payload.
+     */
+    void set_reply(const std::string& command,
+        const bc::system::data_chunk& payload);
+
+    /**
+     * Reply to the command with a successful scripted payload.
+     */
+    void set_handler(const std::string& command, handler reply);
+
+    /**
+     * Reply to the command with the error code.
+     */
+    void set_error(const std::string& command, const bc::system::code& ec);
+
+    /**
+     * Delay each reply by the latency plus a uniform random jitter.
+     */
+    void set_latency(uint32_t milliseconds, uint32_t jitter_milliseconds);
+
+    /**
+     * Further delay each reply to the command by the scripted delay.
+     */
+    void set_delay(const std::string& command, delayer delay);
+
+    /**
+     * Fail this percentage of all queries with the error code.
+     */
+    void set_error_rate(uint16_t percent, const bc::system::code& ec);
+
+    /**
+     * Bind the query, block and transaction services to local sockets.
+     */
+    bool start();
+
+    /**
+     * Stop the server and remove its sockets.
+     */
+    void stop();
+
+    /**
+     * Set the server settings of the command to the services of this server.
+     */
+    void configure(bc::explorer::command& command) const;
+
+    /**
+     * Publish a block notification, as [sequence][height][block].
+     */
+    void publish_block(uint32_t height, const bc::system::chain::block& block);
+
+    /**
+     * Publish a transaction notification, as [sequence][transaction].
+     */
+    void publish_transaction(const bc::system::chain::transaction& tx);
+
+    /**
+     * Send a notification to each subscriber by the command, as a further
+     * reply to its subscription, as [code][payload].
+     */
+    void notify(const std::string& command,
+        const bc::system::data_chunk& payload);
+
+    /**
+     * The number of queries received for the command.
+     */
+    size_t requests(const std::string& command) const;
+
+private:
+    struct fixture
+    {
+        bc::system::code ec;
+        handler reply;
+    };
+
+    void run(std::promise<bool>& started);
+
+    const boost::filesystem::path socket_;
+    std::atomic<bool> stopped_;
+    std::thread thread_;
+
+    // These are protected by the mutex.
+    mutable std::mutex mutex_;
+    std::map<std::string, fixture> fixtures_;
+    std::map<std::string, delayer> delays_;
+    std::map<std::string, size_t> requests_;
+    std::vector<std::pair<uint32_t, bc::system::data_chunk>> blocks_;
+    bc::system::data_stack transactions_;
+    std::vector<std::pair<std::string, bc::system::data_chunk>>
+        notifications_;
+    uint32_t latency_;
+    uint32_t jitter_;
+    uint16_t error_rate_;
+    bc::system::code error_;
+};
+
+#define BX_DECLARE_STUB_COMMAND(extension, server) \
+    BX_DECLARE_COMMAND(extension); \
+    server.configure(command)
+
+#endif